@@ -0,0 +1,30 @@
+# Finds libzstd, 1.4 or later (for ZSTD_compress2 and the advanced API).
+#
+# This module defines:
+# ZSTD_INCLUDE_DIR
+# ZSTD_LIBRARY
+# ZSTD_VERSION
+#
+
+find_path(ZSTD_INCLUDE_DIR NAMES zstd.h)
+find_library(ZSTD_LIBRARY NAMES zstd)
+
+if (ZSTD_INCLUDE_DIR AND EXISTS "${ZSTD_INCLUDE_DIR}/zstd.h")
+  FILE(READ "${ZSTD_INCLUDE_DIR}/zstd.h" _ZSTD_HEADER_CONTENTS)
+  STRING(REGEX REPLACE ".*#define ZSTD_VERSION_MAJOR +([0-9]+).*" "\\1"
+         ZSTD_VERSION_MAJOR "${_ZSTD_HEADER_CONTENTS}")
+  STRING(REGEX REPLACE ".*#define ZSTD_VERSION_MINOR +([0-9]+).*" "\\1"
+         ZSTD_VERSION_MINOR "${_ZSTD_HEADER_CONTENTS}")
+  STRING(REGEX REPLACE ".*#define ZSTD_VERSION_RELEASE +([0-9]+).*" "\\1"
+         ZSTD_VERSION_RELEASE "${_ZSTD_HEADER_CONTENTS}")
+  set(ZSTD_VERSION
+      "${ZSTD_VERSION_MAJOR}.${ZSTD_VERSION_MINOR}.${ZSTD_VERSION_RELEASE}")
+endif()
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(
+    Zstd
+    REQUIRED_VARS ZSTD_LIBRARY ZSTD_INCLUDE_DIR
+    VERSION_VAR ZSTD_VERSION)
+
+mark_as_advanced(ZSTD_INCLUDE_DIR ZSTD_LIBRARY)
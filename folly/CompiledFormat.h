@@ -0,0 +1,523 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * format() with a format string parsed at compile time.
+ *
+ * FOLLY_FMT("...") makes a string literal into a format string type. The
+ * overloads of format(), sformat() and format(&out, ...) taking one parse
+ * it when compiled into a sequence of literal pieces and fields, so that
+ * nothing is parsed when called:
+ *
+ *   std::string s = sformat(FOLLY_FMT("{} has {} items"), name, count);
+ *   format(&out, FOLLY_FMT("{0}:{1:08x}\n"), host, port);
+ *
+ * The syntax is the one of format(). Fields without key nor format spec
+ * ("{}", "{1}") of integers and strings are appended directly; the other
+ * fields are formatted by FormatValue, as by format(), with a FormatArg
+ * parsed once per program. The output is reserved beforehand from
+ * estimateSpaceNeeded().
+ *
+ * Errors of the format string (missing '}', single '}', named arguments,
+ * default and explicit indexes mixed), an argument count different from
+ * the one of the format string, and arguments which have no FormatValue
+ * fail to compile. Errors of format specs are thrown as BadFormatArg when
+ * formatting. Dynamic field widths ("{:*}") are not supported.
+ */
+
+#ifndef FOLLY_COMPILEDFORMAT_H_
+#define FOLLY_COMPILEDFORMAT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+
+#include <folly/Format.h>
+
+/**
+ * A compile-time format string, of a string literal.
+ */
+#define FOLLY_FMT(str)                                                  \
+  ([] {                                                                 \
+    struct FollyFormatString : ::folly::detail::FormatStringTag {       \
+      static constexpr const char* data() { return str; }               \
+      static constexpr size_t size() { return sizeof(str) - 1; }        \
+    };                                                                  \
+    return FollyFormatString();                                         \
+  }())
+
+namespace folly {
+
+namespace detail {
+
+struct FormatStringTag {};
+
+template <class S>
+struct IsFormatString : std::is_base_of<FormatStringTag, S> {};
+
+/*
+ * Parsing, as constexpr functions of (format string, position, end).
+ * Literal pieces are cut every kFormatMaxLiteral characters to bound the
+ * depth of recursion.
+ */
+constexpr size_t kFormatMaxLiteral = 256;
+
+enum FormatToken {
+  kFormatEnd,
+  kFormatLiteral,
+  kFormatOpenBrace,     // "{{"
+  kFormatCloseBrace,    // "}}"
+  kFormatField,
+  kFormatOpenAtEnd,
+  kFormatSingleClose,
+};
+
+constexpr int formatToken(const char* s, size_t i, size_t n) {
+  return i == n ? kFormatEnd
+    : s[i] == '{' ? (i + 1 == n ? kFormatOpenAtEnd
+                     : s[i + 1] == '{' ? kFormatOpenBrace : kFormatField)
+    : s[i] == '}' ? (i + 1 < n && s[i + 1] == '}' ? kFormatCloseBrace
+                     : kFormatSingleClose)
+    : kFormatLiteral;
+}
+
+constexpr size_t formatFind(const char* s, char c, size_t i, size_t n) {
+  return i == n || s[i] == c ? i : formatFind(s, c, i + 1, n);
+}
+
+constexpr size_t formatFindBrace(const char* s, size_t i, size_t n) {
+  return i == n || s[i] == '{' || s[i] == '}'
+    ? i : formatFindBrace(s, i + 1, n);
+}
+
+constexpr size_t formatLiteralEnd(const char* s, size_t i, size_t n) {
+  return formatFindBrace(
+      s, i, n - i > kFormatMaxLiteral ? i + kFormatMaxLiteral : n);
+}
+
+// End of the first key component of the key [i, n), as by
+// FormatArg::splitKey()
+constexpr size_t formatKeyPieceEnd(const char* s, size_t i, size_t n) {
+  return n != i && s[n - 1] == ']'
+    ? formatFind(s, '[', i, n) : formatFind(s, '.', i, n);
+}
+
+constexpr bool formatIsIndex(const char* s, size_t i, size_t n) {
+  return i == n || (s[i] >= '0' && s[i] <= '9' && formatIsIndex(s, i + 1, n));
+}
+
+constexpr size_t formatIndex(const char* s, size_t i, size_t n, size_t v) {
+  return i == n ? v : formatIndex(s, i + 1, n, v * 10 + (s[i] - '0'));
+}
+
+/*
+ * Appending numbers and strings of fields without key nor format spec,
+ * with the output of FormatValue.
+ */
+template <class T>
+struct IsFormatInteger : std::integral_constant<bool,
+  std::is_integral<T>::value &&
+  !std::is_same<T, bool>::value &&
+  !std::is_same<T, char>::value &&
+  sizeof(T) <= sizeof(uint64_t)> {};
+
+template <class T>
+struct IsFormatCString : std::integral_constant<bool,
+  std::is_convertible<T, const char*>::value> {};
+
+template <class T>
+struct IsFormatStringPiece : std::integral_constant<bool,
+  !IsFormatCString<T>::value &&
+  std::is_convertible<T, StringPiece>::value> {};
+
+template <class T, class Callback>
+typename std::enable_if<IsFormatInteger<T>::value>::type
+formatSimple(T value, Callback& cb) {
+  char buffer[21];
+  char* p = buffer;
+  uint64_t u = value;
+  if (is_negative(value)) {
+    *p++ = '-';
+    u = -u;
+  }
+  p += uint64ToBufferUnsafe(u, p);
+  cb(StringPiece(buffer, p));
+}
+
+template <class T, class Callback>
+typename std::enable_if<IsFormatCString<T>::value>::type
+formatSimple(const T& value, Callback& cb) {
+  const char* p = value;
+  cb(p ? StringPiece(p) : StringPiece("(null)"));
+}
+
+template <class T, class Callback>
+typename std::enable_if<IsFormatStringPiece<T>::value>::type
+formatSimple(const T& value, Callback& cb) {
+  cb(StringPiece(value));
+}
+
+template <class T, class Callback>
+typename std::enable_if<!IsFormatInteger<T>::value &&
+                        !IsFormatCString<T>::value &&
+                        !IsFormatStringPiece<T>::value>::type
+formatSimple(const T& value, Callback& cb) {
+  FormatArg arg((StringPiece()));
+  FormatValue<typename std::decay<const T>::type>(value).format(arg, cb);
+}
+
+template <class T>
+auto estimateFormatted(const T& value, int)
+  -> decltype(estimateSpaceNeeded(value)) {
+  return estimateSpaceNeeded(value);
+}
+
+template <class T>
+size_t estimateFormatted(const T&, long) {
+  return 0;
+}
+
+/*
+ * The operations of a compiled format string.
+ */
+template <class S, size_t B, size_t E>
+struct FormatLiteralOp {
+  template <class Values>
+  static size_t estimate(const Values&) {
+    return E - B;
+  }
+
+  template <class Values, class Callback>
+  static void write(const Values&, Callback& cb) {
+    cb(StringPiece(S::data() + B, E - B));
+  }
+};
+
+// The field starting at B, the arguments before it having used ArgCount
+// arguments in order if default indexes
+template <class S, size_t B, size_t ArgCount>
+struct FormatFieldOp {
+  static constexpr size_t kEnd = formatFind(S::data(), '}', B, S::size());
+  static constexpr size_t kKeyEnd = formatFind(S::data(), ':', B, kEnd);
+  static constexpr size_t kPieceEnd = formatKeyPieceEnd(S::data(), B, kKeyEnd);
+  static constexpr bool kDefaultIndex = kPieceEnd == B;
+  static constexpr bool kValidIndex = formatIsIndex(S::data(), B, kPieceEnd);
+  static constexpr size_t kIndex = kDefaultIndex
+    ? ArgCount : formatIndex(S::data(), B, kPieceEnd, 0);
+  static constexpr bool kSimple = kPieceEnd == kEnd;
+
+  // for the fields following
+  static constexpr size_t kNext = kEnd == S::size() ? kEnd : kEnd + 1;
+  static constexpr size_t kArgCount =
+    kIndex + 1 > ArgCount ? kIndex + 1 : ArgCount;
+  static constexpr int kMode = kDefaultIndex ? 1 : 2;
+
+  template <class Values>
+  static size_t estimate(const Values& values) {
+    size_t n = estimateFormatted(std::get<kIndex>(values), 0);
+    if (!kSimple && arg().width > 0 && size_t(arg().width) > n) {
+      n = arg().width;
+    }
+    return n;
+  }
+
+  template <class Values, class Callback>
+  static void write(const Values& values, Callback& cb) {
+    write(std::get<kIndex>(values), cb,
+          std::integral_constant<bool, kSimple>());
+  }
+
+ private:
+  template <class T, class Callback>
+  static void write(const T& value, Callback& cb, std::true_type) {
+    formatSimple(value, cb);
+  }
+
+  template <class T, class Callback>
+  static void write(const T& value, Callback& cb, std::false_type) {
+    FormatArg a = arg();
+    FormatValue<typename std::decay<const T>::type>(value).format(a, cb);
+  }
+
+  static const FormatArg& arg() {
+    static const FormatArg proto = makeArg();
+    return proto;
+  }
+
+  static FormatArg makeArg() {
+    FormatArg a(StringPiece(S::data() + B, S::data() + kEnd));
+    a.splitKey<true>();
+    a.enforce(a.width != FormatArg::kDynamicWidth,
+              "dynamic field width not supported in compiled format strings");
+    return a;
+  }
+};
+
+template <class... Ops>
+struct FormatOps {
+  template <class Values>
+  static size_t estimate(const Values& values) {
+    size_t n = 0;
+    for (size_t k : {size_t(0), Ops::estimate(values)...}) {
+      n += k;
+    }
+    return n;
+  }
+
+  template <class Values, class Callback>
+  static void write(const Values& values, Callback& cb) {
+    int order[] = {0, (Ops::write(values, cb), 0)...};
+    (void)order;
+  }
+};
+
+template <class Ops, class Op> struct FormatOpsAppend;
+
+template <class... Ops, class Op>
+struct FormatOpsAppend<FormatOps<Ops...>, Op> {
+  typedef FormatOps<Ops..., Op> type;
+};
+
+/*
+ * Compile the format string S from Pos, the operations before being Ops.
+ * Mode is 0 before the first field, 1 if default indexes, 2 if explicit
+ * indexes. Gives the operations (type) and the number of arguments
+ * (kArgCount).
+ */
+template <class S, size_t Pos, size_t ArgCount, int Mode, class Ops,
+          int Token = formatToken(S::data(), Pos, S::size())>
+struct CompileFormat;
+
+template <class S, size_t Pos, size_t ArgCount, int Mode, class Ops>
+struct CompileFormat<S, Pos, ArgCount, Mode, Ops, kFormatEnd> {
+  typedef Ops type;
+  static constexpr size_t kArgCount = ArgCount;
+};
+
+template <class S, size_t Pos, size_t ArgCount, int Mode, class Ops>
+struct CompileFormat<S, Pos, ArgCount, Mode, Ops, kFormatLiteral>
+  : CompileFormat<
+      S, formatLiteralEnd(S::data(), Pos, S::size()), ArgCount, Mode,
+      typename FormatOpsAppend<
+        Ops,
+        FormatLiteralOp<S, Pos, formatLiteralEnd(S::data(), Pos, S::size())>
+      >::type> {};
+
+template <class S, size_t Pos, size_t ArgCount, int Mode, class Ops>
+struct CompileFormat<S, Pos, ArgCount, Mode, Ops, kFormatOpenBrace>
+  : CompileFormat<
+      S, Pos + 2, ArgCount, Mode,
+      typename FormatOpsAppend<Ops, FormatLiteralOp<S, Pos, Pos + 1>>::type> {
+};
+
+template <class S, size_t Pos, size_t ArgCount, int Mode, class Ops>
+struct CompileFormat<S, Pos, ArgCount, Mode, Ops, kFormatCloseBrace>
+  : CompileFormat<
+      S, Pos + 2, ArgCount, Mode,
+      typename FormatOpsAppend<Ops, FormatLiteralOp<S, Pos, Pos + 1>>::type> {
+};
+
+template <class S, size_t Pos, size_t ArgCount, int Mode, class Ops>
+struct CompileFormat<S, Pos, ArgCount, Mode, Ops, kFormatField>
+  : CompileFormat<
+      S,
+      FormatFieldOp<S, Pos + 1, ArgCount>::kNext,
+      FormatFieldOp<S, Pos + 1, ArgCount>::kArgCount,
+      FormatFieldOp<S, Pos + 1, ArgCount>::kMode,
+      typename FormatOpsAppend<
+        Ops, FormatFieldOp<S, Pos + 1, ArgCount>>::type> {
+  typedef FormatFieldOp<S, Pos + 1, ArgCount> Field;
+  static_assert(Field::kEnd != S::size(),
+                "folly::format: missing ending '}'");
+  static_assert(Field::kValidIndex,
+                "folly::format: argument index must be integer");
+  static_assert(Mode == 0 || Mode == Field::kMode,
+                "folly::format: may not have both default and explicit "
+                "arg indexes");
+};
+
+template <class S, size_t Pos, size_t ArgCount, int Mode, class Ops>
+struct CompileFormat<S, Pos, ArgCount, Mode, Ops, kFormatOpenAtEnd> {
+  static_assert(Pos != Pos, "folly::format: '{' at end of format string");
+};
+
+template <class S, size_t Pos, size_t ArgCount, int Mode, class Ops>
+struct CompileFormat<S, Pos, ArgCount, Mode, Ops, kFormatSingleClose> {
+  static_assert(Pos != Pos, "folly::format: single '}' in format string");
+};
+
+template <class T, class Enable = void>
+struct IsFormattable : std::false_type {};
+
+template <class T>
+struct IsFormattable<T, decltype(void(sizeof(FormatValue<T>)))>
+  : std::true_type {};
+
+template <class... Args> struct AllFormattable;
+
+template <>
+struct AllFormattable<> : std::true_type {};
+
+template <class T, class... Args>
+struct AllFormattable<T, Args...> : std::integral_constant<bool,
+  IsFormattable<typename std::decay<T>::type>::value &&
+  AllFormattable<Args...>::value> {};
+
+} // namespace detail
+
+/**
+ * Formatter of a compile-time format string. As Formatter, it keeps
+ * references to its arguments: use it through format() only.
+ */
+template <class S, class... Args>
+class CompiledFormatter {
+  typedef detail::CompileFormat<S, 0, 0, 0, detail::FormatOps<>> Compiled;
+  typedef typename Compiled::type Ops;
+
+  static_assert(Compiled::kArgCount <= sizeof...(Args),
+                "folly::format: not enough arguments for the format string");
+  static_assert(Compiled::kArgCount >= sizeof...(Args),
+                "folly::format: too many arguments for the format string");
+  static_assert(detail::AllFormattable<Args...>::value,
+                "folly::format: argument type without FormatValue");
+
+ public:
+  explicit CompiledFormatter(Args&&... args)
+    : values_(std::forward<Args>(args)...) {}
+
+  /**
+   * Append to output.  out(StringPiece sp) may be called (more than once)
+   */
+  template <class Output>
+  void operator()(Output& out) const {
+    Ops::write(values_, out);
+  }
+
+  /**
+   * Append to a string.
+   */
+  template <class Str>
+  typename std::enable_if<IsSomeString<Str>::value>::type
+  appendTo(Str& str) const {
+    size_t size = str.size() + Ops::estimate(values_);
+    if (size > str.capacity()) {
+      // growing geometrically, as appended to repeatedly
+      str.reserve(std::max(size, 2 * str.size()));
+    }
+    auto appender = [&str] (StringPiece s) { str.append(s.data(), s.size()); };
+    (*this)(appender);
+  }
+
+  /**
+   * Conversion to string
+   */
+  std::string str() const {
+    std::string s;
+    appendTo(s);
+    return s;
+  }
+
+  /**
+   * Conversion to fbstring
+   */
+  fbstring fbstr() const {
+    fbstring s;
+    appendTo(s);
+    return s;
+  }
+
+ private:
+  std::tuple<const typename std::remove_reference<Args>::type&...> values_;
+};
+
+/**
+ * Create a formatter object of a compile-time format string.
+ *
+ * std::string formatted = format(FOLLY_FMT("{} {}"), 23, 42).str();
+ */
+template <class S, class... Args>
+typename std::enable_if<detail::IsFormatString<S>::value,
+                        CompiledFormatter<S, Args...>>::type
+format(S, Args&&... args) {
+  return CompiledFormatter<S, Args...>(std::forward<Args>(args)...);
+}
+
+/**
+ * Like format(), but immediately returns the formatted string.
+ */
+template <class S, class... Args>
+inline typename std::enable_if<detail::IsFormatString<S>::value,
+                               std::string>::type
+sformat(S fmt, Args&&... args) {
+  return format(fmt, std::forward<Args>(args)...).str();
+}
+
+/**
+ * Append formatted output to a string.
+ *
+ * std::string foo;
+ * format(&foo, FOLLY_FMT("{} {}"), 42, 23);
+ */
+template <class Str, class S, class... Args>
+typename std::enable_if<IsSomeString<Str>::value &&
+                        detail::IsFormatString<S>::value>::type
+format(Str* out, S fmt, Args&&... args) {
+  format(fmt, std::forward<Args>(args)...).appendTo(*out);
+}
+
+/**
+ * CompiledFormatter objects can be written to streams, appended to
+ * strings, and formatted as strings.
+ */
+template <class S, class... Args>
+std::ostream& operator<<(std::ostream& out,
+                         const CompiledFormatter<S, Args...>& formatter) {
+  auto writer = [&out] (StringPiece sp) { out.write(sp.data(), sp.size()); };
+  formatter(writer);
+  return out;
+}
+
+template <class Tgt, class S, class... Args>
+typename std::enable_if<IsSomeString<Tgt>::value>::type toAppend(
+    const CompiledFormatter<S, Args...>& value, Tgt* result) {
+  value.appendTo(*result);
+}
+
+template <class S, class... Args>
+class FormatValue<CompiledFormatter<S, Args...>> {
+ public:
+  explicit FormatValue(const CompiledFormatter<S, Args...>& f) : f_(f) { }
+
+  template <class FormatCallback>
+  void format(FormatArg& arg, FormatCallback& cb) const {
+    if (arg.width == FormatArg::kDefaultWidth &&
+        arg.precision == FormatArg::kDefaultPrecision) {
+      arg.validate(FormatArg::Type::OTHER);
+      f_(cb);
+    } else {
+      format_value::formatString(f_.str(), arg, cb);
+    }
+  }
+
+ private:
+  const CompiledFormatter<S, Args...>& f_;
+};
+
+} // namespace folly
+
+#endif /* FOLLY_COMPILEDFORMAT_H_ */
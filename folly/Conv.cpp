@@ -16,6 +16,14 @@
 #define FOLLY_CONV_INTERNAL
 #include <folly/Conv.h>
 
+#include <cstring>
+
+#include <folly/detail/SimdDispatch.h>
+
+#if FOLLY_SIMD
+#include <immintrin.h>
+#endif
+
 namespace folly {
 namespace detail {
 
@@ -136,5 +144,469 @@ bool str_to_bool(StringPiece* src) {
   return result;
 }
 
+extern const uint64_t doublePow5Split[326][2];
+extern const uint64_t doublePow5InvSplit[342][2];
+
+namespace {
+
+/*
+ * The shortest digits of a double, as in Ryu (Ulf Adams, "Ryu: fast
+ * float-to-string conversion", PLDI 2018): the bounds of the interval of
+ * the decimals which round to the double are computed with 128-bit
+ * approximations of the powers of 5 (generated in build/DoubleTables.cpp),
+ * then digits are removed while the bounds differ.
+ */
+
+const int32_t kDoubleMantissaBits = 52;
+const int32_t kDoubleBias = 1023;
+const int32_t kPow5BitCount = 125;
+const int32_t kPow5InvBitCount = 125;
+
+// value = digits * 10^exponent
+struct DecimalDouble {
+  uint64_t digits;
+  int32_t exponent;
+};
+
+// Number of bits of 5^e, 1 for e = 0
+inline int32_t pow5bits(int32_t e) {
+  return int32_t((uint32_t(e) * 1217359) >> 19) + 1;
+}
+
+// floor(log10(2^e)) and floor(log10(5^e))
+inline uint32_t log10Pow2(int32_t e) {
+  return (uint32_t(e) * 78913) >> 18;
+}
+inline uint32_t log10Pow5(int32_t e) {
+  return (uint32_t(e) * 732923) >> 20;
+}
+
+inline bool multipleOfPowerOf5(uint64_t value, uint32_t p) {
+  uint32_t count = 0;
+  for (; value % 5 == 0; value /= 5) {
+    ++count;
+  }
+  return count >= p;
+}
+
+inline bool multipleOfPowerOf2(uint64_t value, uint32_t p) {
+  return (value & ((uint64_t(1) << p) - 1)) == 0;
+}
+
+// (m * mul) >> j, mul being 128-bit and j > 64
+inline uint64_t mulShift64(uint64_t m, const uint64_t* mul, int32_t j) {
+#if FOLLY_HAVE_INT128_T
+  unsigned __int128 b0 = static_cast<unsigned __int128>(m) * mul[0];
+  unsigned __int128 b2 = static_cast<unsigned __int128>(m) * mul[1];
+  return static_cast<uint64_t>(((b0 >> 64) + b2) >> (j - 64));
+#else
+  auto mul64 = [](uint64_t a, uint64_t b, uint64_t* high) {
+    uint64_t aLo = uint32_t(a), aHi = a >> 32;
+    uint64_t bLo = uint32_t(b), bHi = b >> 32;
+    uint64_t b00 = aLo * bLo, b01 = aLo * bHi;
+    uint64_t b10 = aHi * bLo, b11 = aHi * bHi;
+    uint64_t mid1 = b10 + (b00 >> 32);
+    uint64_t mid2 = b01 + uint32_t(mid1);
+    *high = b11 + (mid1 >> 32) + (mid2 >> 32);
+    return (mid2 << 32) | uint32_t(b00);
+  };
+  uint64_t high0, high1;
+  mul64(m, mul[0], &high0);
+  uint64_t low1 = mul64(m, mul[1], &high1);
+  uint64_t sum = high0 + low1;
+  high1 += sum < high0;
+  int32_t dist = j - 64;
+  return (high1 << (64 - dist)) | (sum >> dist);
+#endif
+}
+
+DecimalDouble shortestDecimal(uint64_t ieeeMantissa, uint32_t ieeeExponent) {
+  int32_t e2;
+  uint64_t m2;
+  if (ieeeExponent == 0) {
+    e2 = 1 - kDoubleBias - kDoubleMantissaBits - 2;
+    m2 = ieeeMantissa;
+  } else {
+    e2 = int32_t(ieeeExponent) - kDoubleBias - kDoubleMantissaBits - 2;
+    m2 = (uint64_t(1) << kDoubleMantissaBits) | ieeeMantissa;
+  }
+  // the bounds are included if the mantissa is even (round to even)
+  const bool acceptBounds = (m2 & 1) == 0;
+
+  // the double and the bounds, scaled by 4: mv, mv + 2 and mv - 1 or 2
+  const uint64_t mv = 4 * m2;
+  const uint32_t mmShift = ieeeMantissa != 0 || ieeeExponent <= 1;
+
+  // vr, vp, vm = the double and the bounds * 2^e2 / 10^e10
+  uint64_t vr, vp, vm;
+  int32_t e10;
+  bool vmIsTrailingZeros = false;
+  bool vrIsTrailingZeros = false;
+  if (e2 >= 0) {
+    const uint32_t q = log10Pow2(e2) - (e2 > 3);
+    e10 = int32_t(q);
+    const int32_t k = kPow5InvBitCount + pow5bits(int32_t(q)) - 1;
+    const int32_t i = -e2 + int32_t(q) + k;
+    const uint64_t* mul = doublePow5InvSplit[q];
+    vr = mulShift64(mv, mul, i);
+    vp = mulShift64(mv + 2, mul, i);
+    vm = mulShift64(mv - 1 - mmShift, mul, i);
+    if (q <= 21) {
+      // only one of mp, mv and mm can be a multiple of 5
+      if (mv % 5 == 0) {
+        vrIsTrailingZeros = multipleOfPowerOf5(mv, q);
+      } else if (acceptBounds) {
+        vmIsTrailingZeros = multipleOfPowerOf5(mv - 1 - mmShift, q);
+      } else {
+        vp -= multipleOfPowerOf5(mv + 2, q);
+      }
+    }
+  } else {
+    const uint32_t q = log10Pow5(-e2) - (-e2 > 1);
+    e10 = int32_t(q) + e2;
+    const int32_t i = -e2 - int32_t(q);
+    const int32_t k = pow5bits(i) - kPow5BitCount;
+    const int32_t j = int32_t(q) - k;
+    const uint64_t* mul = doublePow5Split[i];
+    vr = mulShift64(mv, mul, j);
+    vp = mulShift64(mv + 2, mul, j);
+    vm = mulShift64(mv - 1 - mmShift, mul, j);
+    if (q <= 1) {
+      // mv has at least q trailing zero bits
+      vrIsTrailingZeros = true;
+      if (acceptBounds) {
+        vmIsTrailingZeros = mmShift == 1;
+      } else {
+        --vp;
+      }
+    } else if (q < 63) {
+      vrIsTrailingZeros = multipleOfPowerOf2(mv, q);
+    }
+  }
+
+  // remove the digits while the bounds differ
+  int32_t removed = 0;
+  uint8_t lastRemovedDigit = 0;
+  uint64_t output;
+  if (vmIsTrailingZeros || vrIsTrailingZeros) {
+    while (vp / 10 > vm / 10) {
+      vmIsTrailingZeros &= vm % 10 == 0;
+      vrIsTrailingZeros &= lastRemovedDigit == 0;
+      lastRemovedDigit = uint8_t(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    if (vmIsTrailingZeros) {
+      while (vm % 10 == 0) {
+        vrIsTrailingZeros &= lastRemovedDigit == 0;
+        lastRemovedDigit = uint8_t(vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        ++removed;
+      }
+    }
+    if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+      lastRemovedDigit = 4;   // exactly halfway, round to even
+    }
+    output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) ||
+                   lastRemovedDigit >= 5);
+  } else {
+    // the common case, without trailing zeros
+    bool roundUp = false;
+    if (vp / 100 > vm / 100) {
+      roundUp = vr % 100 >= 50;
+      vr /= 100;
+      vp /= 100;
+      vm /= 100;
+      removed += 2;
+    }
+    while (vp / 10 > vm / 10) {
+      roundUp = vr % 10 >= 5;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    output = vr + (vr == vm || roundUp);
+  }
+  return DecimalDouble{output, e10 + removed};
+}
+
+// Integers in [1, 2^53), without the trailing zeros
+bool smallIntDecimal(uint64_t ieeeMantissa, uint32_t ieeeExponent,
+                     DecimalDouble* d) {
+  const int32_t e2 = int32_t(ieeeExponent) - kDoubleBias - kDoubleMantissaBits;
+  if (e2 > 0 || e2 < -kDoubleMantissaBits) {
+    return false;
+  }
+  const uint64_t m2 = (uint64_t(1) << kDoubleMantissaBits) | ieeeMantissa;
+  if ((m2 & ((uint64_t(1) << -e2) - 1)) != 0) {
+    return false;
+  }
+  d->digits = m2 >> -e2;
+  d->exponent = 0;
+  while (d->digits % 10 == 0) {
+    d->digits /= 10;
+    ++d->exponent;
+  }
+  return true;
+}
+
+} // namespace
+
+} // namespace detail
+
+uint32_t doubleToBufferUnsafe(double value, char* const buffer) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  const bool sign = bits >> 63;
+  const uint64_t ieeeMantissa =
+    bits & ((uint64_t(1) << detail::kDoubleMantissaBits) - 1);
+  const uint32_t ieeeExponent = (bits >> detail::kDoubleMantissaBits) & 0x7ff;
+
+  char* p = buffer;
+  if (ieeeExponent == 0x7ff) {
+    if (ieeeMantissa != 0) {
+      memcpy(p, "NaN", 3);
+      return 3;
+    }
+    if (sign) {
+      *p++ = '-';
+    }
+    memcpy(p, "Infinity", 8);
+    return p + 8 - buffer;
+  }
+  if (sign) {
+    *p++ = '-';
+  }
+  if (ieeeExponent == 0 && ieeeMantissa == 0) {
+    *p++ = '0';
+    return p - buffer;
+  }
+
+  detail::DecimalDouble d;
+  if (ieeeExponent == 0 ||
+      !detail::smallIntDecimal(ieeeMantissa, ieeeExponent, &d)) {
+    d = detail::shortestDecimal(ieeeMantissa, ieeeExponent);
+  }
+
+  // laid out as DoubleToStringConverter::ToShortest() does: the digits
+  // are written after one free char, for the decimal point to be inserted
+  const int32_t length = digits10(d.digits);
+  const int32_t decimalPoint = d.exponent + length;
+  const int32_t exponent = decimalPoint - 1;
+  if (exponent < detail::kConvMaxDecimalInShortestLow ||
+      exponent >= detail::kConvMaxDecimalInShortestHigh) {
+    // d.ddddE[-]x
+    uint64ToBufferUnsafe(d.digits, p + 1);
+    p[0] = p[1];
+    if (length > 1) {
+      p[1] = '.';
+      p += length + 1;
+    } else {
+      p += 1;
+    }
+    *p++ = 'E';
+    if (exponent < 0) {
+      *p++ = '-';
+    }
+    p += uint64ToBufferUnsafe(exponent < 0 ? -exponent : exponent, p);
+  } else if (decimalPoint <= 0) {
+    // 0.000dddd
+    *p++ = '0';
+    *p++ = '.';
+    memset(p, '0', -decimalPoint);
+    p += -decimalPoint;
+    p += uint64ToBufferUnsafe(d.digits, p);
+  } else if (decimalPoint >= length) {
+    // dddd000
+    p += uint64ToBufferUnsafe(d.digits, p);
+    memset(p, '0', decimalPoint - length);
+    p += decimalPoint - length;
+  } else {
+    // dd.dd
+    uint64ToBufferUnsafe(d.digits, p + 1);
+    memmove(p, p + 1, decimalPoint);
+    p[decimalPoint] = '.';
+    p += length + 1;
+  }
+  return p - buffer;
+}
+
+namespace detail {
+
+namespace {
+
+// Exactly representable as doubles
+const double kPowersOf10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+inline bool isDigit(char c) {
+  return static_cast<unsigned char>(c - '0') < 10;
+}
+
+} // namespace
+
+bool fastStringToDouble(StringPiece* src, double* result) {
+  const char* p = src->begin();
+  const char* e = src->end();
+  const bool negative = p != e && *p == '-';
+  p += negative;
+
+  // [-]digits[.digits][(e|E)[+|-]digits]
+  uint64_t mantissa = 0;
+  const char* start = p;
+  for (; p != e && isDigit(*p); ++p) {
+    mantissa = mantissa * 10 + (*p - '0');
+  }
+  const size_t intDigits = p - start;
+  if (intDigits == 0) {
+    return false;
+  }
+  size_t fracDigits = 0;
+  if (p != e && *p == '.') {
+    start = ++p;
+    for (; p != e && isDigit(*p); ++p) {
+      mantissa = mantissa * 10 + (*p - '0');
+    }
+    fracDigits = p - start;
+    if (fracDigits == 0) {
+      return false;
+    }
+  }
+  // at most 19 digits don't overflow
+  if (intDigits + fracDigits > 19) {
+    return false;
+  }
+  int32_t exponent = 0;
+  if (p != e && (*p == 'e' || *p == 'E')) {
+    ++p;
+    const bool negativeExponent = p != e && *p == '-';
+    p += p != e && (*p == '-' || *p == '+');
+    start = p;
+    for (; p != e && isDigit(*p) && p - start < 3; ++p) {
+      exponent = exponent * 10 + (*p - '0');
+    }
+    if (p == start || (p != e && isDigit(*p))) {
+      return false;
+    }
+    if (negativeExponent) {
+      exponent = -exponent;
+    }
+  }
+  exponent -= int32_t(fracDigits);
+
+  // both exact, so the result is correctly rounded
+  if (mantissa > (uint64_t(1) << 53) || exponent < -22 || exponent > 22) {
+    return false;
+  }
+  double value = double(mantissa);
+  if (exponent < 0) {
+    value /= kPowersOf10[-exponent];
+  } else {
+    value *= kPowersOf10[exponent];
+  }
+  *result = negative ? -value : value;
+  src->assign(p, e);
+  return true;
+}
+
+namespace {
+
+size_t scanIntegerCharsScalar(const char* p, size_t n, char delim,
+                              char minus, size_t* delims) {
+  size_t count = 0;
+  size_t i = 0;
+  for (; i < n; ++i) {
+    if (p[i] == delim) {
+      ++count;
+    } else if (static_cast<unsigned char>(p[i] - '0') > 9 && p[i] != minus) {
+      break;
+    }
+  }
+  *delims += count;
+  return i;
+}
+
+#if FOLLY_SIMD
+
+size_t scanIntegerCharsSse2(const char* p, size_t n, char delim,
+                            char minus, size_t* delims) {
+  const __m128i zero = _mm_set1_epi8('0');
+  const __m128i nine = _mm_set1_epi8(9);
+  const __m128i d = _mm_set1_epi8(delim);
+  const __m128i m = _mm_set1_epi8(minus);
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    __m128i t = _mm_sub_epi8(b, zero);
+    __m128i isDelim = _mm_cmpeq_epi8(b, d);
+    __m128i ok = _mm_or_si128(
+        _mm_cmpeq_epi8(_mm_min_epu8(t, nine), t),
+        _mm_or_si128(isDelim, _mm_cmpeq_epi8(b, m)));
+    uint32_t delimMask = _mm_movemask_epi8(isDelim);
+    uint32_t bad = ~_mm_movemask_epi8(ok) & 0xffff;
+    if (bad) {
+      uint32_t j = __builtin_ctz(bad);
+      *delims += count + __builtin_popcount(delimMask & ((1u << j) - 1));
+      return i + j;
+    }
+    count += __builtin_popcount(delimMask);
+  }
+  *delims += count;
+  return i + scanIntegerCharsScalar(p + i, n - i, delim, minus, delims);
+}
+
+__attribute__ ((__target__("avx2"), noinline))
+size_t scanIntegerCharsAvx2(const char* p, size_t n, char delim,
+                            char minus, size_t* delims) {
+  const __m256i zero = _mm256_set1_epi8('0');
+  const __m256i nine = _mm256_set1_epi8(9);
+  const __m256i d = _mm256_set1_epi8(delim);
+  const __m256i m = _mm256_set1_epi8(minus);
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    __m256i t = _mm256_sub_epi8(b, zero);
+    __m256i isDelim = _mm256_cmpeq_epi8(b, d);
+    __m256i ok = _mm256_or_si256(
+        _mm256_cmpeq_epi8(_mm256_min_epu8(t, nine), t),
+        _mm256_or_si256(isDelim, _mm256_cmpeq_epi8(b, m)));
+    uint32_t delimMask = _mm256_movemask_epi8(isDelim);
+    uint32_t bad = ~uint32_t(_mm256_movemask_epi8(ok));
+    if (bad) {
+      uint32_t j = __builtin_ctz(bad);
+      *delims += count + __builtin_popcount(delimMask & ((1u << j) - 1));
+      return i + j;
+    }
+    count += __builtin_popcount(delimMask);
+  }
+  *delims += count;
+  return i + scanIntegerCharsScalar(p + i, n - i, delim, minus, delims);
+}
+
+#endif // FOLLY_SIMD
+
+} // namespace
+
+const char* scanIntegerChars(const char* b, const char* e, char delim,
+                             char minus, size_t* delims) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE2, scanIntegerChars, Sse2);
+  return b + fn(b, e - b, delim, minus, delims);
+}
+
+void throwIntegersError(size_t index, StringPiece value, StringPiece what) {
+  throw std::range_error(to<std::string>(
+      "Batch conversion to integral: ", what, " in value ", index,
+      ": \"", value, "\""));
+}
+
 } // namespace detail
 } // namespace folly
@@ -623,6 +623,29 @@ constexpr int kConvMaxDecimalInShortestLow = -6;
 constexpr int kConvMaxDecimalInShortestHigh = 21;
 } // folly::detail
 
+/**
+ * Upper bound of the length of the output of doubleToBufferUnsafe(). At
+ * most 17 digits are needed; with the sign, the longest output is e.g.
+ * -0.0000011111111111111111 if kConvMaxDecimalInShortestLow is -6, longer
+ * than -1.1111111111111111E-100 and than the 21 digits before 1E21 if
+ * kConvMaxDecimalInShortestHigh is 21.
+ */
+constexpr uint32_t kMaxDoubleToBufferLength =
+  1 + 2 - detail::kConvMaxDecimalInShortestLow - 1 + 17;
+
+/**
+ * Copies the shortest ASCII representation of value which converts back
+ * to value into buffer and returns the number of bytes written. Does NOT
+ * append a \0. Assumes the buffer points to kMaxDoubleToBufferLength
+ * bytes of valid memory.
+ *
+ * The output is the one of DoubleToStringConverter::ToShortest() with the
+ * settings of toAppend(double, string*), e.g. 0.1, 1E21, 1E-7, -0,
+ * Infinity or NaN, but the digits are found with the Ryu algorithm, which
+ * needs no big integers, straight into the buffer.
+ */
+uint32_t doubleToBufferUnsafe(double value, char* const buffer);
+
 /** Wrapper around DoubleToStringConverter **/
 template <class Tgt, class Src>
 typename std::enable_if<
@@ -668,36 +691,19 @@ typename std::enable_if<
   std::is_floating_point<Src>::value
   && IsSomeString<Tgt>::value>::type
 toAppend(Src value, Tgt * result) {
-  toAppend(
-    value, result, double_conversion::DoubleToStringConverter::SHORTEST, 0);
+  char buffer[kMaxDoubleToBufferLength];
+  result->append(buffer, doubleToBufferUnsafe(value, buffer));
 }
 
 /**
- * Upper bound of the length of the output from
- * DoubleToStringConverter::ToShortest(double, StringBuilder*),
+ * Upper bound of the length of the output of doubleToBufferUnsafe(),
  * as used in toAppend(double, string*).
  */
 template <class Src>
 typename std::enable_if<
   std::is_floating_point<Src>::value, size_t>::type
 estimateSpaceNeeded(Src value) {
-  // kBase10MaximalLength is 17. We add 1 for decimal point,
-  // e.g. 10.0/9 is 17 digits and 18 characters, including the decimal point.
-  constexpr int kMaxMantissaSpace =
-    double_conversion::DoubleToStringConverter::kBase10MaximalLength + 1;
-  // strlen("E-") + digits10(numeric_limits<double>::max_exponent10)
-  constexpr int kMaxExponentSpace = 2 + 3;
-  static const int kMaxPositiveSpace = std::max({
-      // E.g. 1.1111111111111111E-100.
-      kMaxMantissaSpace + kMaxExponentSpace,
-      // E.g. 0.000001.1111111111111111, if kConvMaxDecimalInShortestLow is -6.
-      kMaxMantissaSpace - detail::kConvMaxDecimalInShortestLow,
-      // If kConvMaxDecimalInShortestHigh is 21, then 1e21 is the smallest
-      // number > 1 which ToShortest outputs in exponential notation,
-      // so 21 is the longest non-exponential number > 1.
-      detail::kConvMaxDecimalInShortestHigh
-    });
-  return kMaxPositiveSpace + (value < 0);  // +1 for minus sign, if negative
+  return kMaxDoubleToBufferLength - (value >= 0);  // minus sign if negative
 }
 
 /**
@@ -1327,10 +1333,178 @@ to(StringPiece src) {
   return result;
 }
 
+/*******************************************************************************
+ * Batch conversions between arrays of integers and delimited strings.
+ ******************************************************************************/
+
+namespace detail {
+
+template <class T>
+struct IsBatchInteger : std::integral_constant<bool,
+  std::is_integral<T>::value &&
+  !std::is_same<typename std::remove_cv<T>::type, bool>::value &&
+  !std::is_same<typename std::remove_cv<T>::type, char>::value &&
+  sizeof(T) <= sizeof(uint64_t)> {};
+
+/**
+ * Finds the first character of [b, e) which is neither a digit, delim
+ * nor minus (a digit if no sign is allowed), and adds the number of
+ * delims before it to *delims. Checks 16 or 32 characters at a time when
+ * SIMD is available.
+ */
+const char* scanIntegerChars(const char* b, const char* e, char delim,
+                             char minus, size_t* delims);
+
+FOLLY_NORETURN void throwIntegersError(size_t index, StringPiece value,
+                                       StringPiece what);
+
+} // namespace detail
+
+/**
+ * Upper bound of the length of the output of integersToBufferUnsafe() for
+ * n values of type Src: the digits, the sign and the delimiter of each.
+ */
+template <class Src>
+constexpr size_t maxIntegersToBufferLength(size_t n) {
+  return n * (std::numeric_limits<Src>::digits10 + 3);
+}
+
+/**
+ * Copies the ASCII base 10 representations of the n values, separated
+ * by delim, into buffer and returns the number of bytes written. Does NOT
+ * append a \0. Assumes the buffer points to maxIntegersToBufferLength(n)
+ * bytes of valid memory.
+ */
+template <class Src>
+typename std::enable_if<detail::IsBatchInteger<Src>::value, size_t>::type
+integersToBufferUnsafe(const Src* values, size_t n, char delim,
+                       char* const buffer) {
+  if (n == 0) {
+    return 0;
+  }
+  char* p = buffer;
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t u = values[i];
+    if (is_negative(values[i])) {
+      *p++ = '-';
+      u = -u;
+    }
+    p += uint64ToBufferUnsafe(u, p);
+    *p++ = delim;
+  }
+  return p - buffer - 1;
+}
+
+/**
+ * Appends the values, separated by delim, to result, which grows once
+ * for the whole batch.
+ *
+ *   std::vector<int64_t> column = ...;
+ *   toAppendIntegers('\t', range(column), &line);
+ */
+template <class Tgt, class Src>
+typename std::enable_if<
+  IsSomeString<Tgt>::value && detail::IsBatchInteger<Src>::value>::type
+toAppendIntegers(char delim, Range<Src*> values, Tgt* result) {
+  typedef typename std::remove_cv<Src>::type Int;
+  const size_t size = result->size();
+  result->resize(size + maxIntegersToBufferLength<Int>(values.size()));
+  result->resize(size + integersToBufferUnsafe<Int>(
+      values.data(), values.size(), delim, &(*result)[0] + size));
+}
+
+/**
+ * Parses the integers of src, separated by delim, and appends them to
+ * result (a vector of integers), which grows once for the whole batch.
+ * Returns the number of integers parsed.
+ *
+ * Each integer is [-]digits, the sign for signed types only, without
+ * spaces; src may end with a delim. The characters of src are all
+ * validated in one pass before parsing, the integers are then parsed
+ * without per-character checks. An error throws one std::range_error for
+ * the batch, naming the index of the bad integer, and leaves result
+ * unchanged.
+ *
+ *   std::vector<uint32_t> ids;
+ *   toIntegers("12\n7\n42\n", '\n', &ids);
+ */
+template <class Container>
+typename std::enable_if<
+  detail::IsBatchInteger<typename Container::value_type>::value,
+  size_t>::type
+toIntegers(StringPiece src, char delim, Container* result) {
+  typedef typename Container::value_type Tgt;
+  typedef typename std::make_unsigned<Tgt>::type UTgt;
+  const bool isSigned = std::is_signed<Tgt>::value;
+  const char* b = src.begin();
+  const char* e = src.end();
+  if (b == e) {
+    return 0;
+  }
+
+  size_t count = 0;
+  const char* bad = detail::scanIntegerChars(
+      b, e, delim, isSigned ? '-' : '0', &count);
+  if (UNLIKELY(bad != e)) {
+    const char* vb = bad;
+    while (vb != b && vb[-1] != delim) {
+      --vb;
+    }
+    detail::throwIntegersError(
+        count, StringPiece(vb, std::find(bad, e, delim)),
+        "Non-digit character found");
+  }
+  if (e[-1] != delim) {
+    ++count;
+  }
+
+  const size_t size = result->size();
+  result->resize(size + count);
+  auto out = result->begin() + size;
+  const char* p = b;
+  for (size_t i = 0; i < count; ++i, ++out) {
+    const char* q = p;
+    bool negative = isSigned && *q == '-';
+    q += negative;
+    const char* digits = q;
+    UTgt value = 0;
+    unsigned seen = 0;    // more than 15 if a misplaced sign
+    for (; q != e && *q != delim; ++q) {
+      unsigned d = static_cast<unsigned char>(*q - '0');
+      seen |= d;
+      value = value * 10 + d;
+    }
+    // fewer digits than digits10 cannot overflow
+    if (LIKELY(q != digits && seen < 16 &&
+               q - digits <= std::numeric_limits<Tgt>::digits10)) {
+      *out = negative ? Tgt(-value) : Tgt(value);
+    } else {
+      try {
+        *out = to<Tgt>(StringPiece(p, q));
+      } catch (const std::range_error& ex) {
+        result->resize(size);
+        detail::throwIntegersError(i, StringPiece(p, q), ex.what());
+      }
+    }
+    p = q + 1;
+  }
+  return count;
+}
+
 /*******************************************************************************
  * Conversions from string types to floating-point types.
  ******************************************************************************/
 
+namespace detail {
+/**
+ * Parses the short decimals ([-]digits[.digits][e[-]digits], at most 19
+ * digits and a power of 10 at most 22 once the point is removed) which
+ * convert exactly with one multiplication or division, as most of the
+ * numbers written by programs. Returns false for the others.
+ */
+bool fastStringToDouble(StringPiece* src, double* result);
+} // namespace detail
+
 /**
  * StringPiece to double, with progress information. Alters the
  * StringPiece parameter to munch the already-parsed characters.
@@ -1352,6 +1526,11 @@ to(StringPiece *const src) {
   FOLLY_RANGE_CHECK_STRINGPIECE(!src->empty(),
                                 "No digits found in input string", *src);
 
+  double fast;
+  if (detail::fastStringToDouble(src, &fast)) {
+    return fast;
+  }
+
   int length;
   auto result = conv.StringToDouble(src->data(),
                                     static_cast<int>(src->size()),
@@ -0,0 +1,406 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/FrozenDynamic.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <folly/Conv.h>
+#include <folly/JsonReader.h>
+
+namespace folly {
+
+//////////////////////////////////////////////////////////////////////
+
+void FrozenValue::checkType(Type type, const char* expected) const {
+  if (type_ != type) {
+    throw TypeError(expected, this->type());
+  }
+}
+
+double FrozenValue::getDouble() const {
+  checkType(dynamic::DOUBLE, "double");
+  return u_.doubl;
+}
+
+int64_t FrozenValue::getInt() const {
+  checkType(dynamic::INT64, "int64");
+  return u_.integer;
+}
+
+bool FrozenValue::getBool() const {
+  checkType(dynamic::BOOL, "bool");
+  return u_.boolean;
+}
+
+const char* FrozenValue::data() const {
+  checkType(dynamic::STRING, "string");
+  return u_.string;
+}
+
+StringPiece FrozenValue::stringPiece() const {
+  checkType(dynamic::STRING, "string");
+  return StringPiece(u_.string, size_);
+}
+
+#if FOLLY_DYNAMIC_EXTEND_DATA
+ByteRange FrozenValue::byteRange() const {
+  checkType(dynamic::DATA, "data");
+  return ByteRange(reinterpret_cast<const unsigned char*>(u_.string), size_);
+}
+#endif
+
+size_t FrozenValue::size() const {
+  switch (type_) {
+    case dynamic::ARRAY:
+    case dynamic::OBJECT:
+    case dynamic::STRING:
+#if FOLLY_DYNAMIC_EXTEND_DATA
+    case dynamic::DATA:
+#endif
+      return size_;
+    default:
+      throw TypeError("array/object", type());
+  }
+}
+
+bool FrozenValue::empty() const {
+  return isNull() || size() == 0;
+}
+
+FrozenValue::const_iterator FrozenValue::begin() const {
+  checkType(dynamic::ARRAY, "array");
+  return u_.array;
+}
+
+FrozenValue::const_iterator FrozenValue::end() const {
+  checkType(dynamic::ARRAY, "array");
+  return u_.array + size_;
+}
+
+Range<const FrozenValue::Item*> FrozenValue::items() const {
+  checkType(dynamic::OBJECT, "object");
+  return Range<const Item*>(u_.object, size_);
+}
+
+const FrozenValue* FrozenValue::get_ptr(size_t idx) const {
+  checkType(dynamic::ARRAY, "array");
+  return idx < size_ ? u_.array + idx : nullptr;
+}
+
+const FrozenValue* FrozenValue::get_ptr(StringPiece key) const {
+  checkType(dynamic::OBJECT, "object");
+  auto it = std::lower_bound(
+      u_.object, u_.object + size_, key,
+      [](const Item& item, StringPiece k) {
+        return item.first.stringPiece() < k;
+      });
+  if (it != u_.object + size_ && it->first.stringPiece() == key) {
+    return &it->second;
+  }
+  return nullptr;
+}
+
+const FrozenValue& FrozenValue::at(size_t idx) const {
+  auto p = get_ptr(idx);
+  if (!p) {
+    throw std::out_of_range("out of range in FrozenValue array");
+  }
+  return *p;
+}
+
+const FrozenValue& FrozenValue::at(StringPiece key) const {
+  auto p = get_ptr(key);
+  if (!p) {
+    throw std::out_of_range(to<std::string>(
+        "couldn't find key ", key, " in FrozenValue object"));
+  }
+  return *p;
+}
+
+dynamic FrozenValue::thaw() const {
+  switch (type_) {
+    case dynamic::NULLT:
+      return nullptr;
+    case dynamic::ARRAY: {
+      dynamic array = {};
+      for (auto& value : *this) {
+        array.push_back(value.thaw());
+      }
+      return array;
+    }
+    case dynamic::BOOL:
+      return u_.boolean;
+    case dynamic::DOUBLE:
+      return u_.doubl;
+    case dynamic::INT64:
+      return u_.integer;
+    case dynamic::OBJECT: {
+      dynamic object = dynamic::object;
+      for (auto& item : items()) {
+        object.insert(item.first.stringPiece(), item.second.thaw());
+      }
+      return object;
+    }
+    case dynamic::STRING:
+      return stringPiece();
+#if FOLLY_DYNAMIC_EXTEND_DATA
+    case dynamic::DATA:
+      return byteRange();
+#endif
+  }
+  throw TypeError("valid type", type());
+}
+
+bool FrozenValue::operator==(const FrozenValue& other) const {
+  if (type_ != other.type_) {
+    // as dynamic, compare ints and doubles as numbers
+    if (isNumber() && other.isNumber()) {
+      return (isInt() ? double(u_.integer) : u_.doubl) ==
+        (other.isInt() ? double(other.u_.integer) : other.u_.doubl);
+    }
+    return false;
+  }
+  switch (type_) {
+    case dynamic::NULLT:
+      return true;
+    case dynamic::BOOL:
+      return u_.boolean == other.u_.boolean;
+    case dynamic::DOUBLE:
+      return u_.doubl == other.u_.doubl;
+    case dynamic::INT64:
+      return u_.integer == other.u_.integer;
+    case dynamic::ARRAY:
+      return size_ == other.size_ &&
+        std::equal(begin(), end(), other.begin());
+    case dynamic::OBJECT:
+      if (size_ != other.size_) {
+        return false;
+      }
+      for (uint32_t i = 0; i < size_; ++i) {
+        if (u_.object[i].first != other.u_.object[i].first ||
+            u_.object[i].second != other.u_.object[i].second) {
+          return false;
+        }
+      }
+      return true;
+    default:
+      return size_ == other.size_ &&
+        memcmp(u_.string, other.u_.string, size_) == 0;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+/*
+ * Builds the values in the arena. The elements of arrays and the items
+ * of objects are gathered in vectors, and copied to the arena when
+ * complete.
+ */
+class FrozenDynamic::Builder {
+public:
+  typedef FrozenValue::Item Item;
+
+  explicit Builder(SysArena& arena) : arena_(arena) {}
+
+  FrozenValue scalar(dynamic::Type type) {
+    FrozenValue value;
+    value.type_ = type;
+    return value;
+  }
+
+  FrozenValue string(StringPiece str, dynamic::Type type = dynamic::STRING) {
+    FrozenValue value = scalar(type);
+    value.size_ = checkSize(str.size());
+    char* p = static_cast<char*>(arena_.allocate(str.size() + 1));
+    memcpy(p, str.data(), str.size());
+    p[str.size()] = '\0';
+    value.u_.string = p;
+    return value;
+  }
+
+  FrozenValue array(const FrozenValue* values, size_t n) {
+    FrozenValue value = scalar(dynamic::ARRAY);
+    value.size_ = checkSize(n);
+    value.u_.array = copy(values, n);
+    return value;
+  }
+
+  // Sorts the items; of the same keys, keeps the last one as parseJson()
+  FrozenValue object(Item* items, size_t n) {
+    std::stable_sort(items, items + n, [](const Item& a, const Item& b) {
+      return a.first.stringPiece() < b.first.stringPiece();
+    });
+    size_t m = 0;
+    for (size_t i = 0; i < n; ++i) {
+      if (i + 1 < n &&
+          items[i].first.stringPiece() == items[i + 1].first.stringPiece()) {
+        continue;
+      }
+      items[m++] = items[i];
+    }
+    FrozenValue value = scalar(dynamic::OBJECT);
+    value.size_ = checkSize(m);
+    value.u_.object = copy(items, m);
+    return value;
+  }
+
+  const FrozenValue* root(const FrozenValue& value) {
+    return copy(&value, 1);
+  }
+
+  FrozenValue freeze(const dynamic& d) {
+    FrozenValue value = scalar(d.type());
+    switch (d.type()) {
+      case dynamic::NULLT:
+        break;
+      case dynamic::ARRAY: {
+        std::vector<FrozenValue> values;
+        values.reserve(d.size());
+        for (auto& element : d) {
+          values.push_back(freeze(element));
+        }
+        return array(values.data(), values.size());
+      }
+      case dynamic::BOOL:
+        value.u_.boolean = d.getBool();
+        break;
+      case dynamic::DOUBLE:
+        value.u_.doubl = d.getDouble();
+        break;
+      case dynamic::INT64:
+        value.u_.integer = d.getInt();
+        break;
+      case dynamic::OBJECT: {
+        std::vector<Item> items;
+        items.reserve(d.size());
+        for (auto& item : d.items()) {
+          if (!item.first.isString()) {
+            throw TypeError("string", item.first.type());
+          }
+          items.push_back(Item{string(item.first.stringPiece()),
+                               freeze(item.second)});
+        }
+        return object(items.data(), items.size());
+      }
+      case dynamic::STRING:
+        return string(d.stringPiece());
+#if FOLLY_DYNAMIC_EXTEND_DATA
+      case dynamic::DATA:
+        return string(StringPiece(d.byteRange()), dynamic::DATA);
+#endif
+    }
+    return value;
+  }
+
+private:
+  static uint32_t checkSize(size_t n) {
+    if (n > std::numeric_limits<uint32_t>::max()) {
+      throw std::length_error("FrozenDynamic value too large");
+    }
+    return n;
+  }
+
+  template <class T>
+  const T* copy(const T* values, size_t n) {
+    T* p = static_cast<T*>(arena_.allocate(n * sizeof(T)));
+    std::copy(values, values + n, p);
+    return p;
+  }
+
+  SysArena& arena_;
+};
+
+FrozenDynamic::FrozenDynamic(const dynamic& value) : FrozenDynamic() {
+  Builder builder(*arena_);
+  root_ = builder.root(builder.freeze(value));
+}
+
+FrozenDynamic FrozenDynamic::fromJson(
+    StringPiece json,
+    const json::serialization_opts& opts) {
+  json::serialization_opts options = opts;
+  options.allow_non_string_keys = false;
+  JsonReader reader(options);
+  reader.feed(json);
+  reader.finish();
+
+  FrozenDynamic frozen;
+  Builder builder(*frozen.arena_);
+  // the values of the arrays and objects not complete (keys and values
+  // alternating for objects), and where each of them starts
+  std::vector<FrozenValue> stack;
+  std::vector<size_t> starts;
+  std::vector<FrozenValue::Item> items;
+
+  for (;;) {
+    FrozenValue value;
+    switch (reader.next()) {
+      case JsonReader::NEED_INPUT:
+      case JsonReader::END:
+        frozen.root_ = builder.root(stack.back());
+        return frozen;
+      case JsonReader::START_OBJECT:
+      case JsonReader::START_ARRAY:
+        starts.push_back(stack.size());
+        continue;
+      case JsonReader::END_ARRAY: {
+        size_t start = starts.back();
+        starts.pop_back();
+        value = builder.array(stack.data() + start, stack.size() - start);
+        stack.resize(start);
+        break;
+      }
+      case JsonReader::END_OBJECT: {
+        size_t start = starts.back();
+        starts.pop_back();
+        items.clear();
+        for (size_t i = start; i < stack.size(); i += 2) {
+          items.push_back(FrozenValue::Item{stack[i], stack[i + 1]});
+        }
+        value = builder.object(items.data(), items.size());
+        stack.resize(start);
+        break;
+      }
+      case JsonReader::KEY:
+      case JsonReader::STRING:
+        value = builder.string(reader.str());
+        break;
+      case JsonReader::INT:
+        value = builder.scalar(dynamic::INT64);
+        value.u_.integer = reader.getInt();
+        break;
+      case JsonReader::DOUBLE:
+        value = builder.scalar(dynamic::DOUBLE);
+        value.u_.doubl = reader.getDouble();
+        break;
+      case JsonReader::BOOL:
+        value = builder.scalar(dynamic::BOOL);
+        value.u_.boolean = reader.getBool();
+        break;
+      case JsonReader::NULLT:
+        value = builder.scalar(dynamic::NULLT);
+        break;
+    }
+    stack.push_back(value);
+  }
+}
+
+} // namespace folly
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * An immutable representation of a dynamic, for documents which are
+ * read many times once parsed.
+ *
+ * All the values of a FrozenDynamic, their strings and the items of their
+ * objects live in the blocks of a SysArena: building one makes a few
+ * large allocations instead of one per value, and destroying it frees
+ * these blocks only. Objects are arrays of items sorted by key, looked up
+ * by binary search.
+ *
+ *   auto config = FrozenDynamic::fromJson(text);
+ *   if (auto* port = config->get_ptr("port")) {
+ *     listen(port->getInt());
+ *   }
+ *   for (auto& item : config->at("servers").items()) {
+ *     addServer(item.first.stringPiece(), item.second.thaw());
+ *   }
+ *
+ * The keys of objects must be strings (TypeError otherwise).
+ */
+
+#ifndef FOLLY_FROZENDYNAMIC_H_
+#define FOLLY_FROZENDYNAMIC_H_
+
+#include <cstdint>
+#include <memory>
+
+#include <folly/Arena.h>
+#include <folly/Range.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+
+namespace folly {
+
+class FrozenDynamic;
+
+/**
+ * A value of a FrozenDynamic, valid as long as it.
+ */
+class FrozenValue {
+public:
+  struct Item;
+
+  typedef dynamic::Type Type;
+  typedef const FrozenValue* const_iterator;
+
+  /**
+   * A null value.
+   */
+  FrozenValue() : type_(dynamic::NULLT), size_(0) { u_.integer = 0; }
+
+  Type type() const { return Type(type_); }
+
+  bool isNull() const { return type_ == dynamic::NULLT; }
+  bool isArray() const { return type_ == dynamic::ARRAY; }
+  bool isBool() const { return type_ == dynamic::BOOL; }
+  bool isDouble() const { return type_ == dynamic::DOUBLE; }
+  bool isInt() const { return type_ == dynamic::INT64; }
+  bool isObject() const { return type_ == dynamic::OBJECT; }
+  bool isString() const { return type_ == dynamic::STRING; }
+  bool isNumber() const { return isInt() || isDouble(); }
+
+  /*
+   * These throw TypeError if the value has a different type, as the ones
+   * of dynamic.
+   */
+  double getDouble() const;
+  int64_t getInt() const;
+  bool getBool() const;
+
+  /*
+   * The strings are NUL-terminated. Throw TypeError if the value is not a
+   * string.
+   */
+  const char* data() const;
+  const char* c_str() const { return data(); }
+  StringPiece stringPiece() const;
+
+#if FOLLY_DYNAMIC_EXTEND_DATA
+  ByteRange byteRange() const;
+#endif
+
+  /*
+   * Number of characters, elements or items of a string, array or object,
+   * TypeError for the other types.
+   */
+  size_t size() const;
+
+  /*
+   * True if null, or an empty string, array or object.
+   */
+  bool empty() const;
+
+  /*
+   * Elements of an array, TypeError for the other types.
+   */
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  /*
+   * Items of an object, sorted by key. TypeError for the other types.
+   */
+  Range<const Item*> items() const;
+
+  /*
+   * Element of an array, or value of an object for a key. TypeError if
+   * the type is not the one indexed, std::out_of_range if there is no
+   * such element.
+   */
+  const FrozenValue& at(size_t idx) const;
+  const FrozenValue& at(StringPiece key) const;
+  const FrozenValue& operator[](size_t idx) const { return at(idx); }
+  const FrozenValue& operator[](StringPiece key) const { return at(key); }
+
+  /*
+   * As at(), but nullptr if there is no such element.
+   */
+  const FrozenValue* get_ptr(size_t idx) const;
+  const FrozenValue* get_ptr(StringPiece key) const;
+
+  size_t count(StringPiece key) const { return get_ptr(key) ? 1 : 0; }
+
+  /*
+   * A mutable copy.
+   */
+  dynamic thaw() const;
+
+  bool operator==(const FrozenValue& other) const;
+  bool operator!=(const FrozenValue& other) const { return !(*this == other); }
+
+private:
+  friend class FrozenDynamic;
+
+  void checkType(Type type, const char* expected) const;
+
+  uint8_t type_;
+  uint32_t size_;   // of strings, arrays and objects
+  union {
+    bool boolean;
+    int64_t integer;
+    double doubl;
+    const char* string;
+    const FrozenValue* array;
+    const Item* object;
+  } u_;
+};
+
+struct FrozenValue::Item {
+  FrozenValue first;    // the key, a string
+  FrozenValue second;
+};
+
+class FrozenDynamic {
+public:
+  /**
+   * Freeze a copy of value.
+   */
+  explicit FrozenDynamic(const dynamic& value);
+
+  /**
+   * Parse json into a FrozenDynamic without building a dynamic (the
+   * grammar is the one of parseJson()).
+   */
+  static FrozenDynamic fromJson(
+      StringPiece json,
+      const json::serialization_opts& opts = json::serialization_opts());
+
+  FrozenDynamic(FrozenDynamic&&) = default;
+  FrozenDynamic& operator=(FrozenDynamic&&) = default;
+
+  FrozenDynamic(const FrozenDynamic&) = delete;
+  FrozenDynamic& operator=(const FrozenDynamic&) = delete;
+
+  const FrozenValue& root() const { return *root_; }
+  const FrozenValue& operator*() const { return *root_; }
+  const FrozenValue* operator->() const { return root_; }
+
+  dynamic thaw() const { return root_->thaw(); }
+
+  /**
+   * Memory used by the arena.
+   */
+  size_t totalSize() const { return arena_->totalSize(); }
+
+private:
+  class Builder;
+
+  FrozenDynamic() : arena_(new SysArena) {}
+
+  std::unique_ptr<SysArena> arena_;   // stays in place when moved
+  const FrozenValue* root_;
+};
+
+} // namespace folly
+
+#endif /* FOLLY_FROZENDYNAMIC_H_ */
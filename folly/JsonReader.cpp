@@ -0,0 +1,491 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/JsonReader.h>
+
+#include <limits>
+#include <stdexcept>
+
+#include <folly/Conv.h>
+#include <folly/detail/JsonParser.h>
+
+namespace folly {
+
+namespace {
+
+inline bool isScalarChar(char c) {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+         (c >= 'A' && c <= 'Z') || c == '-' || c == '+' || c == '.';
+}
+
+inline bool isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+bool isValidUtf8(StringPiece sp) {
+  auto p = reinterpret_cast<const uint8_t*>(sp.begin());
+  auto e = reinterpret_cast<const uint8_t*>(sp.end());
+  while (p != e) {
+    uint32_t c = *p;
+    if (c < 0x80) {
+      ++p;
+      continue;
+    }
+    size_t n;
+    uint32_t min;
+    if ((c & 0xe0) == 0xc0) {
+      n = 1, c &= 0x1f, min = 0x80;
+    } else if ((c & 0xf0) == 0xe0) {
+      n = 2, c &= 0x0f, min = 0x800;
+    } else if ((c & 0xf8) == 0xf0) {
+      n = 3, c &= 0x07, min = 0x10000;
+    } else {
+      return false;
+    }
+    if (size_t(e - p) <= n) {
+      return false;
+    }
+    for (size_t i = 1; i <= n; ++i) {
+      if ((p[i] & 0xc0) != 0x80) {
+        return false;
+      }
+      c = (c << 6) | (p[i] & 0x3f);
+    }
+    if (c < min || c > 0x10ffff || (c >= 0xd800 && c <= 0xdfff)) {
+      return false;
+    }
+    p += n + 1;
+  }
+  return true;
+}
+
+} // namespace anon
+
+JsonReader::JsonReader(const json::serialization_opts& opts)
+  : opts_(opts) {
+}
+
+void JsonReader::feed(StringPiece chunk) {
+  if (!chunk.empty()) {
+    chunks_.push_back(chunk);
+  }
+}
+
+void JsonReader::feed(std::unique_ptr<IOBuf> buf) {
+  if (!buf) {
+    return;
+  }
+  for (auto data : *buf) {
+    feed(StringPiece(data));
+  }
+  bufs_.push_back(std::move(buf));
+}
+
+void JsonReader::finish() {
+  final_ = true;
+}
+
+JsonReader::Event JsonReader::next() {
+  for (;;) {
+    if (!nextToken()) {
+      // all the chunks are consumed (but a partial token, copied)
+      bufs_.clear();
+      return event_ = NEED_INPUT;
+    }
+    if (!step()) {
+      continue;
+    }
+    if (skipping_) {
+      if (stack_.size() == skipDepth_ && event_ != KEY &&
+          event_ != START_OBJECT && event_ != START_ARRAY) {
+        skipping_ = false;
+      }
+      continue;
+    }
+    return event_;
+  }
+}
+
+void JsonReader::skip() {
+  switch (event_) {
+    case KEY:
+      skipDepth_ = stack_.size();
+      skipping_ = true;
+      break;
+    case START_OBJECT:
+    case START_ARRAY:
+      skipDepth_ = stack_.size() - 1;
+      skipping_ = true;
+      break;
+    default:
+      break;
+  }
+}
+
+bool JsonReader::nextChunk() {
+  if (chunks_.empty()) {
+    return false;
+  }
+  p_ = chunks_.front().begin();
+  end_ = chunks_.front().end();
+  chunks_.pop_front();
+  return true;
+}
+
+bool JsonReader::nextToken() {
+  if (partial_) {
+    // continue the token in the following chunks
+    for (;;) {
+      if (!nextChunk()) {
+        if (!final_) {
+          return false;
+        }
+        if (token_ == TOKEN_STRING) {
+          error("unterminated string");
+        }
+        raw_ = carry_;
+        partial_ = false;
+        return true;
+      }
+      start_ = p_;
+      if (token_ == TOKEN_STRING ? scanString() : scanScalar()) {
+        return true;
+      }
+    }
+  }
+
+  for (;;) {
+    while (p_ != end_) {
+      char c = *p_;
+      if (c == ' ' || c == '\t' || c == '\r') {
+        ++p_;
+      } else if (c == '\n') {
+        ++p_;
+        ++line_;
+      } else {
+        break;
+      }
+    }
+    if (p_ != end_) {
+      break;
+    }
+    if (!nextChunk()) {
+      if (!final_) {
+        return false;
+      }
+      token_ = TOKEN_EOF;
+      return true;
+    }
+  }
+
+  char c = *p_;
+  if (c == '\"') {
+    token_ = TOKEN_STRING;
+    start_ = ++p_;
+    escape_ = false;
+    hasEscape_ = false;
+    return scanString() || nextToken();
+  }
+  if (isScalarChar(c)) {
+    token_ = TOKEN_SCALAR;
+    start_ = p_;
+    return scanScalar() || nextToken();
+  }
+  token_ = TOKEN_CHAR;
+  char_ = c;
+  ++p_;
+  return true;
+}
+
+bool JsonReader::scanString() {
+  const char* p = p_;
+  for (; p != end_; ++p) {
+    char c = *p;
+    if (escape_) {
+      escape_ = false;
+    } else if (c == '\"') {
+      endToken(p);
+      p_ = p + 1;
+      return true;
+    } else if (c == '\\') {
+      escape_ = true;
+      hasEscape_ = true;
+    } else if (c == '\n') {
+      ++line_;
+    } else if (c == '\0') {
+      // Only zero bytes are banned, not all control characters, as
+      // parseJson() does.
+      raw_ = StringPiece(p, end_);
+      partial_ = false;
+      error("null byte in string");
+    }
+  }
+  appendPartial();
+  return false;
+}
+
+bool JsonReader::scanScalar() {
+  const char* p = p_;
+  while (p != end_ && isScalarChar(*p)) {
+    ++p;
+  }
+  if (p != end_) {
+    endToken(p);
+    p_ = p;
+    return true;
+  }
+  appendPartial();
+  return false;
+}
+
+void JsonReader::endToken(const char* end) {
+  if (!partial_) {
+    raw_ = StringPiece(start_, end);
+  } else {
+    carry_.append(start_, end);
+    raw_ = carry_;
+    partial_ = false;
+  }
+}
+
+void JsonReader::appendPartial() {
+  if (!partial_) {
+    carry_.clear();
+    partial_ = true;
+  }
+  carry_.append(start_, end_);
+  p_ = end_;
+}
+
+bool JsonReader::step() {
+  if (token_ == TOKEN_EOF) {
+    if (state_ != DONE) {
+      error("unexpected end of input");
+    }
+    event_ = END;
+    return true;
+  }
+
+  switch (state_) {
+    case VALUE:
+    case ARRAY_FIRST:
+    case ARRAY_VALUE:
+    case OBJECT_VALUE:
+      if (token_ == TOKEN_STRING) {
+        setString();
+        event_ = STRING;
+        afterValue();
+        return true;
+      }
+      if (token_ == TOKEN_SCALAR) {
+        setScalar();
+        afterValue();
+        return true;
+      }
+      if (char_ == '{') {
+        stack_.push_back(OBJECT_NEXT);
+        state_ = OBJECT_FIRST;
+        event_ = START_OBJECT;
+        return true;
+      }
+      if (char_ == '[') {
+        stack_.push_back(ARRAY_NEXT);
+        state_ = ARRAY_FIRST;
+        event_ = START_ARRAY;
+        return true;
+      }
+      if (char_ == ']' &&
+          (state_ == ARRAY_FIRST ||
+           (state_ == ARRAY_VALUE && opts_.allow_trailing_comma))) {
+        return endContainer(END_ARRAY);
+      }
+      error("expected json value");
+
+    case OBJECT_FIRST:
+    case OBJECT_KEY:
+      if (token_ == TOKEN_STRING) {
+        setString();
+      } else if (token_ == TOKEN_SCALAR && opts_.allow_non_string_keys) {
+        str_ = raw_;
+      } else if (token_ == TOKEN_CHAR && char_ == '}' &&
+                 (state_ == OBJECT_FIRST || opts_.allow_trailing_comma)) {
+        return endContainer(END_OBJECT);
+      } else if (opts_.allow_non_string_keys) {
+        error("expected string or scalar for object key name");
+      } else {
+        error("expected string for object key name");
+      }
+      state_ = OBJECT_COLON;
+      event_ = KEY;
+      return true;
+
+    case OBJECT_COLON:
+      if (token_ != TOKEN_CHAR || char_ != ':') {
+        error("expected ':'");
+      }
+      state_ = OBJECT_VALUE;
+      return false;
+
+    case ARRAY_NEXT:
+    case OBJECT_NEXT:
+      if (token_ == TOKEN_CHAR && char_ == ',') {
+        state_ = state_ == ARRAY_NEXT ? ARRAY_VALUE : OBJECT_KEY;
+        return false;
+      }
+      if (state_ == ARRAY_NEXT) {
+        if (token_ != TOKEN_CHAR || char_ != ']') {
+          error("expected ']'");
+        }
+        return endContainer(END_ARRAY);
+      }
+      if (token_ != TOKEN_CHAR || char_ != '}') {
+        error("expected '}'");
+      }
+      return endContainer(END_OBJECT);
+
+    case DONE:
+      error("parsing didn't consume all input");
+  }
+  return false;
+}
+
+void JsonReader::afterValue() {
+  state_ = stack_.empty() ? DONE : State(stack_.back());
+}
+
+bool JsonReader::endContainer(Event event) {
+  stack_.pop_back();
+  afterValue();
+  event_ = event;
+  return true;
+}
+
+void JsonReader::setString() {
+  if (skipping_) {
+    return;
+  }
+  if (opts_.validate_utf8 && !isValidUtf8(raw_)) {
+    error("invalid UTF-8 in string");
+  }
+  if (!hasEscape_) {
+    str_ = raw_;
+    return;
+  }
+  if (auto what = detail::jsonUnescape(raw_, unescaped_)) {
+    error(what);
+  }
+  str_ = unescaped_;
+}
+
+void JsonReader::setScalar() {
+  str_ = raw_;
+  if (raw_ == "true" || raw_ == "false") {
+    event_ = BOOL;
+    bool_ = raw_[0] == 't';
+    return;
+  }
+  if (raw_ == "null") {
+    event_ = NULLT;
+    return;
+  }
+  if (raw_ == "Infinity" || raw_ == "-Infinity" || raw_ == "NaN") {
+    event_ = DOUBLE;
+    double_ = raw_ == "NaN" ? std::numeric_limits<double>::quiet_NaN()
+            : raw_[0] == '-' ? -std::numeric_limits<double>::infinity()
+            : std::numeric_limits<double>::infinity();
+    return;
+  }
+
+  // -?[0-9]+(\.[0-9]*)?([eE][+-]?[0-9]+)?
+  const char* p = raw_.begin();
+  const char* e = raw_.end();
+  if (*p == '-') {
+    ++p;
+  }
+  const char* digits = p;
+  while (p != e && isDigit(*p)) {
+    ++p;
+  }
+  if (p == digits) {
+    error(*raw_.begin() == '-' ? "expected digits after `-'"
+                               : "expected json value");
+  }
+  bool integral = true;
+  if (p != e && *p == '.') {
+    integral = false;
+    ++p;
+    while (p != e && isDigit(*p)) {
+      ++p;
+    }
+  }
+  if (p != e && (*p == 'e' || *p == 'E')) {
+    integral = false;
+    ++p;
+    if (p != e && (*p == '+' || *p == '-')) {
+      ++p;
+    }
+    digits = p;
+    while (p != e && isDigit(*p)) {
+      ++p;
+    }
+    if (p == digits) {
+      error("expected digits in exponent");
+    }
+  }
+  if (p != e) {
+    error("invalid number");
+  }
+
+  event_ = integral ? INT : DOUBLE;
+  if (skipping_) {
+    return;
+  }
+  try {
+    if (integral) {
+      int_ = to<int64_t>(raw_);
+    } else {
+      double_ = to<double>(raw_);
+    }
+  } catch (const std::range_error& e) {
+    error(e.what());
+  }
+}
+
+StringPiece JsonReader::context() const {
+  StringPiece sp;
+  switch (token_) {
+    case TOKEN_CHAR:
+      sp = StringPiece(p_ - 1, end_);
+      break;
+    case TOKEN_STRING:
+    case TOKEN_SCALAR:
+      sp = partial_ ? StringPiece(carry_) : raw_;
+      break;
+    default:
+      break;
+  }
+  return sp.subpiece(0, 16 /* arbitrary */);
+}
+
+void JsonReader::error(StringPiece what) const {
+  auto ctx = context();
+  throw std::runtime_error(to<std::string>(
+      "json parse error on line ", line_,
+      !ctx.empty() ? to<std::string>(" near `", ctx, '\'') : "",
+      ": ", what));
+}
+
+} // namespace folly
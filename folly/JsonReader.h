@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Event based JSON parsing, without building a folly::dynamic.
+ *
+ * JsonReader is a pull parser: the input is fed in chunks (which need
+ * not end on token boundaries), and next() returns the events one by
+ * one, NEED_INPUT when the chunks fed so far are exhausted.
+ *
+ *   JsonReader reader;
+ *   reader.feed(std::move(buf));
+ *   reader.finish();                      // no more input
+ *   for (auto ev = reader.next(); ev != JsonReader::END; ev = reader.next()) {
+ *     if (ev == JsonReader::KEY && reader.str() == "id") {
+ *       reader.next();
+ *       id = reader.getInt();
+ *     } else if (ev == JsonReader::KEY) {
+ *       reader.skip();                    // the value of another key
+ *     }
+ *   }
+ *
+ * Keys and strings are returned as StringPieces, pointing into the input
+ * when possible (the string has no escapes and is not split between
+ * chunks), valid until the next call to next().
+ *
+ * The grammar is the one of parseJson(), with the same handling of the
+ * allow_trailing_comma and allow_non_string_keys options (non-string
+ * keys must be scalars, their text is returned by str()), and strings
+ * are checked to be valid UTF-8 if validate_utf8 is set. Errors are
+ * thrown as std::runtime_error.
+ */
+
+#ifndef FOLLY_JSONREADER_H_
+#define FOLLY_JSONREADER_H_
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <folly/Range.h>
+#include <folly/io/IOBuf.h>
+#include <folly/json.h>
+
+namespace folly {
+
+class JsonReader {
+public:
+  enum Event {
+    NEED_INPUT,   // feed more input, or finish()
+    START_OBJECT,
+    END_OBJECT,
+    START_ARRAY,
+    END_ARRAY,
+    KEY,          // str()
+    STRING,       // str()
+    INT,          // getInt(), str() is the number as written
+    DOUBLE,       // getDouble(), str() is the number as written
+    BOOL,         // getBool()
+    NULLT,
+    END,          // the value is complete, and so is the input
+  };
+
+  explicit JsonReader(
+      const json::serialization_opts& opts = json::serialization_opts());
+
+  JsonReader(const JsonReader&) = delete;
+  JsonReader& operator=(const JsonReader&) = delete;
+
+  /**
+   * Append a chunk of input. The data must stay valid until next()
+   * returns NEED_INPUT (or END).
+   */
+  void feed(StringPiece chunk);
+
+  /**
+   * Append the buffers of a chain, which is kept until consumed.
+   */
+  void feed(std::unique_ptr<IOBuf> buf);
+
+  /**
+   * No more input: the end of the chunks fed is the end of the JSON text.
+   */
+  void finish();
+
+  /**
+   * Parse up to the next event.
+   */
+  Event next();
+
+  /**
+   * Skip the value of the current KEY event, or the rest of the object or
+   * array just started; the next event is the one after it. Skipped
+   * values are checked for well-formedness only.
+   */
+  void skip();
+
+  Event event() const { return event_; }
+
+  StringPiece str() const { return str_; }
+  int64_t getInt() const { return int_; }
+  double getDouble() const { return double_; }
+  bool getBool() const { return bool_; }
+
+  /**
+   * Number of objects and arrays open.
+   */
+  size_t depth() const { return stack_.size(); }
+
+  /**
+   * Line of the input being parsed, from 0.
+   */
+  size_t line() const { return line_; }
+
+  /**
+   * SAX style: pass the events to handler, until the end of the input
+   * (true) or of the chunks fed (false). Handler has the methods
+   *
+   *   startObject(), endObject(), startArray(), endArray(),
+   *   key(StringPiece), string(StringPiece), integer(int64_t),
+   *   number(double), boolean(bool), null()
+   */
+  template <class Handler>
+  bool parse(Handler& handler);
+
+private:
+  enum State : uint8_t {
+    VALUE,          // the top-level value
+    ARRAY_FIRST,    // after '['
+    ARRAY_VALUE,    // after ',' in an array
+    ARRAY_NEXT,     // after a value in an array
+    OBJECT_FIRST,   // after '{'
+    OBJECT_KEY,     // after ',' in an object
+    OBJECT_COLON,   // after a key
+    OBJECT_VALUE,   // after ':'
+    OBJECT_NEXT,    // after a value in an object
+    DONE,
+  };
+
+  enum Token : uint8_t {
+    TOKEN_NONE,
+    TOKEN_CHAR,     // one of {}[]:,
+    TOKEN_STRING,
+    TOKEN_SCALAR,   // a number or literal
+    TOKEN_EOF,
+  };
+
+  bool nextChunk();
+  bool nextToken();
+  bool scanString();
+  bool scanScalar();
+  void endToken(const char* end);
+  void appendPartial();
+
+  // Apply the current token, false if it makes no event
+  bool step();
+  void afterValue();
+  bool endContainer(Event event);
+  void setString();
+  void setScalar();
+
+  [[noreturn]] void error(StringPiece what) const;
+  StringPiece context() const;
+
+  json::serialization_opts opts_;
+
+  std::deque<StringPiece> chunks_;
+  std::vector<std::unique_ptr<IOBuf>> bufs_;  // owning some of chunks_
+  const char* p_{nullptr};    // in the current chunk
+  const char* end_{nullptr};
+  const char* start_{nullptr};  // of the token in the current chunk
+  bool final_{false};
+
+  Token token_{TOKEN_NONE};
+  bool partial_{false};       // token_ goes on in the next chunk
+  bool escape_{false};        // in a partial string, after '\'
+  bool hasEscape_{false};
+  char char_{0};              // of TOKEN_CHAR
+  StringPiece raw_;           // of TOKEN_STRING (unquoted), TOKEN_SCALAR
+  std::string carry_;         // the pieces of a token split by chunks
+  std::string unescaped_;
+
+  std::vector<uint8_t> stack_;  // ARRAY_NEXT or OBJECT_NEXT
+  State state_{VALUE};
+  size_t skipDepth_{0};
+  bool skipping_{false};
+  size_t line_{0};
+
+  Event event_{NEED_INPUT};
+  StringPiece str_;
+  int64_t int_{0};
+  double double_{0};
+  bool bool_{false};
+};
+
+template <class Handler>
+bool JsonReader::parse(Handler& handler) {
+  for (;;) {
+    switch (next()) {
+      case NEED_INPUT: return false;
+      case END: return true;
+      case START_OBJECT: handler.startObject(); break;
+      case END_OBJECT: handler.endObject(); break;
+      case START_ARRAY: handler.startArray(); break;
+      case END_ARRAY: handler.endArray(); break;
+      case KEY: handler.key(str_); break;
+      case STRING: handler.string(str_); break;
+      case INT: handler.integer(int_); break;
+      case DOUBLE: handler.number(double_); break;
+      case BOOL: handler.boolean(bool_); break;
+      case NULLT: handler.null(); break;
+    }
+  }
+}
+
+} // namespace folly
+
+#endif /* FOLLY_JSONREADER_H_ */
@@ -34,6 +34,11 @@ namespace detail {
 extern const char cEscapeTable[];
 }  // namespace detail
 
+namespace detail {
+// Number of leading characters of p which cEscape() copies as is
+size_t cEscapeSkip(const char* p, size_t n);
+}  // namespace detail
+
 template <class String>
 void cEscape(StringPiece str, String& out) {
   char esc[4];
@@ -41,30 +46,24 @@ void cEscape(StringPiece str, String& out) {
   out.reserve(out.size() + str.size());
   auto p = str.begin();
   auto last = p;  // last regular character
-  // We advance over runs of regular characters (printable, not double-quote or
-  // backslash) and copy them in one go; this is faster than calling push_back
-  // repeatedly.
-  while (p != str.end()) {
-    char c = *p;
-    unsigned char v = static_cast<unsigned char>(c);
+  // We skip runs of regular characters (printable, not double-quote,
+  // question mark or backslash) by blocks and copy them in one go; this is
+  // faster than calling push_back repeatedly.
+  while ((p += detail::cEscapeSkip(p, str.end() - p)) != str.end()) {
+    unsigned char v = static_cast<unsigned char>(*p);
     char e = detail::cEscapeTable[v];
-    if (e == 'P') {  // printable
-      ++p;
-    } else if (e == 'O') {  // octal
-      out.append(&*last, p - last);
+    out.append(&*last, p - last);
+    if (e == 'O') {  // octal
       esc[1] = '0' + ((v >> 6) & 7);
       esc[2] = '0' + ((v >> 3) & 7);
       esc[3] = '0' + (v & 7);
       out.append(esc, 4);
-      ++p;
-      last = p;
     } else {  // special 1-character escape
-      out.append(&*last, p - last);
       esc[1] = e;
       out.append(esc, 2);
-      ++p;
-      last = p;
     }
+    ++p;
+    last = p;
   }
   out.append(&*last, p - last);
 }
@@ -157,6 +156,11 @@ namespace detail {
 // 3 = space, replace with '+' in QUERY mode
 // 4 = percent-encode
 extern const unsigned char uriEscapeTable[];
+
+// Number of leading characters of p which uriEscape() and uriUnescape()
+// copy as is
+size_t uriEscapeSkip(const char* p, size_t n, UriEscapeMode mode);
+size_t uriUnescapeSkip(const char* p, size_t n, UriEscapeMode mode);
 }  // namespace detail
 
 template <class String>
@@ -168,28 +172,20 @@ void uriEscape(StringPiece str, String& out, UriEscapeMode mode) {
   out.reserve(out.size() + str.size() + 3 * (str.size() / 4));
   auto p = str.begin();
   auto last = p;  // last regular character
-  // We advance over runs of passthrough characters and copy them in one go;
-  // this is faster than calling push_back repeatedly.
-  unsigned char minEncode = static_cast<unsigned char>(mode);
-  while (p != str.end()) {
-    char c = *p;
-    unsigned char v = static_cast<unsigned char>(c);
-    unsigned char discriminator = detail::uriEscapeTable[v];
-    if (LIKELY(discriminator <= minEncode)) {
-      ++p;
-    } else if (mode == UriEscapeMode::QUERY && discriminator == 3) {
-      out.append(&*last, p - last);
+  // We skip runs of passthrough characters by blocks and copy them in one
+  // go; this is faster than calling push_back repeatedly.
+  while ((p += detail::uriEscapeSkip(p, str.end() - p, mode)) != str.end()) {
+    unsigned char v = static_cast<unsigned char>(*p);
+    out.append(&*last, p - last);
+    if (mode == UriEscapeMode::QUERY && detail::uriEscapeTable[v] == 3) {
       out.push_back('+');
-      ++p;
-      last = p;
     } else {
-      out.append(&*last, p - last);
       esc[1] = hexValues[v >> 4];
       esc[2] = hexValues[v & 0x0f];
       out.append(esc, 3);
-      ++p;
-      last = p;
     }
+    ++p;
+    last = p;
   }
   out.append(&*last, p - last);
 }
@@ -199,40 +195,28 @@ void uriUnescape(StringPiece str, String& out, UriEscapeMode mode) {
   out.reserve(out.size() + str.size());
   auto p = str.begin();
   auto last = p;
-  // We advance over runs of passthrough characters and copy them in one go;
-  // this is faster than calling push_back repeatedly.
-  while (p != str.end()) {
-    char c = *p;
-    switch (c) {
-    case '%':
-      {
-        if (UNLIKELY(std::distance(p, str.end()) < 3)) {
-          throw std::invalid_argument("incomplete percent encode sequence");
-        }
-        auto h1 = detail::hexTable[static_cast<unsigned char>(p[1])];
-        auto h2 = detail::hexTable[static_cast<unsigned char>(p[2])];
-        if (UNLIKELY(h1 == 16 || h2 == 16)) {
-          throw std::invalid_argument("invalid percent encode sequence");
-        }
-        out.append(&*last, p - last);
-        out.push_back((h1 << 4) | h2);
-        p += 3;
-        last = p;
-        break;
+  // We skip runs of passthrough characters by blocks and copy them in one
+  // go; this is faster than calling push_back repeatedly.
+  while ((p += detail::uriUnescapeSkip(p, str.end() - p, mode)) !=
+         str.end()) {
+    if (*p == '%') {
+      if (UNLIKELY(std::distance(p, str.end()) < 3)) {
+        throw std::invalid_argument("incomplete percent encode sequence");
       }
-    case '+':
-      if (mode == UriEscapeMode::QUERY) {
-        out.append(&*last, p - last);
-        out.push_back(' ');
-        ++p;
-        last = p;
-        break;
+      auto h1 = detail::hexTable[static_cast<unsigned char>(p[1])];
+      auto h2 = detail::hexTable[static_cast<unsigned char>(p[2])];
+      if (UNLIKELY(h1 == 16 || h2 == 16)) {
+        throw std::invalid_argument("invalid percent encode sequence");
       }
-      // else fallthrough
-    default:
+      out.append(&*last, p - last);
+      out.push_back((h1 << 4) | h2);
+      p += 3;
+    } else {  // '+' in QUERY mode
+      out.append(&*last, p - last);
+      out.push_back(' ');
       ++p;
-      break;
     }
+    last = p;
   }
   out.append(&*last, p - last);
 }
@@ -241,18 +225,12 @@ namespace detail {
 
 /*
  * The following functions are type-overloaded helpers for
- * internalSplit().
+ * internalSplit() and internalJoinAppend().
  */
 inline size_t delimSize(char)          { return 1; }
 inline size_t delimSize(StringPiece s) { return s.size(); }
-inline bool atDelim(const char* s, char c) {
- return *s == c;
-}
-inline bool atDelim(const char* s, StringPiece sp) {
-  return !std::memcmp(s, sp.start(), sp.size());
-}
 
-// These are used to short-circuit internalSplit() in the case of
+// These are used to short-circuit internalJoinAppend() in the case of
 // 1-character strings.
 inline char delimFront(char c) {
   // This one exists only for compile-time; it should never be called.
@@ -264,6 +242,57 @@ inline char delimFront(StringPiece s) {
   return *s.start();
 }
 
+/*
+ * Vectorized delimiter search (String.cpp), by windows of at most
+ * kSplitWindow bytes.
+ *
+ * splitFindBytes() writes the positions of c in [p, p + n) to out, and
+ * returns their number; splitCountBytes() only counts them.
+ * splitFindDelims() does the same for the positions in [p, p + n) where
+ * delim (of at least 2 characters) starts, reading up to p + avail;
+ * the matches may overlap.
+ */
+constexpr size_t kSplitWindow = 1024;
+
+size_t splitFindBytes(const char* p, size_t n, char c, uint32_t* out);
+size_t splitCountBytes(const char* p, size_t n, char c);
+size_t splitFindDelims(const char* p, size_t n, size_t avail,
+                       StringPiece delim, uint32_t* out);
+
+/*
+ * Call fn(pos) for each delimiter of sp, from left to right.
+ */
+template <class Fn>
+void forEachDelim(char delim, StringPiece sp, Fn&& fn) {
+  uint32_t pos[kSplitWindow];
+  for (size_t w = 0; w < sp.size(); w += kSplitWindow) {
+    size_t n = splitFindBytes(sp.data() + w,
+                              std::min(kSplitWindow, sp.size() - w),
+                              delim, pos);
+    for (size_t i = 0; i < n; ++i) {
+      fn(w + pos[i]);
+    }
+  }
+}
+
+template <class Fn>
+void forEachDelim(StringPiece delim, StringPiece sp, Fn&& fn) {
+  assert(delim.size() >= 2);
+  uint32_t pos[kSplitWindow];
+  size_t next = 0;    // where the next delimiter can start
+  for (size_t w = 0; w < sp.size(); w += kSplitWindow) {
+    size_t n = splitFindDelims(sp.data() + w,
+                               std::min(kSplitWindow, sp.size() - w),
+                               sp.size() - w, delim, pos);
+    for (size_t i = 0; i < n; ++i) {
+      if (w + pos[i] >= next) {
+        fn(w + pos[i]);
+        next = w + pos[i] + delim.size();
+      }
+    }
+  }
+}
+
 /*
  * These output conversion templates allow us to support multiple
  * output string types, even when we are using an arbitrary
@@ -288,55 +317,82 @@ template<> struct OutputConverter<StringPiece> {
 };
 
 /*
- * Shared implementation for all the split() overloads.
- *
- * This uses some external helpers that are overloaded to let this
- * algorithm be more performant if the deliminator is a single
- * character instead of a whole string.
+ * Shared implementation for all the split() overloads: call fn on each
+ * token.
  *
- * @param ignoreEmpty iff true, don't copy empty segments to output
+ * @param ignoreEmpty iff true, don't pass empty tokens to fn
  */
-template<class OutStringT, class DelimT, class OutputIterator>
-void internalSplit(DelimT delim, StringPiece sp, OutputIterator out,
-    bool ignoreEmpty) {
+template<class DelimT, class Fn>
+void internalSplitEach(DelimT delim, StringPiece sp, Fn& fn,
+                       bool ignoreEmpty) {
   assert(sp.empty() || sp.start() != nullptr);
 
-  const char* s = sp.start();
-  const size_t strSize = sp.size();
   const size_t dSize = delimSize(delim);
-
-  OutputConverter<OutStringT> conv;
-
-  if (dSize > strSize || dSize == 0) {
-    if (!ignoreEmpty || strSize > 0) {
-      *out++ = conv(sp);
+  if (dSize > sp.size() || dSize == 0) {
+    if (!ignoreEmpty || !sp.empty()) {
+      fn(sp);
     }
     return;
   }
   if (boost::is_same<DelimT,StringPiece>::value && dSize == 1) {
     // Call the char version because it is significantly faster.
-    return internalSplit<OutStringT>(delimFront(delim), sp, out,
-      ignoreEmpty);
+    return internalSplitEach(delimFront(delim), sp, fn, ignoreEmpty);
   }
 
   size_t tokenStartPos = 0;
-  size_t tokenSize = 0;
-  for (size_t i = 0; i <= strSize - dSize; ++i) {
-    if (atDelim(&s[i], delim)) {
-      if (!ignoreEmpty || tokenSize > 0) {
-        *out++ = conv(StringPiece(&s[tokenStartPos], tokenSize));
-      }
-
-      tokenStartPos = i + dSize;
-      tokenSize = 0;
-      i += dSize - 1;
-    } else {
-      ++tokenSize;
+  forEachDelim(delim, sp, [&](size_t pos) {
+    if (!ignoreEmpty || pos > tokenStartPos) {
+      fn(StringPiece(sp.start() + tokenStartPos, pos - tokenStartPos));
     }
+    tokenStartPos = pos + dSize;
+  });
+  if (!ignoreEmpty || sp.size() > tokenStartPos) {
+    fn(StringPiece(sp.start() + tokenStartPos, sp.end()));
   }
-  tokenSize = strSize - tokenStartPos;
-  if (!ignoreEmpty || tokenSize > 0) {
-    *out++ = conv(StringPiece(&s[tokenStartPos], tokenSize));
+}
+
+template<class OutStringT, class DelimT, class OutputIterator>
+void internalSplit(DelimT delim, StringPiece sp, OutputIterator out,
+    bool ignoreEmpty) {
+  OutputConverter<OutStringT> conv;
+  auto fn = [&](StringPiece token) { *out++ = conv(token); };
+  internalSplitEach(delim, sp, fn, ignoreEmpty);
+}
+
+template<class DelimT>
+size_t internalSplitCount(DelimT delim, StringPiece sp, bool ignoreEmpty) {
+  size_t count = 0;
+  auto fn = [&](StringPiece) { ++count; };
+  internalSplitEach(delim, sp, fn, ignoreEmpty);
+  return count;
+}
+
+inline size_t internalSplitCount(char delim, StringPiece sp,
+                                 bool ignoreEmpty) {
+  if (ignoreEmpty) {
+    return internalSplitCount<char>(delim, sp, ignoreEmpty);
+  }
+  return splitCountBytes(sp.data(), sp.size(), delim) + 1;
+}
+
+/*
+ * Reserve room for the tokens of sp in out, if the delimiter is a
+ * character (they are counted then, faster than out can grow). Exact
+ * unless ignoreEmpty.
+ */
+template<class Vector>
+void reserveSplit(char delim, StringPiece sp, Vector& out) {
+  size_t size =
+    out.size() + splitCountBytes(sp.data(), sp.size(), delim) + 1;
+  if (size > out.capacity()) {
+    out.reserve(std::max(size, size_t(out.capacity() * 2)));
+  }
+}
+
+template<class Vector>
+void reserveSplit(StringPiece delim, StringPiece sp, Vector& out) {
+  if (delim.size() == 1) {
+    reserveSplit(delim[0], sp, out);
   }
 }
 
@@ -398,6 +454,7 @@ void split(const Delim& delimiter,
            const String& input,
            std::vector<OutputType>& out,
            bool ignoreEmpty) {
+  detail::reserveSplit(detail::prepareDelim(delimiter), input, out);
   detail::internalSplit<OutputType>(
     detail::prepareDelim(delimiter),
     StringPiece(input),
@@ -410,6 +467,7 @@ void split(const Delim& delimiter,
            const String& input,
            fbvector<OutputType>& out,
            bool ignoreEmpty) {
+  detail::reserveSplit(detail::prepareDelim(delimiter), input, out);
   detail::internalSplit<OutputType>(
     detail::prepareDelim(delimiter),
     StringPiece(input),
@@ -417,6 +475,42 @@ void split(const Delim& delimiter,
     ignoreEmpty);
 }
 
+template<class Delim, class String, class OutputType,
+         std::size_t N, class A, class B, class C>
+void split(const Delim& delimiter,
+           const String& input,
+           small_vector<OutputType, N, A, B, C>& out,
+           bool ignoreEmpty) {
+  detail::reserveSplit(detail::prepareDelim(delimiter), input, out);
+  detail::internalSplit<OutputType>(
+    detail::prepareDelim(delimiter),
+    StringPiece(input),
+    std::back_inserter(out),
+    ignoreEmpty);
+}
+
+template<class Delim, class String, class Fn>
+void splitForEach(const Delim& delimiter,
+                  const String& input,
+                  Fn fn,
+                  bool ignoreEmpty) {
+  detail::internalSplitEach(
+    detail::prepareDelim(delimiter),
+    StringPiece(input),
+    fn,
+    ignoreEmpty);
+}
+
+template<class Delim, class String>
+size_t splitCount(const Delim& delimiter,
+                  const String& input,
+                  bool ignoreEmpty) {
+  return detail::internalSplitCount(
+    detail::prepareDelim(delimiter),
+    StringPiece(input),
+    ignoreEmpty);
+}
+
 template<class OutputValueType, class Delim, class String,
          class OutputIterator>
 void splitTo(const Delim& delimiter,
@@ -608,45 +702,58 @@ void humanify(const String1& input, String2& output) {
   }
 }
 
+namespace detail {
+// Writes the 2 * n hex digits of the bytes of p
+void hexlifyBytes(const unsigned char* p, size_t n, char* out);
+
+// Writes the n bytes of the 2 * n hex digits of p, false if one is not
+// a hex digit
+bool unhexlifyBytes(const char* p, size_t n, unsigned char* out);
+
+void hexlifyAppend(ByteRange input, IOBufQueue& output);
+bool unhexlifyAppend(StringPiece input, IOBufQueue& output);
+}  // namespace detail
+
 template<class InputString, class OutputString>
 bool hexlify(const InputString& input, OutputString& output,
              bool append_output) {
   if (!append_output) output.clear();
 
-  static char hexValues[] = "0123456789abcdef";
   auto j = output.size();
   output.resize(2 * input.size() + output.size());
-  for (size_t i = 0; i < input.size(); ++i) {
-    int ch = input[i];
-    output[j++] = hexValues[(ch >> 4) & 0xf];
-    output[j++] = hexValues[ch & 0xf];
+  if (!input.empty()) {
+    detail::hexlifyBytes(
+        reinterpret_cast<const unsigned char*>(&input[0]), input.size(),
+        reinterpret_cast<char*>(&output[j]));
   }
   return true;
 }
 
+template<class InputString>
+bool hexlify(const InputString& input, IOBufQueue& output) {
+  detail::hexlifyAppend(
+      ByteRange(reinterpret_cast<const unsigned char*>(input.data()),
+                input.size()),
+      output);
+  return true;
+}
+
 template<class InputString, class OutputString>
 bool unhexlify(const InputString& input, OutputString& output) {
   if (input.size() % 2 != 0) {
     return false;
   }
   output.resize(input.size() / 2);
-  int j = 0;
-  auto unhex = [](char c) -> int {
-    return c >= '0' && c <= '9' ? c - '0' :
-           c >= 'A' && c <= 'F' ? c - 'A' + 10 :
-           c >= 'a' && c <= 'f' ? c - 'a' + 10 :
-           -1;
-  };
-
-  for (size_t i = 0; i < input.size(); i += 2) {
-    int highBits = unhex(input[i]);
-    int lowBits = unhex(input[i + 1]);
-    if (highBits < 0 || lowBits < 0) {
-      return false;
-    }
-    output[j++] = (highBits << 4) + lowBits;
-  }
-  return true;
+  return input.empty() || detail::unhexlifyBytes(
+      reinterpret_cast<const char*>(&input[0]), input.size() / 2,
+      reinterpret_cast<unsigned char*>(&output[0]));
+}
+
+template<class InputString>
+bool unhexlify(const InputString& input, IOBufQueue& output) {
+  return detail::unhexlifyAppend(
+      StringPiece(reinterpret_cast<const char*>(input.data()), input.size()),
+      output);
 }
 
 namespace detail {
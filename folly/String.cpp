@@ -18,6 +18,8 @@
 
 #include <folly/Format.h>
 #include <folly/ScopeGuard.h>
+#include <folly/detail/SimdDispatch.h>
+#include <folly/io/IOBufQueue.h>
 
 #include <cerrno>
 #include <cstdarg>
@@ -28,6 +30,10 @@
 #include <string.h>
 #include <glog/logging.h>
 
+#if FOLLY_SIMD
+#include <immintrin.h>
+#endif
+
 namespace folly {
 
 namespace {
@@ -504,6 +510,653 @@ void toLowerAscii(char* str, size_t length) {
   }
 }
 
+namespace {
+
+// Positions from base, for the tails of the vectorized versions
+size_t splitFindBytesFrom(const char* p, size_t n, char c, uint32_t* out,
+                          uint32_t base) {
+  uint32_t* o = out;
+  for (const char* q = p; (q = static_cast<const char*>(
+           memchr(q, c, p + n - q))) != nullptr; ++q) {
+    *o++ = base + (q - p);
+  }
+  return o - out;
+}
+
+size_t splitFindBytesScalar(const char* p, size_t n, char c, uint32_t* out) {
+  return splitFindBytesFrom(p, n, c, out, 0);
+}
+
+size_t splitCountBytesScalar(const char* p, size_t n, char c) {
+  size_t count = 0;
+  for (size_t i = 0; i < n; ++i) {
+    count += p[i] == c;
+  }
+  return count;
+}
+
+// From i, for the tails of the vectorized versions
+uint32_t* splitFindDelimsFrom(const char* p, size_t i, size_t n, size_t avail,
+                              StringPiece delim, uint32_t* o) {
+  if (avail < delim.size()) {
+    return o;
+  }
+  size_t last = std::min(n, avail - delim.size() + 1);
+  for (; i < last; ++i) {
+    if (p[i] == delim[0] && !memcmp(p + i, delim.data(), delim.size())) {
+      *o++ = i;
+    }
+  }
+  return o;
+}
+
+size_t splitFindDelimsScalar(const char* p, size_t n, size_t avail,
+                             StringPiece delim, uint32_t* out) {
+  return splitFindDelimsFrom(p, 0, n, avail, delim, out) - out;
+}
+
+const char kHexValues[] = "0123456789abcdef";
+
+size_t cEscapeSkipScalar(const char* p, size_t n) {
+  size_t i = 0;
+  while (i < n &&
+         detail::cEscapeTable[static_cast<unsigned char>(p[i])] == 'P') {
+    ++i;
+  }
+  return i;
+}
+
+size_t uriEscapeSkipScalar(const char* p, size_t n, UriEscapeMode mode) {
+  unsigned char minEncode = static_cast<unsigned char>(mode);
+  size_t i = 0;
+  while (i < n &&
+         detail::uriEscapeTable[static_cast<unsigned char>(p[i])] <=
+         minEncode) {
+    ++i;
+  }
+  return i;
+}
+
+size_t uriUnescapeSkipScalar(const char* p, size_t n, UriEscapeMode mode) {
+  char plus = mode == UriEscapeMode::QUERY ? '+' : '%';
+  size_t i = 0;
+  while (i < n && p[i] != '%' && p[i] != plus) {
+    ++i;
+  }
+  return i;
+}
+
+void hexlifyBytesScalar(const unsigned char* p, size_t n, char* out) {
+  for (size_t i = 0; i < n; ++i) {
+    *out++ = kHexValues[p[i] >> 4];
+    *out++ = kHexValues[p[i] & 0x0f];
+  }
+}
+
+bool unhexlifyBytesScalar(const char* p, size_t n, unsigned char* out) {
+  for (size_t i = 0; i < n; ++i) {
+    auto h1 = detail::hexTable[static_cast<unsigned char>(p[2 * i])];
+    auto h2 = detail::hexTable[static_cast<unsigned char>(p[2 * i + 1])];
+    if (h1 == 16 || h2 == 16) {
+      return false;
+    }
+    out[i] = (h1 << 4) | h2;
+  }
+  return true;
+}
+
+#if FOLLY_SIMD
+
+// Positions of the bits set in mask, from base
+inline uint32_t* flattenMask(uint32_t mask, uint32_t base, uint32_t* o) {
+  while (mask) {
+    *o++ = base + __builtin_ctz(mask);
+    mask &= mask - 1;
+  }
+  return o;
+}
+
+size_t splitFindBytesSse2(const char* p, size_t n, char c, uint32_t* out) {
+  uint32_t* o = out;
+  const __m128i v = _mm_set1_epi8(c);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    o = flattenMask(_mm_movemask_epi8(_mm_cmpeq_epi8(b, v)), i, o);
+  }
+  return o - out + splitFindBytesFrom(p + i, n - i, c, o, i);
+}
+
+size_t splitCountBytesSse2(const char* p, size_t n, char c) {
+  const __m128i v = _mm_set1_epi8(c);
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(b, v)));
+  }
+  return count + splitCountBytesScalar(p + i, n - i, c);
+}
+
+// Candidates where the first and the last characters of delim match
+size_t splitFindDelimsSse2(const char* p, size_t n, size_t avail,
+                           StringPiece delim, uint32_t* out) {
+  uint32_t* o = out;
+  const size_t k = delim.size() - 1;
+  const __m128i first = _mm_set1_epi8(delim.front());
+  const __m128i last = _mm_set1_epi8(delim.back());
+  size_t i = 0;
+  for (; i + 16 <= n && i + k + 16 <= avail; i += 16) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + k));
+    uint32_t mask = _mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+    while (mask) {
+      uint32_t j = i + __builtin_ctz(mask);
+      if (!memcmp(p + j + 1, delim.data() + 1, k - 1)) {
+        *o++ = j;
+      }
+      mask &= mask - 1;
+    }
+  }
+  return splitFindDelimsFrom(p, i, n, avail, delim, o) - out;
+}
+
+size_t splitFindBytesAvx2(const char* p, size_t n, char c, uint32_t* out)
+  __attribute__ ((__target__("avx2"), noinline));
+size_t splitCountBytesAvx2(const char* p, size_t n, char c)
+  __attribute__ ((__target__("avx2"), noinline));
+size_t splitFindDelimsAvx2(const char* p, size_t n, size_t avail,
+                           StringPiece delim, uint32_t* out)
+  __attribute__ ((__target__("avx2"), noinline));
+
+size_t splitFindBytesAvx2(const char* p, size_t n, char c, uint32_t* out) {
+  uint32_t* o = out;
+  const __m256i v = _mm256_set1_epi8(c);
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    o = flattenMask(_mm256_movemask_epi8(_mm256_cmpeq_epi8(b, v)), i, o);
+  }
+  return o - out + splitFindBytesFrom(p + i, n - i, c, o, i);
+}
+
+size_t splitCountBytesAvx2(const char* p, size_t n, char c) {
+  const __m256i v = _mm256_set1_epi8(c);
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    count += __builtin_popcount(_mm256_movemask_epi8(_mm256_cmpeq_epi8(b, v)));
+  }
+  return count + splitCountBytesScalar(p + i, n - i, c);
+}
+
+size_t splitFindDelimsAvx2(const char* p, size_t n, size_t avail,
+                           StringPiece delim, uint32_t* out) {
+  uint32_t* o = out;
+  const size_t k = delim.size() - 1;
+  const __m256i first = _mm256_set1_epi8(delim.front());
+  const __m256i last = _mm256_set1_epi8(delim.back());
+  size_t i = 0;
+  for (; i + 32 <= n && i + k + 32 <= avail; i += 32) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    __m256i b =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + k));
+    uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(
+        _mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+    while (mask) {
+      uint32_t j = i + __builtin_ctz(mask);
+      if (!memcmp(p + j + 1, delim.data() + 1, k - 1)) {
+        *o++ = j;
+      }
+      mask &= mask - 1;
+    }
+  }
+  return splitFindDelimsFrom(p, i, n, avail, delim, o) - out;
+}
+
+/*
+ * The escaping kernels classify 16 or 32 characters at a time, and find
+ * the first one to escape in the movemask of the others. Bytes are
+ * signed in the comparisons, so that the non-ASCII ones are out of all
+ * the ranges.
+ */
+
+inline __m128i inRange(__m128i b, char lo, char hi) {
+  return _mm_and_si128(_mm_cmpgt_epi8(b, _mm_set1_epi8(lo - 1)),
+                       _mm_cmplt_epi8(b, _mm_set1_epi8(hi + 1)));
+}
+
+// Printable, but not '"', '?' or '\\'
+inline __m128i cPlain(__m128i b) {
+  __m128i special = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(b, _mm_set1_epi8('"')),
+                   _mm_cmpeq_epi8(b, _mm_set1_epi8('?'))),
+      _mm_cmpeq_epi8(b, _mm_set1_epi8('\\')));
+  return _mm_andnot_si128(special, inRange(b, 0x20, 0x7e));
+}
+
+// Alphanumeric, unreserved, or slash if given
+inline __m128i uriPlain(__m128i b, __m128i slash) {
+  __m128i unreserved = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(b, _mm_set1_epi8('-')),
+                   _mm_cmpeq_epi8(b, _mm_set1_epi8('.'))),
+      _mm_or_si128(_mm_cmpeq_epi8(b, _mm_set1_epi8('_')),
+                   _mm_cmpeq_epi8(b, _mm_set1_epi8('~'))));
+  __m128i alnum = _mm_or_si128(
+      inRange(b, '0', '9'),
+      inRange(_mm_or_si128(b, _mm_set1_epi8(0x20)), 'a', 'z'));
+  return _mm_or_si128(_mm_or_si128(alnum, unreserved),
+                      _mm_cmpeq_epi8(b, slash));
+}
+
+inline __m128i uriSlash(UriEscapeMode mode) {
+  // '-' is plain anyway
+  return _mm_set1_epi8(mode == UriEscapeMode::PATH ? '/' : '-');
+}
+
+size_t cEscapeSkipSse2(const char* p, size_t n) {
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    uint32_t mask = _mm_movemask_epi8(cPlain(b)) ^ 0xffff;
+    if (mask) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  return i + cEscapeSkipScalar(p + i, n - i);
+}
+
+size_t uriEscapeSkipSse2(const char* p, size_t n, UriEscapeMode mode) {
+  const __m128i slash = uriSlash(mode);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    uint32_t mask = _mm_movemask_epi8(uriPlain(b, slash)) ^ 0xffff;
+    if (mask) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  return i + uriEscapeSkipScalar(p + i, n - i, mode);
+}
+
+size_t uriUnescapeSkipSse2(const char* p, size_t n, UriEscapeMode mode) {
+  const __m128i percent = _mm_set1_epi8('%');
+  const __m128i plus =
+    _mm_set1_epi8(mode == UriEscapeMode::QUERY ? '+' : '%');
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    uint32_t mask = _mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(b, percent), _mm_cmpeq_epi8(b, plus)));
+    if (mask) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  return i + uriUnescapeSkipScalar(p + i, n - i, mode);
+}
+
+// '0' + v, plus 'a' - '0' - 10 if v > 9
+inline __m128i hexDigits(__m128i v) {
+  __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(9)),
+                                 _mm_set1_epi8('a' - '0' - 10));
+  return _mm_add_epi8(_mm_add_epi8(v, _mm_set1_epi8('0')), letter);
+}
+
+void hexlifyBytesSse2(const unsigned char* p, size_t n, char* out) {
+  const __m128i low = _mm_set1_epi8(0x0f);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    __m128i hi = hexDigits(_mm_and_si128(_mm_srli_epi16(b, 4), low));
+    __m128i lo = hexDigits(_mm_and_si128(b, low));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i),
+                     _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16),
+                     _mm_unpackhi_epi8(hi, lo));
+  }
+  hexlifyBytesScalar(p + i, n - i, out + 2 * i);
+}
+
+// Values of 16 hex digits as 8 bytes in the low halves of the 16-bit
+// lanes, and whether they are all valid
+inline __m128i unhexDigits(__m128i b, bool& valid) {
+  __m128i d = _mm_sub_epi8(b, _mm_set1_epi8('0'));
+  __m128i l = _mm_sub_epi8(_mm_or_si128(b, _mm_set1_epi8(0x20)),
+                           _mm_set1_epi8('a'));
+  __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+  __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+  valid = _mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) == 0xffff;
+  __m128i v = _mm_or_si128(
+      _mm_and_si128(isDigit, d),
+      _mm_and_si128(isLetter, _mm_add_epi8(l, _mm_set1_epi8(10))));
+  return _mm_or_si128(
+      _mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi16(0x00ff)), 4),
+      _mm_srli_epi16(v, 8));
+}
+
+bool unhexlifyBytesSse2(const char* p, size_t n, unsigned char* out) {
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    bool valid0, valid1;
+    __m128i a = unhexDigits(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2 * i)),
+        valid0);
+    __m128i b = unhexDigits(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2 * i + 16)),
+        valid1);
+    if (!valid0 || !valid1) {
+      return false;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm_packus_epi16(a, b));
+  }
+  return unhexlifyBytesScalar(p + 2 * i, n - i, out + i);
+}
+
+#define FOLLY_STRING_AVX2 __attribute__ ((__target__("avx2"), noinline))
+#define FOLLY_STRING_AVX2_INLINE \
+  __attribute__ ((__target__("avx2"), always_inline))
+
+size_t cEscapeSkipAvx2(const char* p, size_t n) FOLLY_STRING_AVX2;
+size_t uriEscapeSkipAvx2(const char* p, size_t n, UriEscapeMode mode)
+  FOLLY_STRING_AVX2;
+size_t uriUnescapeSkipAvx2(const char* p, size_t n, UriEscapeMode mode)
+  FOLLY_STRING_AVX2;
+void hexlifyBytesAvx2(const unsigned char* p, size_t n, char* out)
+  FOLLY_STRING_AVX2;
+bool unhexlifyBytesAvx2(const char* p, size_t n, unsigned char* out)
+  FOLLY_STRING_AVX2;
+
+inline __m256i inRange256(__m256i b, char lo, char hi)
+  FOLLY_STRING_AVX2_INLINE;
+inline __m256i cPlain256(__m256i b) FOLLY_STRING_AVX2_INLINE;
+inline __m256i uriPlain256(__m256i b, __m256i slash)
+  FOLLY_STRING_AVX2_INLINE;
+inline __m256i unhexDigits256(__m256i b, bool& valid)
+  FOLLY_STRING_AVX2_INLINE;
+
+// As the SSE2 versions, on 32 bytes
+inline __m256i inRange256(__m256i b, char lo, char hi) {
+  return _mm256_and_si256(
+      _mm256_cmpgt_epi8(b, _mm256_set1_epi8(lo - 1)),
+      _mm256_cmpgt_epi8(_mm256_set1_epi8(hi + 1), b));
+}
+
+inline __m256i cPlain256(__m256i b) {
+  __m256i special = _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi8(b, _mm256_set1_epi8('"')),
+                      _mm256_cmpeq_epi8(b, _mm256_set1_epi8('?'))),
+      _mm256_cmpeq_epi8(b, _mm256_set1_epi8('\\')));
+  return _mm256_andnot_si256(special, inRange256(b, 0x20, 0x7e));
+}
+
+inline __m256i uriPlain256(__m256i b, __m256i slash) {
+  __m256i unreserved = _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi8(b, _mm256_set1_epi8('-')),
+                      _mm256_cmpeq_epi8(b, _mm256_set1_epi8('.'))),
+      _mm256_or_si256(_mm256_cmpeq_epi8(b, _mm256_set1_epi8('_')),
+                      _mm256_cmpeq_epi8(b, _mm256_set1_epi8('~'))));
+  __m256i alnum = _mm256_or_si256(
+      inRange256(b, '0', '9'),
+      inRange256(_mm256_or_si256(b, _mm256_set1_epi8(0x20)), 'a', 'z'));
+  return _mm256_or_si256(_mm256_or_si256(alnum, unreserved),
+                         _mm256_cmpeq_epi8(b, slash));
+}
+
+inline __m256i unhexDigits256(__m256i b, bool& valid) {
+  __m256i d = _mm256_sub_epi8(b, _mm256_set1_epi8('0'));
+  __m256i l = _mm256_sub_epi8(_mm256_or_si256(b, _mm256_set1_epi8(0x20)),
+                              _mm256_set1_epi8('a'));
+  __m256i isDigit =
+    _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+  __m256i isLetter =
+    _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(5)), l);
+  valid = _mm256_movemask_epi8(_mm256_or_si256(isDigit, isLetter)) == -1;
+  __m256i v = _mm256_or_si256(
+      _mm256_and_si256(isDigit, d),
+      _mm256_and_si256(isLetter, _mm256_add_epi8(l, _mm256_set1_epi8(10))));
+  return _mm256_or_si256(
+      _mm256_slli_epi16(_mm256_and_si256(v, _mm256_set1_epi16(0x00ff)), 4),
+      _mm256_srli_epi16(v, 8));
+}
+
+size_t cEscapeSkipAvx2(const char* p, size_t n) {
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    uint32_t mask = ~_mm256_movemask_epi8(cPlain256(b));
+    if (mask) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  return i + cEscapeSkipScalar(p + i, n - i);
+}
+
+size_t uriEscapeSkipAvx2(const char* p, size_t n, UriEscapeMode mode) {
+  const __m256i slash =
+    _mm256_set1_epi8(mode == UriEscapeMode::PATH ? '/' : '-');
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    uint32_t mask = ~_mm256_movemask_epi8(uriPlain256(b, slash));
+    if (mask) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  return i + uriEscapeSkipScalar(p + i, n - i, mode);
+}
+
+size_t uriUnescapeSkipAvx2(const char* p, size_t n, UriEscapeMode mode) {
+  const __m256i percent = _mm256_set1_epi8('%');
+  const __m256i plus =
+    _mm256_set1_epi8(mode == UriEscapeMode::QUERY ? '+' : '%');
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    uint32_t mask = _mm256_movemask_epi8(_mm256_or_si256(
+        _mm256_cmpeq_epi8(b, percent), _mm256_cmpeq_epi8(b, plus)));
+    if (mask) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  return i + uriUnescapeSkipScalar(p + i, n - i, mode);
+}
+
+// Digits looked up by shuffle, interleaved in each 128-bit lane, then
+// the lanes put back in order
+void hexlifyBytesAvx2(const unsigned char* p, size_t n, char* out) {
+  const __m256i digits = _mm256_setr_epi8(
+      '0', '1', '2', '3', '4', '5', '6', '7',
+      '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+      '0', '1', '2', '3', '4', '5', '6', '7',
+      '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+  const __m256i low = _mm256_set1_epi8(0x0f);
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    __m256i hi = _mm256_shuffle_epi8(
+        digits, _mm256_and_si256(_mm256_srli_epi16(b, 4), low));
+    __m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(b, low));
+    __m256i first = _mm256_unpacklo_epi8(hi, lo);
+    __m256i second = _mm256_unpackhi_epi8(hi, lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i),
+                        _mm256_permute2x128_si256(first, second, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i + 32),
+                        _mm256_permute2x128_si256(first, second, 0x31));
+  }
+  hexlifyBytesSse2(p + i, n - i, out + 2 * i);
+}
+
+// The bytes packed in each 128-bit lane, then the lanes put back in order
+bool unhexlifyBytesAvx2(const char* p, size_t n, unsigned char* out) {
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    bool valid0, valid1;
+    __m256i a = unhexDigits256(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 2 * i)),
+        valid0);
+    __m256i b = unhexDigits256(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 2 * i + 32)),
+        valid1);
+    if (!valid0 || !valid1) {
+      return false;
+    }
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(out + i),
+        _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xd8));
+  }
+  return unhexlifyBytesScalar(p + 2 * i, n - i, out + i);
+}
+
+#undef FOLLY_STRING_AVX2_INLINE
+#undef FOLLY_STRING_AVX2
+
+#endif // FOLLY_SIMD
+
+} // namespace
+
+namespace detail {
+
+size_t splitFindBytes(const char* p, size_t n, char c, uint32_t* out) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE2, splitFindBytes, Sse2);
+  return fn(p, n, c, out);
+}
+
+size_t splitCountBytes(const char* p, size_t n, char c) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE2, splitCountBytes, Sse2);
+  return fn(p, n, c);
+}
+
+size_t splitFindDelims(const char* p, size_t n, size_t avail,
+                       StringPiece delim, uint32_t* out) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE2, splitFindDelims, Sse2);
+  return fn(p, n, avail, delim, out);
+}
+
+size_t cEscapeSkip(const char* p, size_t n) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE2, cEscapeSkip, Sse2);
+  return fn(p, n);
+}
+
+size_t uriEscapeSkip(const char* p, size_t n, UriEscapeMode mode) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE2, uriEscapeSkip, Sse2);
+  return fn(p, n, mode);
+}
+
+size_t uriUnescapeSkip(const char* p, size_t n, UriEscapeMode mode) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE2, uriUnescapeSkip, Sse2);
+  return fn(p, n, mode);
+}
+
+void hexlifyBytes(const unsigned char* p, size_t n, char* out) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE2, hexlifyBytes, Sse2);
+  fn(p, n, out);
+}
+
+bool unhexlifyBytes(const char* p, size_t n, unsigned char* out) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE2, unhexlifyBytes, Sse2);
+  return fn(p, n, out);
+}
+
+} // namespace detail
+
+namespace {
+
+/*
+ * Writes to room preallocated in an IOBufQueue, as the String of the
+ * escaping functions.
+ */
+class PreallocatedOut {
+public:
+  explicit PreallocatedOut(void* p)
+    : begin_(static_cast<char*>(p)), end_(begin_) {}
+
+  size_t size() const { return end_ - begin_; }
+  void reserve(size_t) {}
+
+  void append(const char* s, size_t n) {
+    memcpy(end_, s, n);
+    end_ += n;
+  }
+  void push_back(char c) { *end_++ = c; }
+
+private:
+  char* begin_;
+  char* end_;
+};
+
+// Input bytes escaped at a time, into at most factor times as many
+const size_t kEscapeBlock = 4096;
+
+template <class Fn>
+void appendEscaped(StringPiece str, IOBufQueue& out, size_t factor, Fn fn) {
+  while (!str.empty()) {
+    StringPiece block = str.subpiece(0, kEscapeBlock);
+    size_t room = factor * block.size();
+    PreallocatedOut o(out.preallocate(room, room).first);
+    fn(block, o);
+    out.postallocate(o.size());
+    str.advance(block.size());
+  }
+}
+
+} // namespace
+
+void cEscape(StringPiece str, IOBufQueue& out) {
+  appendEscaped(str, out, 4, [](StringPiece block, PreallocatedOut& o) {
+    cEscape(block, o);
+  });
+}
+
+void uriEscape(StringPiece str, IOBufQueue& out, UriEscapeMode mode) {
+  appendEscaped(str, out, 3, [=](StringPiece block, PreallocatedOut& o) {
+    uriEscape(block, o, mode);
+  });
+}
+
+void uriUnescape(StringPiece str, IOBufQueue& out, UriEscapeMode mode) {
+  if (str.empty()) {
+    return;
+  }
+  // unescaped in one go, as sequences would span the blocks
+  PreallocatedOut o(out.preallocate(str.size(), str.size()).first);
+  uriUnescape(str, o, mode);
+  out.postallocate(o.size());
+}
+
+namespace detail {
+
+void hexlifyAppend(ByteRange input, IOBufQueue& output) {
+  while (!input.empty()) {
+    ByteRange block = input.subpiece(0, kEscapeBlock);
+    size_t room = 2 * block.size();
+    hexlifyBytes(block.data(), block.size(),
+                 static_cast<char*>(output.preallocate(room, room).first));
+    output.postallocate(room);
+    input.advance(block.size());
+  }
+}
+
+bool unhexlifyAppend(StringPiece input, IOBufQueue& output) {
+  if (input.size() % 2 != 0) {
+    return false;
+  }
+  size_t n = input.size() / 2;
+  if (n == 0) {
+    return true;
+  }
+  auto p = static_cast<unsigned char*>(output.preallocate(n, n).first);
+  if (!unhexlifyBytes(input.data(), n, p)) {
+    return false;
+  }
+  output.postallocate(n);
+  return true;
+}
+
+} // namespace detail
+
 namespace detail {
 
 size_t hexDumpLine(const void* ptr, size_t offset, size_t size,
@@ -45,6 +45,8 @@
 // with very little overhead if s was already std::string
 namespace folly {
 
+class IOBufQueue;
+
 inline
 std::string toStdString(const folly::fbstring& s) {
   return std::string(s.data(), s.size());
@@ -93,6 +95,11 @@ String cEscape(StringPiece str) {
   return out;
 }
 
+/**
+ * Similar to cEscape above, but appends the result to an IOBufQueue.
+ */
+void cEscape(StringPiece str, IOBufQueue& out);
+
 /**
  * C-Unescape a string; the opposite of cEscape above.  Appends the result
  * to the output string.
@@ -149,6 +156,13 @@ String uriEscape(StringPiece str, UriEscapeMode mode = UriEscapeMode::ALL) {
   return out;
 }
 
+/**
+ * Similar to uriEscape above, but appends the result to an IOBufQueue.
+ */
+void uriEscape(StringPiece str,
+               IOBufQueue& out,
+               UriEscapeMode mode = UriEscapeMode::ALL);
+
 /**
  * URI-unescape a string.  Appends the result to the output string.
  *
@@ -170,6 +184,14 @@ String uriUnescape(StringPiece str, UriEscapeMode mode = UriEscapeMode::ALL) {
   return out;
 }
 
+/**
+ * Similar to uriUnescape above, but appends the result to an IOBufQueue.
+ * Nothing is appended if str is invalid.
+ */
+void uriUnescape(StringPiece str,
+                 IOBufQueue& out,
+                 UriEscapeMode mode = UriEscapeMode::ALL);
+
 /**
  * stringPrintf is much like printf but deposits its result into a
  * string. Two signatures are supported: the first simply returns the
@@ -258,6 +280,12 @@ template<class InputString, class OutputString>
 bool hexlify(const InputString& input, OutputString& output,
              bool append=false);
 
+/**
+ * Similar to hexlify above, but appends the result to an IOBufQueue.
+ */
+template<class InputString>
+bool hexlify(const InputString& input, IOBufQueue& output);
+
 /**
  * Same functionality as Python's binascii.unhexlify.  Returns true
  * on successful conversion.
@@ -265,6 +293,13 @@ bool hexlify(const InputString& input, OutputString& output,
 template<class InputString, class OutputString>
 bool unhexlify(const InputString& input, OutputString& output);
 
+/**
+ * Similar to unhexlify above, but appends the result to an IOBufQueue.
+ * Nothing is appended on failure.
+ */
+template<class InputString>
+bool unhexlify(const InputString& input, IOBufQueue& output);
+
 /*
  * A pretty-printer for numbers that appends suffixes of units of the
  * given type.  It prints 4 sig-figs of value with the most
@@ -398,6 +433,9 @@ auto exceptionStr(const E& e)
 #endif
 }
 
+template<class T, std::size_t M, class A, class B, class C>
+class small_vector;
+
 /*
  * Split a string into a list of tokens by delimiter.
  *
@@ -446,6 +484,39 @@ void splitTo(const Delim& delimiter,
              OutputIterator out,
              bool ignoreEmpty = false);
 
+template<class Delim, class String, class OutputType,
+         std::size_t N, class A, class B, class C>
+void split(const Delim& delimiter,
+           const String& input,
+           small_vector<OutputType, N, A, B, C>& out,
+           bool ignoreEmpty = false);
+
+/*
+ * Call fn(StringPiece) on each of the tokens split() would output,
+ * without storing them.
+ *
+ *   folly::splitForEach('\t', line, [&](folly::StringPiece field) {
+ *     ...
+ *   });
+ *
+ * The delimiters are searched with SSE2 or AVX2 when available, by
+ * blocks of the input. When the delimiter is a character, split() into
+ * vectors first counts the tokens to reserve room for them.
+ */
+template<class Delim, class String, class Fn>
+void splitForEach(const Delim& delimiter,
+                  const String& input,
+                  Fn fn,
+                  bool ignoreEmpty = false);
+
+/*
+ * Number of tokens split() would output.
+ */
+template<class Delim, class String>
+size_t splitCount(const Delim& delimiter,
+                  const String& input,
+                  bool ignoreEmpty = false);
+
 /*
  * Split a string into a fixed number of string pieces and/or numeric types
  * by delimiter. Any numeric type that folly::to<> can convert to from a
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+
+#include <folly/ext/Unicode.h>
+
+#include <unicode/uchar.h>
+#include <unicode/uversion.h>
+
+// Generates the two-level lookup tables behind the folly::unicode
+// classification and simple case mapping functions, by asking ICU about
+// every code point. Regenerate when upgrading ICU.
+
+DEFINE_string(install_dir, ".",
+              "Directory to place output files in");
+DEFINE_string(fbcode_dir, "", "fbcode directory (ignored)");
+
+using namespace folly::detail;
+
+namespace {
+
+typedef std::tuple<uint32_t, int32_t, int32_t, uint8_t> Record;
+
+Record computeRecord(UChar32 cp) {
+  struct {
+    uint32_t flag;
+    bool value;
+  } flags[] = {
+    { kUnicodeAlpha, bool(u_isUAlphabetic(cp)) },
+    { kUnicodeJavaAlpha, bool(u_isalpha(cp)) },
+    { kUnicodeLower, bool(u_isULowercase(cp)) },
+    { kUnicodeJavaLower, bool(u_islower(cp)) },
+    { kUnicodeUpper, bool(u_isUUppercase(cp)) },
+    { kUnicodeJavaUpper, bool(u_isupper(cp)) },
+    { kUnicodeTitle, bool(u_istitle(cp)) },
+    { kUnicodePunct, bool(u_ispunct(cp)) },
+    { kUnicodeDigit, bool(u_isdigit(cp)) },
+    { kUnicodeXDigit, bool(u_isxdigit(cp)) },
+    { kUnicodeAlnum, bool(u_hasBinaryProperty(cp, UCHAR_POSIX_ALNUM)) },
+    { kUnicodeJavaAlnum, bool(u_isalnum(cp)) },
+    { kUnicodeSpace, bool(u_isspace(cp)) },
+    { kUnicodeJavaSpace, bool(u_isJavaSpaceChar(cp)) },
+    { kUnicodeWhitespace, bool(u_isUWhiteSpace(cp)) },
+    { kUnicodeJavaWhitespace, bool(u_isWhitespace(cp)) },
+    { kUnicodeBlank, bool(u_isblank(cp)) },
+    { kUnicodeCntrl, u_charType(cp) == U_CONTROL_CHAR },
+    { kUnicodeJavaCntrl, bool(u_iscntrl(cp)) },
+    { kUnicodeISOControl, bool(u_isISOControl(cp)) },
+    { kUnicodeGraph, bool(u_hasBinaryProperty(cp, UCHAR_POSIX_GRAPH)) },
+    { kUnicodeJavaGraph, bool(u_isgraph(cp)) },
+    { kUnicodePrint, bool(u_hasBinaryProperty(cp, UCHAR_POSIX_PRINT)) },
+    { kUnicodeJavaPrint, bool(u_isprint(cp)) },
+    { kUnicodeDefined, bool(u_isdefined(cp)) },
+    { kUnicodeBase, bool(u_isbase(cp)) },
+  };
+  uint32_t mask = 0;
+  for (auto& f : flags) {
+    if (f.value) {
+      mask |= f.flag;
+    }
+  }
+  auto ea = u_getIntPropertyValue(cp, UCHAR_EAST_ASIAN_WIDTH);
+  if (ea == U_EA_FULLWIDTH || ea == U_EA_WIDE) {
+    mask |= kUnicodeWide;
+  }
+  return Record(mask,
+                u_tolower(cp) - cp,
+                u_toupper(cp) - cp,
+                u_charType(cp));
+}
+
+template <class T>
+void writeArray(FILE* file, const char* decl, const std::vector<T>& v) {
+  CHECK_ERR(fprintf(file, "extern %s[] = {", decl));
+  for (size_t i = 0; i < v.size(); ++i) {
+    CHECK_ERR(fprintf(file, "%s%u,", i % 12 ? " " : "\n  ", unsigned(v[i])));
+  }
+  CHECK_ERR(fprintf(file, "\n};\n\n"));
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+
+  // Record 0 is returned for code points above U+10FFFF, it is the same as
+  // an unassigned code point.
+  std::vector<Record> records(1, Record(0, 0, 0, U_UNASSIGNED));
+  std::map<Record, uint16_t> recordIndex{{records[0], 0}};
+
+  std::vector<uint16_t> index1;
+  std::vector<uint16_t> index2;
+  std::map<std::vector<uint16_t>, uint16_t> blockIndex;
+
+  const size_t blockSize = 1 << kUnicodeShift;
+  for (UChar32 start = 0; start <= 0x10ffff; start += blockSize) {
+    std::vector<uint16_t> block;
+    for (UChar32 cp = start; cp < UChar32(start + blockSize); ++cp) {
+      Record r = computeRecord(cp);
+      auto it = recordIndex.find(r);
+      if (it == recordIndex.end()) {
+        CHECK_LT(records.size(), 0x10000);
+        it = recordIndex.emplace(r, records.size()).first;
+        records.push_back(r);
+      }
+      block.push_back(it->second);
+    }
+    auto it = blockIndex.find(block);
+    if (it == blockIndex.end()) {
+      CHECK_LT(index2.size() / blockSize, 0x10000);
+      it = blockIndex.emplace(block, index2.size() / blockSize).first;
+      index2.insert(index2.end(), block.begin(), block.end());
+    }
+    index1.push_back(it->second);
+  }
+
+  std::string name = FLAGS_install_dir + "/UnicodeTables.cpp";
+  FILE* file = fopen(name.c_str(), "w");
+  PCHECK(file);
+
+  CHECK_ERR(fprintf(file,
+      "/**\n"
+      " * Unicode property and simple case mapping tables, from ICU %s\n"
+      " * (Unicode %s).\n"
+      " *\n"
+      " * AUTOMATICALLY GENERATED.  DO NOT EDIT.\n"
+      " */\n"
+      "\n"
+      "#include <folly/ext/Unicode.h>\n"
+      "\n"
+      "namespace folly {\n"
+      "namespace detail {\n"
+      "\n",
+      U_ICU_VERSION, U_UNICODE_VERSION));
+
+  writeArray(file, "const uint16_t unicodeIndex1", index1);
+  writeArray(file, "const uint16_t unicodeIndex2", index2);
+
+  CHECK_ERR(fprintf(file,
+      "extern const UnicodeProperties unicodeProperties[] = {\n"));
+  for (auto& r : records) {
+    CHECK_ERR(fprintf(file, "  {0x%08x, %d, %d, %u},\n",
+                      std::get<0>(r), std::get<1>(r), std::get<2>(r),
+                      unsigned(std::get<3>(r))));
+  }
+  CHECK_ERR(fprintf(file, "};\n\n"));
+
+  CHECK_ERR(fprintf(file,
+      "}  // namespace detail\n"
+      "}  // namespace folly\n"));
+  CHECK_ERR(fclose(file));
+
+  return 0;
+}
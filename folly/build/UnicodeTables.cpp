@@ -0,0 +1,3840 @@
+/**
+ * Unicode property and simple case mapping tables, from ICU 72.1
+ * (Unicode 15.0).
+ *
+ * AUTOMATICALLY GENERATED.  DO NOT EDIT.
+ */
+
+#include <folly/ext/Unicode.h>
+
+namespace folly {
+namespace detail {
+
+extern const uint16_t unicodeIndex1[] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+  12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+  36, 37, 38, 39, 40, 35, 35, 35, 41, 42, 43, 44,
+  45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56,
+  57, 58, 59, 60, 61, 62, 63, 64, 65, 65, 66, 67,
+  68, 69, 70, 71, 72, 73, 74, 75, 70, 70, 65, 76,
+  65, 65, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+  87, 88, 89, 90, 91, 92, 85, 85, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 94,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 95, 93, 93, 93,
+  93, 93, 93, 93, 93, 96, 35, 35, 97, 98, 99, 100,
+  101, 102, 103, 104, 105, 106, 107, 108, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 109,
+  110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+  110, 110, 110, 110, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 93, 93, 112, 113, 114, 115,
+  35, 35, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
+  126, 127, 128, 129, 130, 131, 132, 133, 35, 35, 134, 135,
+  136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 126,
+  147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 126,
+  158, 159, 126, 160, 161, 162, 163, 126, 164, 165, 166, 167,
+  168, 169, 170, 126, 171, 172, 173, 174, 126, 175, 176, 177,
+  35, 35, 35, 35, 35, 35, 35, 178, 179, 35, 180, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 181, 35, 35, 35, 35,
+  35, 35, 35, 35, 182, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  35, 35, 35, 35, 183, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  35, 35, 35, 35, 184, 185, 186, 187, 126, 126, 126, 126,
+  188, 189, 190, 191, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 192, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 193, 194, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 195,
+  93, 93, 196, 93, 93, 197, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  198, 199, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 200, 201, 70, 202, 203, 204, 205, 206, 207, 126,
+  208, 209, 210, 211, 212, 213, 214, 215, 70, 70, 70, 70,
+  216, 217, 126, 126, 126, 126, 126, 126, 126, 126, 218, 126,
+  219, 220, 221, 126, 126, 222, 126, 126, 126, 223, 126, 126,
+  126, 126, 126, 224, 35, 225, 226, 126, 126, 126, 126, 126,
+  227, 228, 229, 126, 230, 231, 126, 126, 232, 233, 234, 235,
+  236, 126, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246,
+  247, 248, 249, 85, 250, 251, 70, 252, 126, 126, 126, 126,
+  126, 126, 126, 126, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 253, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 254, 93,
+  255, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 256, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 257, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 93, 93, 93, 93,
+  259, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 260,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 261, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 262,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+  258, 258, 258, 258, 258, 258, 258, 260, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 263, 126, 264, 265, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 266, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 266,
+};
+
+extern const uint16_t unicodeIndex2[] = {
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 3,
+  3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 4, 4, 4, 4, 5, 6, 6, 6,
+  7, 6, 6, 6, 8, 9, 6, 10, 6, 11, 6, 6,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6,
+  10, 10, 10, 6, 6, 13, 13, 13, 13, 13, 13, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 8, 6, 9, 15, 16,
+  15, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 8, 10, 9, 10, 1, 1, 1, 1, 1,
+  1, 19, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 20, 6, 7, 7, 7, 7, 21, 6,
+  15, 21, 22, 23, 10, 24, 21, 15, 21, 10, 25, 25,
+  15, 26, 6, 6, 15, 25, 22, 27, 25, 25, 25, 6,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 10,
+  14, 14, 14, 14, 14, 14, 14, 28, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 10, 18, 18, 18, 18,
+  18, 18, 18, 29, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 32, 33, 30, 31, 30, 31, 30, 31,
+  28, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30,
+  31, 30, 31, 30, 31, 28, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 34, 30, 31, 30, 31, 30, 31, 35,
+  36, 37, 30, 31, 30, 31, 38, 30, 31, 39, 39, 30,
+  31, 28, 40, 41, 42, 30, 31, 39, 43, 44, 45, 46,
+  30, 31, 47, 28, 45, 48, 49, 50, 30, 31, 30, 31,
+  30, 31, 51, 30, 31, 51, 28, 28, 30, 31, 51, 30,
+  31, 52, 52, 30, 31, 30, 31, 53, 30, 31, 28, 54,
+  30, 31, 28, 55, 54, 54, 54, 54, 56, 57, 58, 56,
+  57, 58, 56, 57, 58, 30, 31, 30, 31, 30, 31, 30,
+  31, 30, 31, 30, 31, 30, 31, 30, 31, 59, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 28, 56, 57, 58, 30, 31, 60, 61,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 62, 28, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  28, 28, 28, 28, 28, 28, 63, 30, 31, 64, 65, 66,
+  66, 30, 31, 67, 68, 69, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 70, 71, 72, 73, 74, 28, 75, 75,
+  28, 76, 28, 77, 78, 28, 28, 28, 75, 79, 28, 80,
+  28, 81, 82, 28, 83, 84, 82, 85, 86, 28, 28, 84,
+  28, 87, 88, 28, 28, 89, 28, 28, 28, 28, 28, 28,
+  28, 90, 28, 28, 91, 28, 92, 91, 28, 28, 28, 93,
+  91, 94, 95, 95, 96, 28, 28, 28, 28, 28, 97, 28,
+  54, 28, 28, 28, 28, 28, 28, 28, 28, 98, 99, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 101, 101, 101, 101, 101, 101, 101, 100, 100, 15, 15,
+  15, 15, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+  101, 101, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 100, 100, 100, 100, 100, 15, 15, 15,
+  15, 15, 15, 15, 101, 15, 101, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 103, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 30, 31, 30, 31, 101, 15, 30, 31,
+  0, 0, 100, 49, 49, 49, 6, 104, 0, 0, 0, 0,
+  15, 15, 105, 6, 106, 106, 106, 0, 107, 0, 108, 108,
+  28, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 109, 110, 110, 110, 28, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 111, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  112, 113, 113, 114, 115, 116, 117, 117, 117, 118, 119, 120,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  121, 122, 123, 124, 125, 126, 10, 30, 31, 127, 30, 31,
+  28, 62, 62, 62, 128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+  122, 122, 122, 122, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 21, 102, 102, 102, 102, 102, 129, 129, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 130, 30, 31, 30, 31, 30, 31, 30,
+  31, 30, 31, 30, 31, 30, 31, 131, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 0, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 0,
+  0, 101, 6, 6, 6, 6, 6, 6, 28, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 28,
+  28, 6, 11, 0, 0, 21, 21, 7, 0, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 11, 134, 6, 134, 134, 6,
+  134, 134, 6, 134, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 0, 0, 0, 0, 54, 54, 54, 54, 6,
+  6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  24, 24, 24, 24, 24, 24, 10, 10, 10, 6, 6, 7,
+  6, 6, 21, 21, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 6, 24, 6, 6, 6, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 101, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 102, 134, 134, 134, 134, 134, 134, 134,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6,
+  6, 6, 54, 54, 134, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 6, 54, 134, 134,
+  134, 134, 134, 134, 134, 24, 21, 102, 102, 134, 134, 134,
+  134, 101, 101, 134, 134, 21, 102, 102, 102, 134, 54, 54,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 54, 54,
+  54, 21, 21, 54, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 0, 24, 54, 134, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 0, 0, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 101, 101, 21, 6,
+  6, 6, 101, 0, 0, 102, 7, 7, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 134, 134, 102, 102, 101, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 101, 134, 134, 134,
+  101, 134, 134, 134, 134, 102, 0, 0, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 102, 102, 102, 0, 0, 6, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  15, 54, 54, 54, 54, 54, 54, 0, 24, 24, 0, 0,
+  0, 0, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 101, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 102, 102, 24, 134, 134, 134, 134, 134,
+  134, 134, 102, 102, 102, 102, 102, 102, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 135, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 134, 135,
+  102, 54, 135, 135, 135, 134, 134, 134, 134, 134, 134, 134,
+  134, 135, 135, 135, 135, 102, 135, 135, 54, 102, 102, 102,
+  102, 134, 134, 134, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 134, 134, 6, 6, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 6, 101, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 134, 135, 135,
+  0, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 54,
+  54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 54, 54, 54, 54, 54, 54, 54, 0, 54, 0,
+  0, 0, 54, 54, 54, 54, 0, 0, 102, 54, 135, 135,
+  135, 134, 134, 134, 134, 0, 0, 135, 135, 0, 0, 135,
+  135, 102, 54, 0, 0, 0, 0, 0, 0, 0, 0, 135,
+  0, 0, 0, 0, 54, 54, 0, 54, 54, 54, 134, 134,
+  0, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  54, 54, 7, 7, 25, 25, 25, 25, 25, 25, 21, 7,
+  54, 6, 102, 0, 0, 134, 134, 135, 0, 54, 54, 54,
+  54, 54, 54, 0, 0, 0, 0, 54, 54, 0, 0, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+  54, 54, 54, 54, 54, 0, 54, 54, 0, 54, 54, 0,
+  54, 54, 0, 0, 102, 0, 135, 135, 135, 134, 134, 0,
+  0, 0, 0, 134, 134, 0, 0, 134, 134, 102, 0, 0,
+  0, 134, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54,
+  54, 0, 54, 0, 0, 0, 0, 0, 0, 0, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 134, 134, 54, 54,
+  54, 134, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 134, 134, 135, 0, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 0, 54, 54, 54, 0, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54,
+  54, 0, 54, 54, 0, 54, 54, 54, 54, 54, 0, 0,
+  102, 54, 135, 135, 135, 134, 134, 134, 134, 134, 0, 134,
+  134, 135, 0, 135, 135, 102, 0, 0, 54, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 134, 134, 0, 0, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 6, 7, 0, 0, 0, 0, 0, 0,
+  0, 54, 134, 134, 134, 102, 102, 102, 0, 134, 135, 135,
+  0, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 54,
+  54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+  0, 54, 54, 54, 54, 54, 0, 0, 102, 54, 135, 134,
+  135, 134, 134, 134, 134, 0, 0, 135, 135, 0, 0, 135,
+  135, 102, 0, 0, 0, 0, 0, 0, 0, 102, 134, 135,
+  0, 0, 0, 0, 54, 54, 0, 54, 54, 54, 134, 134,
+  0, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  21, 54, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 134, 54, 0, 54, 54, 54,
+  54, 54, 54, 0, 0, 0, 54, 54, 54, 0, 54, 54,
+  54, 54, 0, 0, 0, 54, 54, 0, 54, 0, 54, 54,
+  0, 0, 0, 54, 54, 0, 0, 0, 54, 54, 54, 0,
+  0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 0, 0, 0, 0, 135, 135, 134, 135, 135, 0,
+  0, 0, 135, 135, 135, 0, 135, 135, 135, 102, 0, 0,
+  54, 0, 0, 0, 0, 0, 0, 135, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 25, 25, 25, 21,
+  21, 21, 21, 21, 21, 7, 21, 0, 0, 0, 0, 0,
+  134, 135, 135, 135, 134, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0,
+  102, 54, 134, 134, 134, 135, 135, 135, 135, 0, 134, 134,
+  134, 0, 134, 134, 134, 102, 0, 0, 0, 0, 0, 0,
+  0, 134, 134, 0, 54, 54, 54, 0, 0, 54, 0, 0,
+  54, 54, 134, 134, 0, 0, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 6,
+  25, 25, 25, 25, 25, 25, 25, 21, 54, 134, 135, 135,
+  6, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+  54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  0, 54, 54, 54, 54, 54, 0, 0, 102, 54, 135, 134,
+  135, 135, 135, 135, 135, 0, 134, 135, 135, 0, 135, 135,
+  134, 102, 0, 0, 0, 0, 0, 0, 0, 135, 135, 0,
+  0, 0, 0, 0, 0, 54, 54, 0, 54, 54, 134, 134,
+  0, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  0, 54, 54, 135, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 134, 134, 135, 135, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 0, 54, 54, 54, 0, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 102, 102, 54, 135, 135, 135, 134, 134, 134,
+  134, 0, 135, 135, 135, 0, 135, 135, 135, 102, 54, 21,
+  0, 0, 0, 0, 54, 54, 54, 135, 25, 25, 25, 25,
+  25, 25, 25, 54, 54, 54, 134, 134, 0, 0, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 21, 54, 54, 54, 54, 54, 54,
+  0, 134, 135, 135, 0, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  0, 54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 0,
+  0, 0, 102, 0, 0, 0, 0, 135, 135, 135, 134, 134,
+  134, 0, 134, 0, 135, 135, 135, 135, 135, 135, 135, 135,
+  0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 0, 0, 135, 135, 6, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 134, 54, 54,
+  134, 134, 134, 134, 134, 134, 134, 0, 0, 0, 0, 7,
+  54, 54, 54, 54, 54, 54, 101, 102, 102, 102, 102, 102,
+  102, 134, 102, 6, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 54, 54, 0, 54, 0, 54, 54,
+  54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 0, 54, 0, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 134, 54, 54, 134, 134, 134, 134,
+  134, 134, 102, 134, 134, 54, 0, 0, 54, 54, 54, 54,
+  54, 0, 101, 0, 102, 102, 102, 102, 102, 134, 102, 0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0,
+  54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 21, 21, 21, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 21, 6, 21, 21, 21,
+  102, 102, 21, 21, 21, 21, 21, 21, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 21, 102, 21, 102, 21, 102, 8, 9,
+  8, 9, 136, 136, 54, 54, 54, 54, 54, 54, 54, 54,
+  0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 0, 0, 0, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 135, 134, 134, 134, 134,
+  102, 6, 102, 102, 54, 54, 54, 54, 54, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 0, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 134, 0, 21, 21,
+  21, 21, 21, 21, 21, 21, 102, 21, 21, 21, 21, 21,
+  21, 0, 21, 21, 6, 6, 6, 6, 6, 21, 21, 21,
+  21, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 135,
+  135, 134, 134, 134, 134, 135, 134, 134, 134, 134, 134, 102,
+  135, 102, 102, 135, 135, 134, 134, 54, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 6, 6, 6, 6, 6, 6,
+  54, 54, 54, 54, 54, 54, 135, 135, 134, 134, 54, 54,
+  54, 54, 134, 134, 134, 54, 135, 135, 135, 54, 54, 135,
+  135, 135, 135, 135, 135, 135, 54, 54, 54, 134, 134, 134,
+  134, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 134, 135, 135, 134, 134, 135, 135, 135, 135, 135,
+  135, 134, 54, 135, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 135, 135, 135, 134, 21, 21, 137, 137, 137, 137,
+  137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+  137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+  137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 0, 137,
+  0, 0, 0, 0, 0, 137, 0, 0, 138, 138, 138, 138,
+  138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+  138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+  138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+  138, 138, 138, 6, 100, 138, 138, 138, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 54, 54, 54, 54, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 0, 54, 0, 54, 54, 54, 54, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+  54, 54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 0,
+  54, 0, 54, 54, 54, 54, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+  54, 54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  0, 102, 102, 102, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 0, 0, 0, 0, 0, 0, 140, 140, 140, 140,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 140, 114, 114, 114, 114, 114, 114, 0, 0,
+  120, 120, 120, 120, 120, 120, 0, 0, 11, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 21, 6, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  5, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 8, 9, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 6,
+  6, 6, 141, 141, 141, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 134, 134, 102, 136, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 134, 134,
+  136, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 134, 134, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+  54, 0, 134, 134, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 102, 102, 135, 134,
+  134, 134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 135,
+  135, 135, 134, 135, 135, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 6, 6, 6, 101, 6, 6, 6, 7,
+  54, 102, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 0, 0, 0, 0, 0, 0, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 6, 6, 6, 11, 6, 6, 6, 6, 102,
+  102, 102, 24, 102, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 101, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 134, 134, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 134, 54, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  134, 134, 134, 135, 135, 135, 135, 134, 134, 135, 135, 135,
+  0, 0, 0, 0, 135, 135, 134, 135, 135, 135, 135, 135,
+  135, 102, 102, 102, 0, 0, 0, 0, 21, 0, 0, 0,
+  6, 6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 0, 0, 54, 54, 54, 54,
+  54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 25, 0, 0, 0, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 134, 134, 135, 135, 134,
+  0, 0, 6, 6, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 135, 134, 135,
+  134, 134, 134, 134, 134, 134, 134, 0, 102, 135, 134, 135,
+  135, 134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 135,
+  135, 135, 135, 134, 134, 102, 102, 102, 102, 102, 102, 102,
+  102, 0, 0, 102, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 6, 6, 6, 6, 101, 6, 6, 6, 6,
+  6, 6, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 129, 134, 134, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 134, 134, 134, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  134, 134, 134, 134, 135, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 102, 135, 134, 134, 134, 134, 134, 135,
+  134, 135, 135, 135, 135, 135, 134, 135, 136, 54, 54, 54,
+  54, 54, 54, 54, 54, 0, 0, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 6, 6, 6, 6, 6, 6,
+  6, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 6, 6, 0, 134, 134, 135, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 135, 134, 134, 134, 134, 135, 135,
+  134, 134, 136, 102, 134, 134, 54, 54, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 102, 135, 134, 134, 135, 135, 135, 134, 135, 134,
+  134, 134, 136, 136, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 6, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 135, 135, 135, 135, 135, 135, 135, 135,
+  134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 134, 102,
+  0, 0, 0, 6, 6, 6, 6, 6, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 0, 0, 0, 54, 54, 54,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 101, 101, 101, 101, 101, 101, 6, 6,
+  142, 143, 144, 145, 145, 146, 147, 148, 149, 0, 0, 0,
+  0, 0, 0, 0, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 0,
+  0, 150, 150, 150, 6, 6, 6, 6, 6, 6, 6, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 102, 102, 102, 6,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 136, 102, 102, 102, 102, 102, 102, 102, 54, 54, 54,
+  54, 102, 54, 54, 54, 54, 54, 54, 102, 54, 54, 136,
+  102, 102, 54, 0, 0, 0, 0, 0, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 100, 151, 28, 28,
+  28, 152, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 153, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 28, 28, 28, 28, 28, 154,
+  28, 28, 155, 28, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 156, 156, 156, 156, 156, 156, 156, 156,
+  157, 157, 157, 157, 157, 157, 157, 157, 156, 156, 156, 156,
+  156, 156, 0, 0, 157, 157, 157, 157, 157, 157, 0, 0,
+  156, 156, 156, 156, 156, 156, 156, 156, 157, 157, 157, 157,
+  157, 157, 157, 157, 156, 156, 156, 156, 156, 156, 156, 156,
+  157, 157, 157, 157, 157, 157, 157, 157, 156, 156, 156, 156,
+  156, 156, 0, 0, 157, 157, 157, 157, 157, 157, 0, 0,
+  28, 156, 28, 156, 28, 156, 28, 156, 0, 157, 0, 157,
+  0, 157, 0, 157, 156, 156, 156, 156, 156, 156, 156, 156,
+  157, 157, 157, 157, 157, 157, 157, 157, 158, 158, 159, 159,
+  159, 159, 160, 160, 161, 161, 162, 162, 163, 163, 0, 0,
+  156, 156, 156, 156, 156, 156, 156, 156, 164, 164, 164, 164,
+  164, 164, 164, 164, 156, 156, 156, 156, 156, 156, 156, 156,
+  164, 164, 164, 164, 164, 164, 164, 164, 156, 156, 156, 156,
+  156, 156, 156, 156, 164, 164, 164, 164, 164, 164, 164, 164,
+  156, 156, 28, 165, 28, 0, 28, 28, 157, 157, 166, 166,
+  167, 15, 168, 15, 15, 15, 28, 165, 28, 0, 28, 28,
+  169, 169, 169, 169, 167, 15, 15, 15, 156, 156, 28, 28,
+  0, 0, 28, 28, 157, 157, 170, 170, 0, 15, 15, 15,
+  156, 156, 28, 28, 28, 123, 28, 28, 157, 157, 171, 171,
+  127, 15, 15, 15, 0, 0, 28, 165, 28, 0, 28, 28,
+  172, 172, 173, 173, 167, 15, 15, 0, 5, 5, 5, 5,
+  5, 5, 5, 20, 5, 5, 5, 24, 24, 24, 24, 24,
+  11, 11, 11, 11, 11, 11, 6, 6, 23, 27, 8, 23,
+  23, 27, 8, 23, 6, 6, 6, 6, 6, 6, 6, 6,
+  174, 175, 24, 24, 24, 24, 24, 20, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 23, 27, 6, 6, 6, 6, 16,
+  16, 6, 6, 6, 10, 8, 9, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 10, 6, 16, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 5, 24, 24, 24, 24,
+  24, 0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  25, 100, 0, 0, 25, 25, 25, 25, 25, 25, 10, 10,
+  10, 8, 9, 100, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 10, 10, 10, 8, 9, 0, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 0, 0, 0,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 129, 129, 129, 129, 102, 129, 129, 129, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  21, 21, 117, 21, 21, 21, 21, 117, 21, 21, 28, 117,
+  117, 117, 28, 28, 117, 117, 117, 28, 21, 117, 21, 21,
+  10, 117, 117, 117, 117, 117, 21, 21, 21, 21, 21, 21,
+  117, 21, 176, 21, 117, 21, 177, 178, 117, 117, 21, 28,
+  117, 117, 179, 117, 28, 54, 54, 54, 54, 28, 21, 21,
+  28, 28, 117, 117, 10, 10, 10, 10, 10, 117, 28, 28,
+  28, 28, 21, 10, 21, 21, 180, 21, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+  181, 181, 181, 181, 182, 182, 182, 182, 182, 182, 182, 182,
+  182, 182, 182, 182, 182, 182, 182, 182, 141, 141, 141, 30,
+  31, 141, 141, 141, 141, 25, 21, 21, 0, 0, 0, 0,
+  10, 10, 10, 10, 10, 21, 21, 21, 21, 21, 10, 10,
+  21, 21, 21, 21, 10, 21, 21, 10, 21, 21, 10, 21,
+  21, 21, 21, 21, 21, 21, 10, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 10, 10, 21, 21, 10, 21, 10, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  21, 21, 21, 21, 21, 21, 21, 21, 8, 9, 8, 9,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 183, 183, 21, 21, 21, 21, 10, 10, 21, 21,
+  21, 21, 21, 21, 21, 184, 185, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 10, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 10, 10, 10, 10, 10, 10, 21, 21,
+  21, 21, 21, 21, 21, 183, 183, 183, 183, 21, 21, 21,
+  183, 21, 21, 183, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 186, 186, 186, 186, 186, 186,
+  186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+  186, 186, 186, 186, 186, 186, 186, 186, 187, 187, 187, 187,
+  187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+  187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 10,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 10, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 10, 10, 10, 10, 10, 188, 188, 10,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 183, 183, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 10, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 183, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 183, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 183, 21, 21, 21, 21, 21, 21,
+  21, 21, 183, 183, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 183, 183, 21,
+  21, 21, 21, 21, 183, 183, 21, 21, 21, 21, 21, 21,
+  21, 21, 183, 21, 21, 21, 21, 21, 183, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 183, 21, 21, 21, 21, 21,
+  21, 21, 183, 183, 21, 183, 21, 21, 21, 21, 183, 21,
+  21, 183, 21, 21, 21, 21, 21, 21, 21, 183, 21, 21,
+  21, 21, 183, 183, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 183, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 183, 21, 183, 21,
+  21, 21, 21, 183, 183, 183, 21, 183, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9,
+  8, 9, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 21, 183, 183, 183,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  183, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 183, 10, 10, 10, 10, 10, 8, 9, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 8, 9, 8, 9, 8, 9,
+  8, 9, 8, 9, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 8,
+  9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8,
+  9, 8, 9, 8, 9, 8, 9, 8, 9, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  8, 9, 8, 9, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  8, 9, 10, 10, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 183, 183, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 21, 21, 10, 10, 10, 10, 10, 10, 21, 21, 21,
+  183, 21, 21, 21, 21, 183, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  0, 0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 132, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 30, 31, 189, 190,
+  191, 192, 193, 30, 31, 30, 31, 30, 31, 194, 195, 196,
+  197, 28, 30, 31, 28, 30, 31, 28, 28, 28, 28, 28,
+  100, 100, 198, 198, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 28, 21, 21, 21,
+  21, 21, 21, 30, 31, 30, 31, 102, 102, 102, 30, 31,
+  0, 0, 0, 0, 0, 6, 6, 6, 6, 25, 6, 6,
+  199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+  199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+  199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+  199, 199, 0, 199, 0, 0, 0, 0, 0, 199, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0,
+  0, 0, 0, 101, 6, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 102, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 0,
+  54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54,
+  54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 0,
+  54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54,
+  54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 0,
+  54, 54, 54, 54, 54, 54, 54, 0, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 6, 6, 23, 27, 23, 27, 6, 6,
+  6, 23, 27, 6, 23, 27, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 11, 6, 6, 11, 6, 23, 27, 6, 6,
+  23, 27, 8, 9, 8, 9, 8, 9, 8, 9, 6, 6,
+  6, 6, 6, 101, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 11, 11, 6, 6, 6, 6, 11, 6, 8, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  21, 21, 6, 6, 6, 8, 9, 8, 9, 8, 9, 8,
+  9, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 0, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 0, 0, 0, 0,
+  200, 201, 201, 201, 183, 202, 139, 203, 184, 185, 184, 185,
+  184, 185, 184, 185, 184, 185, 183, 183, 184, 185, 184, 185,
+  184, 185, 184, 185, 204, 184, 185, 185, 183, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 205, 205, 205, 205, 206, 206,
+  204, 202, 202, 202, 202, 202, 183, 183, 203, 203, 203, 202,
+  139, 201, 183, 21, 0, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 0, 0, 205, 205, 207,
+  207, 202, 202, 139, 204, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 201,
+  202, 202, 202, 139, 0, 0, 0, 0, 0, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 0, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 0, 183, 183, 208, 208, 208, 208, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 0, 208, 208, 208, 208, 208, 208, 208, 208,
+  208, 208, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 25, 25, 25, 25,
+  25, 25, 25, 25, 183, 208, 208, 208, 208, 208, 208, 208,
+  208, 208, 208, 208, 208, 208, 208, 208, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 208, 208, 208, 208, 208, 208, 208, 208,
+  208, 208, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 208, 208, 208, 208, 208, 208, 208,
+  208, 208, 208, 208, 208, 208, 208, 208, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 202, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 0, 0, 0, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  101, 101, 101, 101, 101, 101, 6, 6, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 101, 6, 6, 6,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 54, 102,
+  129, 129, 129, 6, 134, 134, 134, 134, 134, 134, 134, 134,
+  102, 102, 6, 101, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 100, 100, 134, 134,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 102, 102, 6, 6,
+  6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 101,
+  101, 101, 101, 101, 101, 101, 101, 101, 15, 15, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  28, 28, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 100, 28, 28, 28, 28, 28, 28, 28,
+  28, 30, 31, 30, 31, 209, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 101, 15, 15, 30, 31, 210, 28, 54,
+  30, 31, 30, 31, 211, 28, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 212, 213, 214, 215, 212, 28, 216, 217, 218, 219,
+  30, 31, 30, 31, 30, 31, 30, 31, 30, 31, 30, 31,
+  30, 31, 30, 31, 220, 221, 222, 30, 31, 30, 31, 0,
+  0, 0, 0, 0, 30, 31, 0, 28, 0, 28, 30, 31,
+  30, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 100, 100, 100, 30, 31, 54, 100, 100, 28, 54,
+  54, 54, 54, 54, 54, 54, 134, 54, 54, 54, 102, 54,
+  54, 54, 54, 134, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 135, 135, 134, 134, 135, 21, 21, 21, 21,
+  102, 0, 0, 0, 25, 25, 25, 25, 25, 25, 21, 21,
+  7, 21, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  135, 135, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 135, 135, 135, 135, 135, 135, 135, 135,
+  135, 135, 135, 135, 135, 135, 135, 135, 102, 134, 0, 0,
+  0, 0, 0, 0, 0, 0, 6, 6, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 54, 54, 54, 54, 54, 54,
+  6, 6, 6, 54, 6, 54, 54, 134, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 134, 134,
+  134, 134, 134, 102, 102, 102, 6, 6, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 135, 136, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 6, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 0, 0, 0, 134, 134, 134, 135, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 102, 135, 135, 134, 134,
+  134, 134, 135, 135, 134, 134, 135, 135, 136, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 101,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0,
+  0, 0, 6, 6, 54, 54, 54, 54, 54, 134, 101, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 54, 54, 54, 54, 54, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 134, 134, 134, 134, 134, 134, 135,
+  135, 134, 134, 135, 135, 134, 134, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 134, 54, 54, 54, 54,
+  54, 54, 54, 54, 134, 135, 0, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 0, 0, 6, 6, 6, 6,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 101, 54, 54, 54, 54, 54, 54, 21,
+  21, 21, 54, 135, 134, 135, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 134, 54, 134, 134,
+  134, 54, 54, 134, 134, 54, 54, 54, 54, 54, 134, 102,
+  54, 102, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 54, 54, 101, 6, 6, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 135, 134, 134, 135, 135,
+  6, 6, 54, 101, 101, 135, 102, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 0,
+  0, 54, 54, 54, 54, 54, 54, 0, 0, 54, 54, 54,
+  54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54,
+  54, 54, 54, 0, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 223, 28, 28, 28, 28, 28, 28, 28, 15,
+  100, 100, 100, 100, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 100, 15, 15, 0, 0, 0, 0, 224, 224, 224, 224,
+  224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+  224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+  224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+  224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+  224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+  224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+  224, 224, 224, 224, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 135, 135, 134, 135, 135, 134, 135, 135, 6,
+  136, 102, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 0, 0, 0, 0, 0, 0, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  0, 0, 0, 0, 225, 225, 225, 225, 225, 225, 225, 225,
+  225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+  225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+  225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+  225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+  225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+  225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+  225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+  225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+  225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+  225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 227, 227,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  28, 28, 28, 28, 28, 28, 28, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 28, 28, 28, 28, 28,
+  0, 0, 0, 0, 0, 54, 134, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 10, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54,
+  54, 0, 54, 0, 54, 54, 0, 54, 54, 0, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 9, 8, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 0, 0, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 7, 21, 21, 21, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  201, 201, 201, 201, 201, 201, 201, 184, 185, 201, 0, 0,
+  0, 0, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 201, 204, 204, 228,
+  228, 184, 185, 184, 185, 184, 185, 184, 185, 184, 185, 184,
+  185, 184, 185, 184, 185, 201, 201, 184, 185, 201, 201, 201,
+  201, 228, 228, 228, 201, 201, 201, 0, 201, 201, 201, 201,
+  204, 184, 185, 184, 185, 184, 185, 201, 201, 201, 188, 204,
+  188, 188, 188, 0, 201, 229, 201, 201, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 24,
+  0, 201, 201, 201, 229, 201, 201, 201, 184, 185, 201, 188,
+  201, 204, 201, 201, 230, 230, 230, 230, 230, 230, 230, 230,
+  230, 230, 201, 201, 188, 188, 188, 201, 201, 231, 231, 231,
+  231, 231, 231, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+  232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 184,
+  201, 185, 207, 228, 207, 233, 233, 233, 233, 233, 233, 234,
+  234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+  234, 234, 234, 234, 234, 234, 234, 184, 188, 185, 188, 184,
+  185, 6, 8, 9, 6, 6, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 101, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 101, 101, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  0, 0, 54, 54, 54, 54, 54, 54, 0, 0, 54, 54,
+  54, 54, 54, 54, 0, 0, 54, 54, 54, 54, 54, 54,
+  0, 0, 54, 54, 54, 0, 0, 0, 229, 229, 188, 207,
+  183, 229, 229, 0, 21, 10, 10, 10, 10, 21, 21, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 24, 24,
+  21, 21, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 0, 54, 54, 0, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 0, 0, 0, 0, 0, 6, 6, 6, 0,
+  0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  0, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 25, 25, 25, 25, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 25, 25, 21, 21, 21, 0, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0,
+  21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 102, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 102, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 141, 54, 54,
+  54, 54, 54, 54, 54, 54, 141, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 134, 134, 134, 134, 134, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 0, 6, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 6, 141, 141, 141,
+  141, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 235, 235, 235, 235,
+  235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+  235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+  235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+  236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+  236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+  236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+  236, 236, 236, 236, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0,
+  0, 0, 0, 0, 235, 235, 235, 235, 235, 235, 235, 235,
+  235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+  235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+  235, 235, 235, 235, 0, 0, 0, 0, 236, 236, 236, 236,
+  236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+  236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+  236, 236, 236, 236, 236, 236, 236, 236, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 6, 237, 237, 237, 237, 237, 237, 237, 237,
+  237, 237, 237, 0, 237, 237, 237, 237, 237, 237, 237, 237,
+  237, 237, 237, 237, 237, 237, 237, 0, 237, 237, 237, 237,
+  237, 237, 237, 0, 237, 237, 0, 238, 238, 238, 238, 238,
+  238, 238, 238, 238, 238, 238, 0, 238, 238, 238, 238, 238,
+  238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 0, 238,
+  238, 238, 238, 238, 238, 238, 0, 238, 238, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  100, 101, 101, 100, 100, 100, 0, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 0, 100, 100, 100, 100, 100, 100, 100, 100, 100, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 0, 0, 54, 0, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 0, 54, 54, 0, 0, 0, 54, 0, 0, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 6,
+  25, 25, 25, 25, 25, 25, 25, 25, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 21, 21, 25, 25, 25,
+  25, 25, 25, 25, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  0, 0, 0, 0, 0, 0, 0, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  54, 54, 0, 0, 0, 0, 0, 25, 25, 25, 25, 25,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 25, 25,
+  25, 25, 25, 25, 0, 0, 0, 6, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0,
+  0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 0, 0, 0, 0, 25, 25, 54, 54,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 0, 0, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 54, 134, 134, 134, 0, 134, 134, 0,
+  0, 0, 0, 0, 134, 134, 134, 134, 54, 54, 54, 54,
+  0, 54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0,
+  102, 102, 102, 0, 0, 0, 0, 102, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 25, 25, 6,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 25, 25, 25, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  21, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 102, 102, 0, 0, 0, 0, 25,
+  25, 25, 25, 25, 6, 6, 6, 6, 6, 6, 6, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0,
+  25, 25, 25, 25, 25, 25, 25, 25, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 0, 0, 0, 0, 0, 25, 25, 25, 25,
+  25, 25, 25, 25, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0,
+  0, 0, 0, 0, 0, 6, 6, 6, 6, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 25, 25,
+  25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+  112, 112, 112, 0, 0, 0, 0, 0, 0, 0, 25, 25,
+  25, 25, 25, 25, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 134, 134, 134, 134, 0, 0, 0, 0,
+  0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 0, 134, 134, 11, 0, 0, 54, 54, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 102, 102, 102, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 54, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 25, 25, 25, 25, 6, 6, 6, 6, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 102, 102, 102, 102, 6, 6, 6, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 25, 25, 25,
+  25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 135, 134, 135, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 102, 6, 6, 6, 6, 6,
+  6, 6, 0, 0, 0, 0, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  102, 54, 54, 134, 134, 54, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 102, 134, 134, 135, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 135, 135, 135, 134, 134, 134, 134, 135,
+  135, 102, 102, 6, 6, 24, 6, 6, 6, 6, 134, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0,
+  134, 134, 134, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 134, 134, 134, 134, 134, 135, 134, 134, 134,
+  134, 134, 134, 102, 102, 0, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 6, 6, 6, 6, 54, 135, 135, 54,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 102, 6, 6, 54, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 134, 134, 135, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 135,
+  135, 135, 134, 134, 134, 134, 134, 134, 134, 134, 134, 135,
+  136, 54, 54, 54, 54, 6, 6, 6, 6, 102, 102, 102,
+  102, 6, 135, 134, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 54, 6, 54, 6, 6, 6, 0, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  135, 135, 135, 134, 134, 134, 135, 135, 134, 136, 102, 134,
+  6, 6, 6, 6, 6, 6, 134, 54, 54, 134, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 0, 54, 0, 54, 54,
+  54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 6, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 134,
+  135, 135, 135, 134, 134, 134, 134, 134, 134, 102, 102, 0,
+  0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 0, 0, 0, 0, 0, 0, 134, 134, 135, 135,
+  0, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 54,
+  54, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+  0, 54, 54, 54, 54, 54, 0, 102, 102, 54, 135, 135,
+  134, 135, 135, 135, 135, 0, 0, 135, 135, 0, 0, 135,
+  135, 136, 0, 0, 54, 0, 0, 0, 0, 0, 0, 135,
+  0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 135, 135,
+  0, 0, 102, 102, 102, 102, 102, 102, 102, 0, 0, 0,
+  102, 102, 102, 102, 102, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 135, 135, 135,
+  134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 102, 134,
+  134, 135, 102, 54, 54, 54, 54, 6, 6, 6, 6, 6,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 6,
+  0, 6, 102, 54, 54, 54, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  135, 135, 135, 134, 134, 134, 134, 134, 134, 135, 134, 135,
+  135, 135, 135, 134, 134, 135, 102, 102, 54, 54, 6, 54,
+  0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 135, 135, 135, 134, 134,
+  134, 134, 0, 0, 135, 135, 135, 135, 134, 134, 135, 102,
+  102, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  54, 54, 54, 54, 134, 134, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 135, 135, 135, 134, 134, 134, 134, 134,
+  134, 134, 134, 135, 135, 134, 135, 102, 134, 6, 6, 6,
+  54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 134, 135, 134, 135, 135,
+  134, 134, 134, 134, 134, 134, 136, 102, 54, 6, 0, 0,
+  0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  0, 134, 134, 134, 135, 135, 134, 134, 134, 134, 135, 134,
+  134, 134, 134, 102, 0, 0, 0, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 25, 25, 6, 6, 6, 21,
+  54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  135, 135, 135, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  135, 102, 102, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54,
+  54, 54, 54, 0, 0, 54, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 0, 54, 54, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 135, 135, 135, 135,
+  135, 135, 0, 135, 135, 0, 0, 134, 134, 136, 102, 54,
+  135, 54, 135, 102, 6, 6, 6, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 135, 135, 135, 134, 134, 134, 134, 0, 0, 134, 134,
+  135, 135, 135, 135, 102, 54, 6, 54, 135, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 102, 102, 134, 134, 134, 134, 135, 54, 134,
+  134, 134, 134, 6, 6, 6, 6, 6, 6, 6, 6, 102,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 134, 134, 134,
+  134, 134, 134, 135, 135, 134, 134, 134, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 135, 102, 102, 6, 6,
+  6, 54, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 135,
+  134, 134, 134, 134, 134, 134, 134, 0, 134, 134, 134, 134,
+  134, 134, 135, 102, 54, 6, 6, 6, 6, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 0, 0, 0, 6, 6, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  0, 0, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  0, 135, 134, 134, 134, 134, 134, 134, 134, 135, 134, 134,
+  135, 134, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 0,
+  54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 134, 134, 134, 134, 134, 134, 0,
+  0, 0, 134, 0, 134, 134, 0, 134, 134, 134, 102, 134,
+  102, 102, 54, 134, 0, 0, 0, 0, 0, 0, 0, 0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 0, 54,
+  54, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 135, 135,
+  135, 135, 135, 0, 134, 134, 0, 135, 135, 134, 135, 102,
+  54, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 134, 134, 135, 135, 6, 6, 0, 0, 0,
+  0, 0, 0, 0, 134, 134, 54, 135, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 135, 135, 134, 134,
+  134, 134, 134, 0, 0, 0, 135, 135, 134, 136, 102, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 21, 21, 21, 21, 21, 21, 21, 21, 7, 7, 7,
+  7, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 6, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 0, 6, 6, 6, 6,
+  6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 102, 54, 54, 54,
+  54, 54, 54, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 6, 6,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 0, 0, 102, 102, 102, 102,
+  102, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  102, 102, 102, 102, 102, 102, 102, 6, 6, 6, 6, 6,
+  21, 21, 21, 21, 101, 101, 101, 101, 6, 21, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 0, 25, 25, 25, 25, 25,
+  25, 25, 0, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 6,
+  6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  0, 0, 0, 134, 54, 135, 135, 135, 135, 135, 135, 135,
+  135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+  135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+  135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+  135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+  0, 0, 0, 0, 0, 0, 0, 134, 134, 134, 134, 101,
+  101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 202, 202, 201, 202, 205, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 239, 239, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  0, 0, 0, 0, 0, 0, 0, 0, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 202, 202, 202, 202, 0, 202, 202, 202,
+  202, 202, 202, 202, 0, 202, 202, 0, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 139, 139, 139, 0, 0, 139, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  139, 139, 139, 139, 0, 0, 0, 0, 0, 0, 0, 0,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 0, 0, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0,
+  21, 102, 134, 6, 24, 24, 24, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 0, 0, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 136, 136, 102,
+  102, 102, 21, 21, 21, 136, 136, 136, 136, 136, 136, 24,
+  24, 24, 24, 24, 24, 24, 24, 102, 102, 102, 102, 102,
+  102, 102, 102, 21, 21, 102, 102, 102, 102, 102, 102, 102,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 102, 102, 102, 102, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 102, 102, 102, 21, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 0, 0, 0, 0, 0, 0, 0, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 28, 28, 28, 28, 28, 28, 28, 0, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 117, 0, 117, 117,
+  0, 0, 117, 0, 0, 117, 117, 0, 0, 117, 117, 117,
+  117, 0, 117, 117, 117, 117, 117, 117, 117, 117, 28, 28,
+  28, 28, 0, 28, 0, 28, 28, 28, 28, 28, 28, 28,
+  0, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 117, 117, 0, 117, 117, 117, 117, 0,
+  0, 117, 117, 117, 117, 117, 117, 117, 117, 0, 117, 117,
+  117, 117, 117, 117, 117, 0, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 117, 117, 0, 117,
+  117, 117, 117, 0, 117, 117, 117, 117, 117, 0, 117, 0,
+  0, 0, 117, 117, 117, 117, 117, 117, 117, 0, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 0, 0, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 10, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 10, 28, 28, 28, 28,
+  28, 28, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 10, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 10, 28, 28, 28, 28, 28, 28,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 10, 28, 28, 28, 28, 28, 28, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 10,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 10, 28, 28, 28, 28, 28, 28, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 10, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 10,
+  28, 28, 28, 28, 28, 28, 117, 28, 0, 0, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 21, 21, 21, 21, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 21, 21, 21, 21, 21, 21, 21, 21, 102, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  102, 21, 21, 6, 6, 6, 6, 6, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102,
+  102, 102, 102, 102, 0, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 54, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 0,
+  0, 0, 0, 0, 0, 28, 28, 28, 28, 28, 28, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  134, 134, 134, 134, 134, 134, 134, 0, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 0, 0, 134, 134, 134, 134, 134, 134, 134, 0, 134,
+  134, 0, 134, 134, 134, 134, 134, 0, 0, 0, 0, 0,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 134,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 0, 0, 0, 102, 102, 102, 102, 102, 102, 102, 101,
+  101, 101, 101, 101, 101, 101, 0, 0, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 54, 21,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 102, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  102, 102, 102, 102, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 101, 102, 102, 102, 102,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 0,
+  54, 54, 54, 54, 0, 54, 54, 0, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 102, 102, 102, 102,
+  102, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 240, 240, 240, 240,
+  240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+  240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+  240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241,
+  241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+  241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+  241, 241, 241, 241, 102, 102, 102, 134, 102, 102, 102, 101,
+  0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 21, 25, 25, 25,
+  7, 25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 21, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 54, 54, 54, 0, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  0, 54, 54, 0, 54, 0, 0, 54, 0, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54,
+  0, 54, 0, 54, 0, 0, 0, 0, 0, 0, 54, 0,
+  0, 0, 0, 54, 0, 54, 0, 54, 0, 54, 54, 54,
+  0, 54, 54, 0, 54, 0, 0, 54, 0, 54, 0, 54,
+  0, 54, 0, 54, 0, 54, 54, 0, 54, 0, 0, 54,
+  54, 54, 54, 0, 54, 54, 54, 54, 54, 54, 54, 0,
+  54, 54, 54, 54, 0, 54, 54, 54, 54, 0, 54, 0,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 0, 0, 0, 0, 0, 54, 54, 54,
+  0, 54, 54, 54, 54, 54, 0, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 10, 10, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 21, 21, 21, 21,
+  183, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 0, 0, 0, 0, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 0, 0, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 0, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 183,
+  0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+  242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+  242, 242, 21, 21, 21, 21, 21, 21, 242, 242, 242, 242,
+  242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+  242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 21, 21,
+  21, 21, 21, 21, 242, 242, 242, 242, 242, 242, 242, 242,
+  242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+  242, 242, 242, 242, 242, 242, 21, 21, 21, 21, 183, 21,
+  21, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 183, 183, 183, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 0, 0, 0, 0, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 0, 0, 0, 0, 0, 0, 0,
+  183, 183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 183, 183, 183, 183, 183, 183, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 21, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 21, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 21,
+  21, 21, 21, 183, 183, 183, 183, 183, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 21, 21, 21, 183, 21, 21, 21, 183, 183, 183, 207,
+  207, 207, 207, 207, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 21, 183, 21, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 21, 21, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 183,
+  183, 183, 183, 21, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 183, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 183, 183, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 183, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 21, 21, 21, 21, 21, 21,
+  183, 21, 21, 21, 183, 183, 183, 21, 21, 183, 183, 183,
+  0, 0, 0, 0, 183, 183, 183, 183, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 183, 183, 0, 0, 0,
+  21, 21, 21, 21, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 0, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 0, 0, 0, 0, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0, 0,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  0, 0, 0, 0, 183, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0,
+  0, 0, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 0, 0, 0, 0, 0, 0, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  0, 0, 0, 0, 0, 0, 0, 0, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 0, 0, 21, 21, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 21,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 21, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 0,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 0, 0, 0, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 0, 0, 0, 0, 0, 0, 0, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 183, 0, 183, 183, 183, 183, 183,
+  183, 183, 0, 0, 0, 0, 0, 0, 0, 0, 183, 183,
+  183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+  0, 0, 0, 0, 183, 183, 183, 183, 183, 183, 183, 183,
+  183, 0, 0, 0, 0, 0, 0, 0, 183, 183, 183, 183,
+  183, 183, 183, 183, 183, 0, 0, 0, 0, 0, 0, 0,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 0, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 0, 0, 0, 0, 0, 0, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 227, 227, 227, 227, 227, 227, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 227, 227, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 0,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 227, 227, 227, 227, 227, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+  227, 227, 227, 227, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+  226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 0, 0,
+};
+
+extern const UnicodeProperties unicodeProperties[] = {
+  {0x00000000, 0, 0, 0},
+  {0x010e0000, 0, 0, 15},
+  {0x010fd000, 0, 0, 15},
+  {0x010ed000, 0, 0, 15},
+  {0x010e9000, 0, 0, 15},
+  {0x01c1f000, 0, 0, 12},
+  {0x01f00080, 0, 0, 23},
+  {0x01f00000, 0, 0, 25},
+  {0x01f00080, 0, 0, 20},
+  {0x01f00080, 0, 0, 21},
+  {0x01f00000, 0, 0, 24},
+  {0x01f00080, 0, 0, 19},
+  {0x03f00f00, 0, 0, 9},
+  {0x03f00e33, 32, 0, 1},
+  {0x03f00c33, 32, 0, 1},
+  {0x01f00000, 0, 0, 26},
+  {0x01f00080, 0, 0, 22},
+  {0x03f00e0f, 0, -32, 2},
+  {0x03f00c0f, 0, -32, 2},
+  {0x010e5000, 0, 0, 15},
+  {0x01c17000, 0, 0, 12},
+  {0x01f00000, 0, 0, 27},
+  {0x03f00c07, 0, 0, 5},
+  {0x01f00080, 0, 0, 28},
+  {0x01540000, 0, 0, 16},
+  {0x03f00000, 0, 0, 11},
+  {0x03f00c0f, 0, 743, 2},
+  {0x01f00080, 0, 0, 29},
+  {0x03f00c0f, 0, 0, 2},
+  {0x03f00c0f, 0, 121, 2},
+  {0x03f00c33, 1, 0, 1},
+  {0x03f00c0f, 0, -1, 2},
+  {0x03f00c33, -199, 0, 1},
+  {0x03f00c0f, 0, -232, 2},
+  {0x03f00c33, -121, 0, 1},
+  {0x03f00c0f, 0, -300, 2},
+  {0x03f00c0f, 0, 195, 2},
+  {0x03f00c33, 210, 0, 1},
+  {0x03f00c33, 206, 0, 1},
+  {0x03f00c33, 205, 0, 1},
+  {0x03f00c33, 79, 0, 1},
+  {0x03f00c33, 202, 0, 1},
+  {0x03f00c33, 203, 0, 1},
+  {0x03f00c33, 207, 0, 1},
+  {0x03f00c0f, 0, 97, 2},
+  {0x03f00c33, 211, 0, 1},
+  {0x03f00c33, 209, 0, 1},
+  {0x03f00c0f, 0, 163, 2},
+  {0x03f00c33, 213, 0, 1},
+  {0x03f00c0f, 0, 130, 2},
+  {0x03f00c33, 214, 0, 1},
+  {0x03f00c33, 218, 0, 1},
+  {0x03f00c33, 217, 0, 1},
+  {0x03f00c33, 219, 0, 1},
+  {0x03f00c03, 0, 0, 5},
+  {0x03f00c0f, 0, 56, 2},
+  {0x03f00c33, 2, 0, 1},
+  {0x03f00c43, 1, -1, 3},
+  {0x03f00c0f, 0, -2, 2},
+  {0x03f00c0f, 0, -79, 2},
+  {0x03f00c33, -97, 0, 1},
+  {0x03f00c33, -56, 0, 1},
+  {0x03f00c33, -130, 0, 1},
+  {0x03f00c33, 10795, 0, 1},
+  {0x03f00c33, -163, 0, 1},
+  {0x03f00c33, 10792, 0, 1},
+  {0x03f00c0f, 0, 10815, 2},
+  {0x03f00c33, -195, 0, 1},
+  {0x03f00c33, 69, 0, 1},
+  {0x03f00c33, 71, 0, 1},
+  {0x03f00c0f, 0, 10783, 2},
+  {0x03f00c0f, 0, 10780, 2},
+  {0x03f00c0f, 0, 10782, 2},
+  {0x03f00c0f, 0, -210, 2},
+  {0x03f00c0f, 0, -206, 2},
+  {0x03f00c0f, 0, -205, 2},
+  {0x03f00c0f, 0, -202, 2},
+  {0x03f00c0f, 0, -203, 2},
+  {0x03f00c0f, 0, 42319, 2},
+  {0x03f00c0f, 0, 42315, 2},
+  {0x03f00c0f, 0, -207, 2},
+  {0x03f00c0f, 0, 42280, 2},
+  {0x03f00c0f, 0, 42308, 2},
+  {0x03f00c0f, 0, -209, 2},
+  {0x03f00c0f, 0, -211, 2},
+  {0x03f00c0f, 0, 10743, 2},
+  {0x03f00c0f, 0, 42305, 2},
+  {0x03f00c0f, 0, 10749, 2},
+  {0x03f00c0f, 0, -213, 2},
+  {0x03f00c0f, 0, -214, 2},
+  {0x03f00c0f, 0, 10727, 2},
+  {0x03f00c0f, 0, -218, 2},
+  {0x03f00c0f, 0, 42307, 2},
+  {0x03f00c0f, 0, 42282, 2},
+  {0x03f00c0f, 0, -69, 2},
+  {0x03f00c0f, 0, -217, 2},
+  {0x03f00c0f, 0, -71, 2},
+  {0x03f00c0f, 0, -219, 2},
+  {0x03f00c0f, 0, 42261, 2},
+  {0x03f00c0f, 0, 42258, 2},
+  {0x03f00c07, 0, 0, 4},
+  {0x03f00c03, 0, 0, 4},
+  {0x01f00000, 0, 0, 6},
+  {0x01f00405, 0, 84, 6},
+  {0x03f00c33, 116, 0, 1},
+  {0x03f00c33, 38, 0, 1},
+  {0x03f00c33, 37, 0, 1},
+  {0x03f00c33, 64, 0, 1},
+  {0x03f00c33, 63, 0, 1},
+  {0x03f00c0f, 0, -38, 2},
+  {0x03f00c0f, 0, -37, 2},
+  {0x03f00c0f, 0, -31, 2},
+  {0x03f00c0f, 0, -64, 2},
+  {0x03f00c0f, 0, -63, 2},
+  {0x03f00c33, 8, 0, 1},
+  {0x03f00c0f, 0, -62, 2},
+  {0x03f00c0f, 0, -57, 2},
+  {0x03f00c33, 0, 0, 1},
+  {0x03f00c0f, 0, -47, 2},
+  {0x03f00c0f, 0, -54, 2},
+  {0x03f00c0f, 0, -8, 2},
+  {0x03f00c0f, 0, -86, 2},
+  {0x03f00c0f, 0, -80, 2},
+  {0x03f00c0f, 0, 7, 2},
+  {0x03f00c0f, 0, -116, 2},
+  {0x03f00c33, -60, 0, 1},
+  {0x03f00c0f, 0, -96, 2},
+  {0x03f00c33, -7, 0, 1},
+  {0x03f00c33, 80, 0, 1},
+  {0x03f00000, 0, 0, 7},
+  {0x03f00c33, 15, 0, 1},
+  {0x03f00c0f, 0, -15, 2},
+  {0x03f00c33, 48, 0, 1},
+  {0x03f00c0f, 0, -48, 2},
+  {0x01f00401, 0, 0, 6},
+  {0x03f00401, 0, 0, 8},
+  {0x03f00000, 0, 0, 8},
+  {0x03f00c33, 7264, 0, 1},
+  {0x03f00c0f, 0, 3008, 2},
+  {0x07f00c03, 0, 0, 5},
+  {0x03f00c33, 38864, 0, 1},
+  {0x03f00401, 0, 0, 10},
+  {0x03f00c0f, 0, -6254, 2},
+  {0x03f00c0f, 0, -6253, 2},
+  {0x03f00c0f, 0, -6244, 2},
+  {0x03f00c0f, 0, -6242, 2},
+  {0x03f00c0f, 0, -6243, 2},
+  {0x03f00c0f, 0, -6236, 2},
+  {0x03f00c0f, 0, -6181, 2},
+  {0x03f00c0f, 0, 35266, 2},
+  {0x03f00c33, -3008, 0, 1},
+  {0x03f00c0f, 0, 35332, 2},
+  {0x03f00c0f, 0, 3814, 2},
+  {0x03f00c0f, 0, 35384, 2},
+  {0x03f00c0f, 0, -59, 2},
+  {0x03f00c33, -7615, 0, 1},
+  {0x03f00c0f, 0, 8, 2},
+  {0x03f00c33, -8, 0, 1},
+  {0x03f00c0f, 0, 74, 2},
+  {0x03f00c0f, 0, 86, 2},
+  {0x03f00c0f, 0, 100, 2},
+  {0x03f00c0f, 0, 128, 2},
+  {0x03f00c0f, 0, 112, 2},
+  {0x03f00c0f, 0, 126, 2},
+  {0x03f00c43, -8, 0, 3},
+  {0x03f00c0f, 0, 9, 2},
+  {0x03f00c33, -74, 0, 1},
+  {0x03f00c43, -9, 0, 3},
+  {0x03f00c0f, 0, -7205, 2},
+  {0x03f00c33, -86, 0, 1},
+  {0x03f00c33, -100, 0, 1},
+  {0x03f00c33, -112, 0, 1},
+  {0x03f00c33, -128, 0, 1},
+  {0x03f00c33, -126, 0, 1},
+  {0x0184f000, 0, 0, 13},
+  {0x0184f000, 0, 0, 14},
+  {0x03f00c33, -7517, 0, 1},
+  {0x03f00c33, -8383, 0, 1},
+  {0x03f00c33, -8262, 0, 1},
+  {0x03f00c33, 28, 0, 1},
+  {0x03f00c0f, 0, -28, 2},
+  {0x03f00411, 16, 0, 10},
+  {0x03f00405, 0, -16, 10},
+  {0x05f00000, 0, 0, 27},
+  {0x05f00080, 0, 0, 20},
+  {0x05f00080, 0, 0, 21},
+  {0x01f00411, 26, 0, 27},
+  {0x01f00405, 0, -26, 27},
+  {0x05f00000, 0, 0, 24},
+  {0x03f00c33, -10743, 0, 1},
+  {0x03f00c33, -3814, 0, 1},
+  {0x03f00c33, -10727, 0, 1},
+  {0x03f00c0f, 0, -10795, 2},
+  {0x03f00c0f, 0, -10792, 2},
+  {0x03f00c33, -10780, 0, 1},
+  {0x03f00c33, -10749, 0, 1},
+  {0x03f00c33, -10783, 0, 1},
+  {0x03f00c33, -10782, 0, 1},
+  {0x03f00c33, -10815, 0, 1},
+  {0x03f00c0f, 0, -7264, 2},
+  {0x05c1f000, 0, 0, 12},
+  {0x05f00080, 0, 0, 23},
+  {0x07f00c03, 0, 0, 4},
+  {0x07f00401, 0, 0, 10},
+  {0x05f00080, 0, 0, 19},
+  {0x05f00000, 0, 0, 6},
+  {0x07f00000, 0, 0, 8},
+  {0x05f00000, 0, 0, 26},
+  {0x07f00000, 0, 0, 11},
+  {0x03f00c33, -35332, 0, 1},
+  {0x03f00c33, -42280, 0, 1},
+  {0x03f00c0f, 0, 48, 2},
+  {0x03f00c33, -42308, 0, 1},
+  {0x03f00c33, -42319, 0, 1},
+  {0x03f00c33, -42315, 0, 1},
+  {0x03f00c33, -42305, 0, 1},
+  {0x03f00c33, -42258, 0, 1},
+  {0x03f00c33, -42282, 0, 1},
+  {0x03f00c33, -42261, 0, 1},
+  {0x03f00c33, 928, 0, 1},
+  {0x03f00c33, -48, 0, 1},
+  {0x03f00c33, -42307, 0, 1},
+  {0x03f00c33, -35384, 0, 1},
+  {0x03f00c0f, 0, -928, 2},
+  {0x03f00c0f, 0, -38864, 2},
+  {0x01000000, 0, 0, 18},
+  {0x01700000, 0, 0, 17},
+  {0x04000000, 0, 0, 0},
+  {0x05f00080, 0, 0, 22},
+  {0x05f00000, 0, 0, 25},
+  {0x07f00f00, 0, 0, 9},
+  {0x07f00e33, 32, 0, 1},
+  {0x07f00c33, 32, 0, 1},
+  {0x07f00e0f, 0, -32, 2},
+  {0x07f00c0f, 0, -32, 2},
+  {0x03f00c33, 40, 0, 1},
+  {0x03f00c0f, 0, -40, 2},
+  {0x03f00c33, 39, 0, 1},
+  {0x03f00c0f, 0, -39, 2},
+  {0x07f00401, 0, 0, 8},
+  {0x03f00c33, 34, 0, 1},
+  {0x03f00c0f, 0, -34, 2},
+  {0x01f00411, 0, 0, 27},
+};
+
+}  // namespace detail
+}  // namespace folly
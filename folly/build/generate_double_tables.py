@@ -0,0 +1,67 @@
+#!/usr/bin/env python
+#
+# Generate the tables of the shortest double formatting in Conv.cpp.
+# Copyright (C) 2015, Yeolar
+#
+# 128-bit approximations of the powers of 5 and of their inverses, as in
+# Ryu (Ulf Adams, "Ryu: fast float-to-string conversion", PLDI 2018),
+# split in (low, high) 64-bit halves.
+#
+import os
+from optparse import OptionParser
+
+OUTPUT_FILE = "DoubleTables.cpp"
+
+POW5_BITCOUNT = 125
+POW5_INV_BITCOUNT = 125
+POW5_TABLE_SIZE = 326
+POW5_INV_TABLE_SIZE = 342
+
+MASK64 = (1 << 64) - 1
+
+def pow5_values():
+    for i in range(POW5_TABLE_SIZE):
+        pow5 = 5 ** i
+        shift = pow5.bit_length() - POW5_BITCOUNT
+        yield pow5 >> shift if shift >= 0 else pow5 << -shift
+
+def pow5_inv_values():
+    for i in range(POW5_INV_TABLE_SIZE):
+        pow5 = 5 ** i
+        j = pow5.bit_length() - 1 + POW5_INV_BITCOUNT
+        yield (1 << j) // pow5 + 1
+
+def generate_table(f, name, values):
+    values = list(values)
+    f.write("extern const uint64_t {0}[{1}][2] = {{\n".format(
+        name, len(values)))
+    for v in values:
+        f.write("  {{ {0:#018x}u, {1:#018x}u }},\n".format(
+            v & MASK64, v >> 64))
+    f.write("};\n\n")
+
+def generate(f):
+    f.write("#include <cstdint>\n"
+            "\n"
+            "namespace folly {\n"
+            "namespace detail {\n"
+            "\n")
+
+    generate_table(f, "doublePow5Split", pow5_values())
+    generate_table(f, "doublePow5InvSplit", pow5_inv_values())
+
+    f.write("}  // namespace detail\n"
+            "}  // namespace folly\n")
+
+def main():
+    parser = OptionParser()
+    parser.add_option("--install_dir", dest="install_dir", default=".",
+                      help="write output to DIR", metavar="DIR")
+    parser.add_option("--fbcode_dir")
+    (options, args) = parser.parse_args()
+    f = open(os.path.join(options.install_dir, OUTPUT_FILE), "w")
+    generate(f)
+    f.close()
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,511 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/detail/JsonParser.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+#include <folly/Conv.h>
+#include <folly/detail/SimdDispatch.h>
+
+#if FOLLY_SIMD
+#include <immintrin.h>
+#endif
+
+namespace folly {
+namespace detail {
+
+namespace {
+
+///////////////////////////////////////////////////////////////////////////
+// Stage 1
+//
+// Each block of 64 bytes is classified into bit masks, one bit per byte,
+// from which the bits of the structural characters are computed with
+// integer operations, carrying the state of the end of the block to the
+// next (as simdjson does).
+
+struct BlockMasks {
+  uint64_t quote;
+  uint64_t backslash;
+  uint64_t op;      // {}[]:,
+  uint64_t space;   // ' ', '\t', '\n', '\r'
+};
+
+// Bit i of the result is the xor of bits 0 to i of x
+inline uint64_t prefixXor(uint64_t x) {
+  x ^= x << 1;
+  x ^= x << 2;
+  x ^= x << 4;
+  x ^= x << 8;
+  x ^= x << 16;
+  x ^= x << 32;
+  return x;
+}
+
+class StructuralIndexer {
+public:
+  explicit StructuralIndexer(uint32_t* out) : out_(out) {}
+
+  // Write the next positions to out, from offset on, keeping the state
+  void reset(uint32_t* out, uint32_t offset) {
+    out_ = out;
+    offset_ = offset;
+  }
+
+  void block(const BlockMasks& m, uint32_t base) {
+    const uint64_t even = 0x5555555555555555ULL;
+    const uint64_t odd = ~even;
+
+    // characters escaped: after a run of backslashes of odd length
+    uint64_t bs = m.backslash;
+    uint64_t starts = bs & ~(bs << 1);
+    uint64_t evenStartMask = even ^ oddBackslash_;
+    uint64_t evenStarts = starts & evenStartMask;
+    uint64_t oddStarts = starts & ~evenStartMask;
+    uint64_t evenCarries = bs + evenStarts;
+    uint64_t oddCarries = bs + oddStarts;
+    bool overflow = oddCarries < bs;
+    oddCarries |= oddBackslash_;
+    oddBackslash_ = overflow;
+    uint64_t escaped = (evenCarries & ~bs & odd) | (oddCarries & ~bs & even);
+
+    // strings: from an opening quote (included) to the closing one
+    uint64_t quotes = m.quote & ~escaped;
+    uint64_t inString = prefixXor(quotes) ^ inString_;
+    inString_ = uint64_t(int64_t(inString) >> 63);
+
+    // scalars start after a structural character or a space
+    uint64_t structural = (m.op & ~inString) | quotes;
+    uint64_t space = m.space & ~inString;
+    uint64_t pred = structural | space;
+    uint64_t scalars = ((pred << 1) | afterPred_) & ~space & ~inString;
+    afterPred_ = pred >> 63;
+    structural = (structural | scalars) & ~(quotes & ~inString);
+
+    while (structural) {
+      *out_++ = offset_ + base + __builtin_ctzll(structural);
+      structural &= structural - 1;
+    }
+  }
+
+  bool inString() const { return inString_ != 0; }
+
+  uint32_t* out() const { return out_; }
+
+private:
+  uint32_t* out_;
+  uint32_t offset_{0};
+  uint64_t oddBackslash_{0};
+  uint64_t inString_{0};
+  uint64_t afterPred_{1};
+};
+
+void classifyScalar(const char* p, BlockMasks& m) {
+  m = BlockMasks{0, 0, 0, 0};
+  for (int i = 0; i < 64; ++i) {
+    uint64_t bit = uint64_t(1) << i;
+    switch (p[i]) {
+      case '\"':
+        m.quote |= bit;
+        break;
+      case '\\':
+        m.backslash |= bit;
+        break;
+      case '{': case '}': case '[': case ']': case ':': case ',':
+        m.op |= bit;
+        break;
+      case ' ': case '\t': case '\n': case '\r':
+        m.space |= bit;
+        break;
+    }
+  }
+}
+
+void indexBlocksScalar(const char* p, size_t n, StructuralIndexer& ix) {
+  BlockMasks m;
+  for (size_t i = 0; i < n; ++i, p += 64) {
+    classifyScalar(p, m);
+    ix.block(m, i * 64);
+  }
+}
+
+#if FOLLY_SIMD
+
+// The classes of a byte are looked up by nibbles, and'ing the entries:
+// bit 0 ',' bit 1 ':' bit 2 "[]{}" bit 3 ' ' bit 4 "\t\n\r"
+#define FOLLY_JSON_LOW_NIBBLES \
+  8, 0, 0, 0, 0, 0, 0, 0, 0, 16, 18, 4, 1, 20, 0, 0
+#define FOLLY_JSON_HIGH_NIBBLES \
+  16, 0, 9, 2, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0
+
+///////////////////////////////////////////////////////////////////////////
+// SSSE3, build even if -mssse3 is not passed to GCC
+
+void classifySsse3(const char* p, BlockMasks& m)
+  __attribute__ ((__target__("ssse3")));
+void indexBlocksSsse3(const char* p, size_t n, StructuralIndexer& ix)
+  __attribute__ ((__target__("ssse3"), noinline));
+
+inline void classifySsse3(const char* p, BlockMasks& m) {
+  const __m128i low = _mm_setr_epi8(FOLLY_JSON_LOW_NIBBLES);
+  const __m128i high = _mm_setr_epi8(FOLLY_JSON_HIGH_NIBBLES);
+  const __m128i zero = _mm_setzero_si128();
+  m = BlockMasks{0, 0, 0, 0};
+  for (int i = 0; i < 4; ++i) {
+    __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * i));
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(in, 4), _mm_set1_epi8(0x0f));
+    __m128i cls = _mm_and_si128(_mm_shuffle_epi8(low, in),
+                                _mm_shuffle_epi8(high, hi));
+    uint64_t quote = _mm_movemask_epi8(
+      _mm_cmpeq_epi8(in, _mm_set1_epi8('\"')));
+    uint64_t backslash = _mm_movemask_epi8(
+      _mm_cmpeq_epi8(in, _mm_set1_epi8('\\')));
+    uint64_t op = _mm_movemask_epi8(
+      _mm_cmpeq_epi8(_mm_and_si128(cls, _mm_set1_epi8(7)), zero)) ^ 0xffff;
+    uint64_t space = _mm_movemask_epi8(
+      _mm_cmpeq_epi8(_mm_and_si128(cls, _mm_set1_epi8(0x18)), zero)) ^ 0xffff;
+    m.quote |= quote << (16 * i);
+    m.backslash |= backslash << (16 * i);
+    m.op |= op << (16 * i);
+    m.space |= space << (16 * i);
+  }
+}
+
+void indexBlocksSsse3(const char* p, size_t n, StructuralIndexer& ix) {
+  BlockMasks m;
+  for (size_t i = 0; i < n; ++i, p += 64) {
+    classifySsse3(p, m);
+    ix.block(m, i * 64);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////
+// AVX2
+
+void classifyAvx2(const char* p, BlockMasks& m)
+  __attribute__ ((__target__("avx2")));
+void indexBlocksAvx2(const char* p, size_t n, StructuralIndexer& ix)
+  __attribute__ ((__target__("avx2"), noinline));
+
+inline void classifyAvx2(const char* p, BlockMasks& m) {
+  const __m256i low = _mm256_setr_epi8(FOLLY_JSON_LOW_NIBBLES,
+                                       FOLLY_JSON_LOW_NIBBLES);
+  const __m256i high = _mm256_setr_epi8(FOLLY_JSON_HIGH_NIBBLES,
+                                        FOLLY_JSON_HIGH_NIBBLES);
+  const __m256i zero = _mm256_setzero_si256();
+  m = BlockMasks{0, 0, 0, 0};
+  for (int i = 0; i < 2; ++i) {
+    __m256i in =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32 * i));
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(in, 4),
+                                  _mm256_set1_epi8(0x0f));
+    __m256i cls = _mm256_and_si256(_mm256_shuffle_epi8(low, in),
+                                   _mm256_shuffle_epi8(high, hi));
+    uint64_t quote = uint32_t(_mm256_movemask_epi8(
+      _mm256_cmpeq_epi8(in, _mm256_set1_epi8('\"'))));
+    uint64_t backslash = uint32_t(_mm256_movemask_epi8(
+      _mm256_cmpeq_epi8(in, _mm256_set1_epi8('\\'))));
+    uint64_t op = ~uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+      _mm256_and_si256(cls, _mm256_set1_epi8(7)), zero)));
+    uint64_t space = ~uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+      _mm256_and_si256(cls, _mm256_set1_epi8(0x18)), zero)));
+    m.quote |= quote << (32 * i);
+    m.backslash |= backslash << (32 * i);
+    m.op |= op << (32 * i);
+    m.space |= space << (32 * i);
+  }
+}
+
+void indexBlocksAvx2(const char* p, size_t n, StructuralIndexer& ix) {
+  BlockMasks m;
+  for (size_t i = 0; i < n; ++i, p += 64) {
+    classifyAvx2(p, m);
+    ix.block(m, i * 64);
+  }
+}
+
+#undef FOLLY_JSON_LOW_NIBBLES
+#undef FOLLY_JSON_HIGH_NIBBLES
+
+#endif // FOLLY_SIMD
+
+///////////////////////////////////////////////////////////////////////////
+// Stage 2
+
+inline bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline bool isDelimiter(char c) {
+  switch (c) {
+    case ' ': case '\t': case '\n': case '\r':
+    case '{': case '}': case '[': case ']': case ':': case ',': case '\"':
+      return true;
+    default:
+      return false;
+  }
+}
+
+void indexRange(const char* p, size_t size, StructuralIndexer& ix);
+
+// The positions of up to kIndexChunk bytes are found at a time, when the
+// previous ones are consumed, so the index is bounded in size.
+constexpr size_t kIndexChunk = 16384;
+
+class StructuralParser {
+public:
+  StructuralParser(StringPiece json, uint32_t* index)
+    : json_(json)
+    , index_(index)
+    , ix_(index) {
+  }
+
+  bool parse(dynamic& out) {
+    return parseValue(out) && !available() && !ix_.inString();
+  }
+
+private:
+  // Whether there is a position at pos_, indexing the next chunk if needed
+  bool available() {
+    return pos_ < count_ || refill();
+  }
+
+  bool refill() {
+    while (pos_ == count_ && indexed_ < json_.size()) {
+      size_t size = std::min(json_.size() - indexed_, kIndexChunk);
+      ix_.reset(index_, indexed_);
+      indexRange(json_.data() + indexed_, size, ix_);
+      indexed_ += size;
+      pos_ = 0;
+      count_ = ix_.out() - index_;
+    }
+    return pos_ < count_;
+  }
+
+  char current() {
+    return available() ? json_[index_[pos_]] : '\0';
+  }
+
+  bool parseValue(dynamic& out) {
+    switch (current()) {
+      case '{': return parseObject(out);
+      case '[': return parseArray(out);
+      case '\"': {
+        fbstring s;
+        if (!parseString(s)) {
+          return false;
+        }
+        out = std::move(s);
+        return true;
+      }
+      default: return parseScalar(out);
+    }
+  }
+
+  bool parseObject(dynamic& out) {
+    ++pos_;
+    out = dynamic::object;
+    if (current() == '}') {
+      ++pos_;
+      return true;
+    }
+    for (;;) {
+      fbstring key;
+      if (current() != '\"' || !parseString(key) || current() != ':') {
+        return false;
+      }
+      ++pos_;
+      dynamic value = nullptr;
+      if (!parseValue(value)) {
+        return false;
+      }
+      out.insert(std::move(key), std::move(value));
+      char c = current();
+      ++pos_;
+      if (c == '}') {
+        return true;
+      }
+      if (c != ',') {
+        return false;
+      }
+    }
+  }
+
+  bool parseArray(dynamic& out) {
+    ++pos_;
+    out = {};
+    if (current() == ']') {
+      ++pos_;
+      return true;
+    }
+    for (;;) {
+      dynamic value = nullptr;
+      if (!parseValue(value)) {
+        return false;
+      }
+      out.push_back(std::move(value));
+      char c = current();
+      ++pos_;
+      if (c == ']') {
+        return true;
+      }
+      if (c != ',') {
+        return false;
+      }
+    }
+  }
+
+  bool parseString(fbstring& out) {
+    // Only spaces are between the closing quote and the next structural
+    // character
+    size_t begin = index_[pos_] + 1;
+    ++pos_;
+    size_t end = available() ? index_[pos_] : json_.size();
+    do {
+      --end;
+    } while (isSpace(json_[end]));
+    if (json_[end] != '\"' || end < begin) {
+      return false;
+    }
+    StringPiece sp(json_.begin() + begin, json_.begin() + end);
+    if (memchr(sp.begin(), '\0', sp.size())) {
+      return false;
+    }
+    if (!memchr(sp.begin(), '\\', sp.size())) {
+      out.assign(sp.begin(), sp.size());
+      return true;
+    }
+    return jsonUnescape(sp, out) == nullptr;
+  }
+
+  bool parseScalar(dynamic& out) {
+    if (!available()) {
+      return false;
+    }
+    const char* p = json_.begin() + index_[pos_++];
+    const char* e = p;
+    while (e != json_.end() && !isDelimiter(*e)) {
+      ++e;
+    }
+    StringPiece sp(p, e);
+    if (sp == "true" || sp == "false") {
+      out = sp[0] == 't';
+      return true;
+    }
+    if (sp == "null") {
+      out = nullptr;
+      return true;
+    }
+
+    // -?[0-9]+(\.[0-9]*)?([eE][+-]?[0-9]*)?, as parseJson() reads it
+    bool negative = *p == '-';
+    if (negative) {
+      ++p;
+    }
+    const char* digits = p;
+    uint64_t value = 0;
+    while (p != e && *p >= '0' && *p <= '9') {
+      value = value * 10 + (*p++ - '0');
+    }
+    if (p == digits) {
+      return false;
+    }
+    if (p == e) {
+      if (p - digits <= 18) {
+        out = negative ? -int64_t(value) : int64_t(value);
+      } else {
+        out = to<int64_t>(sp);
+      }
+      return true;
+    }
+    if (*p == '.') {
+      ++p;
+      while (p != e && *p >= '0' && *p <= '9') {
+        ++p;
+      }
+    }
+    if (p != e && (*p == 'e' || *p == 'E')) {
+      ++p;
+      if (p != e && (*p == '+' || *p == '-')) {
+        ++p;
+      }
+      while (p != e && *p >= '0' && *p <= '9') {
+        ++p;
+      }
+    }
+    if (p != e) {
+      return false;
+    }
+    out = to<double>(sp);
+    return true;
+  }
+
+  StringPiece json_;
+  uint32_t* index_;
+  StructuralIndexer ix_;
+  size_t indexed_{0};   // bytes of json_ indexed
+  size_t count_{0};     // positions in index_
+  size_t pos_{0};
+};
+
+// Only the last block of a range may be partial: it is padded with spaces
+void indexRange(const char* p, size_t size, StructuralIndexer& ix) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSSE3, indexBlocks, Ssse3);
+  size_t blocks = size / 64;
+  fn(p, blocks, ix);
+  size_t tail = size % 64;
+  if (tail > 0) {
+    char block[64];
+    memset(block, ' ', sizeof(block));
+    memcpy(block, p + blocks * 64, tail);
+    BlockMasks m;
+    classifyScalar(block, m);
+    ix.block(m, blocks * 64);
+  }
+}
+
+} // namespace anon
+
+ssize_t jsonStructuralIndex(StringPiece json, uint32_t* out) {
+  StructuralIndexer ix(out);
+  indexRange(json.data(), json.size(), ix);
+  return ix.inString() ? -1 : ix.out() - out;
+}
+
+bool parseJsonStructural(StringPiece json, dynamic& out) {
+  if (json.size() > std::numeric_limits<uint32_t>::max()) {
+    return false;
+  }
+  // a position per byte at most
+  uint32_t small[256];
+  std::unique_ptr<uint32_t[]> large;
+  uint32_t* index = small;
+  if (json.size() > 256) {
+    large.reset(new uint32_t[std::min(json.size(), kIndexChunk)]);
+    index = large.get();
+  }
+  try {
+    return StructuralParser(json, index).parse(out);
+  } catch (const std::range_error&) {
+    return false;   // number out of range, the fallback reports it
+  }
+}
+
+} // namespace detail
+} // namespace folly
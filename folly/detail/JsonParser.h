@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOLLY_DETAIL_JSONPARSER_H_
+#define FOLLY_DETAIL_JSONPARSER_H_
+
+#include <cstring>
+#include <sys/types.h>
+
+#include <folly/Range.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+
+namespace folly {
+namespace detail {
+
+/*
+ * parseJson() runs in two stages. The first one, vectorized, finds the
+ * structural characters of the text ({}[]:, outside strings), the
+ * opening quotes of strings and the first characters of the other
+ * scalars, 64 bytes at a time. The second one builds the dynamic from
+ * these positions, without looking at the bytes in between but to
+ * decode strings and scalars. The first stage runs on a chunk of the
+ * text at a time, when the second one has consumed the positions of the
+ * previous chunk, so the index takes the same memory for any size.
+ *
+ * The second stage only accepts standard JSON; for anything else (errors
+ * included) parseJson() falls back on the recursive descent parser,
+ * which accepts the extensions of serialization_opts, or reports the
+ * error.
+ */
+
+/**
+ * Write the positions of the structural characters of json to out,
+ * which has room for json.size() of them. Returns their number, -1 if
+ * a string is not terminated.
+ */
+ssize_t jsonStructuralIndex(StringPiece json, uint32_t* out);
+
+/**
+ * Parse json with the structural index, false if it is not standard
+ * JSON (or is over 4GB).
+ */
+bool parseJsonStructural(StringPiece json, dynamic& out);
+
+/**
+ * The recursive descent parser.
+ */
+dynamic parseJsonRecursive(StringPiece json,
+                           const json::serialization_opts& opts);
+
+/**
+ * Decode the escapes of the contents of a JSON string into out (cleared
+ * first). Returns the error message if there is an invalid one.
+ */
+template <class String>
+const char* jsonUnescape(StringPiece in, String& out) {
+  auto readHex = [](const char*& p, const char* e, uint32_t& value) {
+    if (e - p < 4) {
+      return false;
+    }
+    value = 0;
+    for (int i = 0; i < 4; ++i, ++p) {
+      char c = *p;
+      value <<= 4;
+      if (c >= '0' && c <= '9') {
+        value |= c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        value |= c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        value |= c - 'A' + 10;
+      } else {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  out.clear();
+  const char* p = in.begin();
+  const char* e = in.end();
+  while (p != e) {
+    auto q = static_cast<const char*>(memchr(p, '\\', e - p));
+    if (!q) {
+      out.append(p, e);
+      break;
+    }
+    out.append(p, q);
+    p = q + 1;
+    if (p == e) {
+      return "unterminated string";
+    }
+    switch (*p++) {
+      case '\"': out.push_back('\"'); break;
+      case '\\': out.push_back('\\'); break;
+      case '/':  out.push_back('/');  break;
+      case 'b':  out.push_back('\b'); break;
+      case 'f':  out.push_back('\f'); break;
+      case 'n':  out.push_back('\n'); break;
+      case 'r':  out.push_back('\r'); break;
+      case 't':  out.push_back('\t'); break;
+      case 'u': {
+        uint32_t cp;
+        if (!readHex(p, e, cp)) {
+          return "expected 4 hex digits";
+        }
+        if (cp >= 0xd800 && cp <= 0xdbff) {
+          uint32_t second;
+          if (e - p < 2 || p[0] != '\\' || p[1] != 'u') {
+            return "expected another unicode escape for second half of "
+              "surrogate pair";
+          }
+          p += 2;
+          if (!readHex(p, e, second)) {
+            return "expected 4 hex digits";
+          }
+          if (second < 0xdc00 || second > 0xdfff) {
+            return "second character in surrogate pair is invalid";
+          }
+          cp = 0x10000 + ((cp & 0x3ff) << 10) + (second & 0x3ff);
+        } else if (cp >= 0xdc00 && cp <= 0xdfff) {
+          return "invalid unicode code point (in range [0xdc00,0xdfff])";
+        }
+        if (cp < 0x80) {
+          out.push_back(cp);
+        } else if (cp < 0x800) {
+          out.push_back(0xc0 | (cp >> 6));
+          out.push_back(0x80 | (cp & 0x3f));
+        } else if (cp < 0x10000) {
+          out.push_back(0xe0 | (cp >> 12));
+          out.push_back(0x80 | ((cp >> 6) & 0x3f));
+          out.push_back(0x80 | (cp & 0x3f));
+        } else {
+          out.push_back(0xf0 | (cp >> 18));
+          out.push_back(0x80 | ((cp >> 12) & 0x3f));
+          out.push_back(0x80 | ((cp >> 6) & 0x3f));
+          out.push_back(0x80 | (cp & 0x3f));
+        }
+        break;
+      }
+      default:
+        return "unknown escape in string";
+    }
+  }
+  return nullptr;
+}
+
+} // namespace detail
+} // namespace folly
+
+#endif /* FOLLY_DETAIL_JSONPARSER_H_ */
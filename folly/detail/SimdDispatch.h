@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOLLY_DETAIL_SIMDDISPATCH_H_
+#define FOLLY_DETAIL_SIMDDISPATCH_H_
+
+#include <cstdint>
+
+#include <folly/CpuId.h>
+#include <folly/Portability.h>
+
+/**
+ * Runtime dispatch of vectorized kernels.
+ *
+ * A kernel comes in a scalar version, a 128-bit version for some SSE level
+ * and an AVX2 version. The vector versions are compiled with
+ * __attribute__((__target__(...))), so no -m flag is needed, and only
+ * #if FOLLY_SIMD. The best version the CPU supports is picked once, e.g.
+ *
+ *   static auto const fn = FOLLY_SIMD_KERNEL(SSE42, utf8Count, Sse42);
+ *
+ * chooses among utf8CountScalar, utf8CountSse42 and utf8CountAvx2.
+ */
+#if FOLLY_X64 && FOLLY_HAVE_EMMINTRIN_H && __GNUC_PREREQ(4, 9)
+#define FOLLY_SIMD 1
+#endif
+
+namespace folly { namespace detail {
+
+enum class SimdLevel { NONE, SSE2, SSSE3, SSE42, AVX2 };
+
+#if FOLLY_SIMD
+/**
+ * XCR0, the state components the OS saves: bit 1 is SSE, bit 2 is AVX.
+ * Only valid if CpuId::osxsave().
+ */
+inline uint64_t xgetbv0() {
+  uint32_t eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (uint64_t(edx) << 32) | eax;
+}
+#endif
+
+/**
+ * Whether kernels of the given level may run: they are built and the CPU
+ * supports them. NONE, the scalar kernels, are always supported.
+ */
+inline bool simdLevelSupported(SimdLevel level) {
+#if FOLLY_SIMD
+  CpuId id;
+  switch (level) {
+    case SimdLevel::NONE: return true;
+    case SimdLevel::SSE2: return id.sse2();
+    case SimdLevel::SSSE3: return id.ssse3();
+    case SimdLevel::SSE42: return id.sse42();
+    case SimdLevel::AVX2:
+      // the OS must also save the ymm registers across context switches
+      return id.avx2() && id.osxsave() && (xgetbv0() & 6) == 6;
+  }
+  return false;
+#else
+  return level == SimdLevel::NONE;
+#endif
+}
+
+/**
+ * The AVX2 kernel if supported, else the 128-bit kernel if its level is
+ * supported, else the scalar kernel.
+ */
+template <class Fn>
+Fn chooseKernel(SimdLevel level, Fn scalar, Fn sse, Fn avx2) {
+  if (simdLevelSupported(SimdLevel::AVX2)) {
+    return avx2;
+  }
+  if (simdLevelSupported(level)) {
+    return sse;
+  }
+  return scalar;
+}
+
+}}  // namespaces
+
+#if FOLLY_SIMD
+#define FOLLY_SIMD_KERNEL(level, name, suffix)                        \
+  ::folly::detail::chooseKernel(::folly::detail::SimdLevel::level,    \
+                                name##Scalar, name##suffix, name##Avx2)
+#else
+#define FOLLY_SIMD_KERNEL(level, name, suffix) name##Scalar
+#endif
+
+#endif /* FOLLY_DETAIL_SIMDDISPATCH_H_ */
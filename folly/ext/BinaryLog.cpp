@@ -0,0 +1,399 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/ext/BinaryLog.h>
+
+#if !(FOLLY_HAVE_LIBGLOG && FOLLY_USE_GLOG)
+
+#include <cstdarg>
+#include <ctime>
+#include <mutex>
+#include <stdexcept>
+
+
+namespace folly {
+namespace logging {
+
+namespace {
+
+static LogWriter* binaryLogger = nullptr;
+
+struct FormatRegistry {
+  std::mutex registerLock;    // serializes registration
+  std::mutex formatsLock;     // guards formats
+  std::vector<LogFormat*> formats;
+};
+
+FormatRegistry& formatRegistry() {
+  static FormatRegistry* registry = new FormatRegistry();
+  return *registry;
+}
+
+size_t encodeSessionRecord(char* buf, size_t size) {
+  detail::BinaryEncoder encoder(buf, size);
+  encoder.putRaw(uint32_t(detail::kRecordHeaderSize + 2 * sizeof(uint32_t)));
+  encoder.putRaw(detail::kSessionId);
+  encoder.putRaw(detail::kBinaryLogMagic);
+  encoder.putRaw(detail::kBinaryLogVersion);
+  return encoder.size();
+}
+
+size_t encodeFormatRecord(const LogFormat* format,
+                          uint32_t id,
+                          char* buf,
+                          size_t size) {
+  const char* file = strrchr(format->file, '/');
+  file = file ? file + 1 : format->file;
+  detail::BinaryEncoder encoder(buf, size - 2);
+  encoder.putRaw(uint32_t(0));
+  encoder.putRaw(id | detail::kFormatBit);
+  encoder.putRaw(uint32_t(format->level));
+  encoder.putRaw(uint32_t(format->line));
+  size_t len = encoder.size();
+  size_t n = std::min(strlen(file), size - 2 - len);
+  memcpy(buf + len, file, n);
+  len += n;
+  buf[len++] = '\0';
+  n = std::min(strlen(format->format), size - 1 - len);
+  memcpy(buf + len, format->format, n);
+  len += n;
+  buf[len++] = '\0';
+  uint32_t recordSize = len;
+  memcpy(buf, &recordSize, sizeof(recordSize));
+  return len;
+}
+
+// A rotated or reopened file starts with a new session and all formats
+// known so far, so that it can be decoded on its own.
+void writeFileHeader() {
+  FormatRegistry& registry = formatRegistry();
+  std::lock_guard<std::mutex> guard(registry.formatsLock);
+  char buf[BUF_SIZE];
+  binaryLogger->writeDirect(buf, encodeSessionRecord(buf, BUF_SIZE));
+  for (size_t i = 0; i < registry.formats.size(); ++i) {
+    binaryLogger->writeDirect(
+        buf, encodeFormatRecord(registry.formats[i], i + 1, buf, BUF_SIZE));
+  }
+}
+
+template <class T>
+T readRaw(const char*& p, const char* end) {
+  if (size_t(end - p) < sizeof(T)) {
+    throw std::runtime_error("truncated binary log record");
+  }
+  T value;
+  memcpy(&value, p, sizeof(T));
+  p += sizeof(T);
+  return value;
+}
+
+std::string readCString(const char*& p, const char* end) {
+  auto q = static_cast<const char*>(memchr(p, '\0', end - p));
+  if (!q) {
+    throw std::runtime_error("unterminated string in binary log record");
+  }
+  std::string str(p, q);
+  p = q + 1;
+  return str;
+}
+
+void appendf(std::string& out, const char* format, ...)
+  FOLLY_PRINTF_FORMAT_ATTR(2, 3);
+
+void appendf(std::string& out, const char* format, ...) {
+  char buf[BUF_SIZE];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (n > 0) {
+    out.append(buf, std::min(size_t(n), sizeof(buf) - 1));
+  }
+}
+
+// Append the time of timestamp (ns since epoch) as in LogMessage
+void appendTimestamp(std::string& out, uint64_t timestamp) {
+  char buf[64];
+  time_t t = timestamp / 1000000000;
+  struct tm tm;
+  localtime_r(&t, &tm);
+  size_t n = strftime(buf, sizeof(buf), "%y%m%d %T", &tm);
+  appendf(out, "%.*s.%06u", int(n), buf,
+          unsigned(timestamp % 1000000000 / 1000));
+}
+
+// Read the integer argument of a '*' width or precision, 0 if missing
+int64_t readStarArg(const char*& p, const char* end) {
+  if (p == end) {
+    return 0;
+  }
+  uint8_t tag = readRaw<uint8_t>(p, end);
+  if (tag != detail::kArgInt && tag != detail::kArgUInt) {
+    throw std::runtime_error(
+        "binary log argument of a '*' width or precision is not an int");
+  }
+  return readRaw<int64_t>(p, end);
+}
+
+std::string formatError(const char* format, ...)
+  FOLLY_PRINTF_FORMAT_ATTR(1, 2);
+
+std::string formatError(const char* format, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  return buf;
+}
+
+} // namespace anon
+
+namespace detail {
+
+void BinaryEncoder::putString(const char* data, size_t size) {
+  size_t avail = end_ - pos_;
+  if (avail < 1 + sizeof(uint16_t)) {
+    return;
+  }
+  uint16_t len = std::min(size, avail - 1 - sizeof(uint16_t));
+  *pos_++ = kArgString;
+  memcpy(pos_, &len, sizeof(len));
+  pos_ += sizeof(len);
+  memcpy(pos_, data, len);
+  pos_ += len;
+}
+
+uint32_t registerFormat(LogFormat* format) {
+  FormatRegistry& registry = formatRegistry();
+  std::lock_guard<std::mutex> guard(registry.registerLock);
+  uint32_t id = format->id.load(std::memory_order_relaxed);
+  if (id != 0) {
+    return id;
+  }
+  {
+    std::lock_guard<std::mutex> formatsGuard(registry.formatsLock);
+    registry.formats.push_back(format);
+    id = registry.formats.size();
+  }
+
+  // Not through the asynchronous buffer, which may drop it: the messages
+  // of the call site could not be decoded without it
+  char buf[BUF_SIZE];
+  size_t len = encodeFormatRecord(format, id, buf, BUF_SIZE);
+  getBinary()->writeDirect(buf, len);
+
+  format->id.store(id, std::memory_order_release);
+  return id;
+}
+
+uint64_t binaryTimestamp() {
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  return uint64_t(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+} // namespace detail
+
+void initializeBinary(Level level,
+                      const char* name,
+                      bool async,
+                      size_t capacity,
+                      Overflow overflow) {
+  if (!binaryLogger) {
+    binaryLogger = new LogWriter(level, name);
+    if (async) {
+      binaryLogger->startAsync(capacity, overflow);
+    }
+    binaryLogger->setReopenCallback(writeFileHeader);
+    char buf[BUF_SIZE];
+    binaryLogger->writeDirect(buf, encodeSessionRecord(buf, BUF_SIZE));
+  }
+}
+
+LogWriter* getBinary() {
+  if (!binaryLogger) {
+    // without initialization binary logging is disabled
+    binaryLogger = new LogWriter(Level::EMERG);
+    binaryLogger->setLevel(static_cast<Level>(-1));
+  }
+  return binaryLogger;
+}
+
+size_t BinaryLogDecoder::decode(const char* data,
+                               size_t size,
+                               std::string& out) {
+  const char* p = data;
+  const char* end = data + size;
+  while (size_t(end - p) >= detail::kRecordHeaderSize) {
+    uint32_t recordSize;
+    uint32_t id;
+    memcpy(&recordSize, p, sizeof(recordSize));
+    memcpy(&id, p + sizeof(recordSize), sizeof(id));
+    if (recordSize < detail::kRecordHeaderSize || recordSize > BUF_SIZE) {
+      throw std::runtime_error(
+          formatError("invalid binary log record size %u at offset %zu",
+                      recordSize, size_t(p - data)));
+    }
+    if (size_t(end - p) < recordSize) {
+      break;
+    }
+    const char* body = p + detail::kRecordHeaderSize;
+    const char* bodyEnd = p + recordSize;
+    if (id == detail::kSessionId) {
+      if (readRaw<uint32_t>(body, bodyEnd) != detail::kBinaryLogMagic) {
+        throw std::runtime_error("invalid binary log magic");
+      }
+      formats_.clear();
+    } else if (id & detail::kFormatBit) {
+      decodeFormat(id & ~detail::kFormatBit, body, bodyEnd);
+    } else {
+      decodeMessage(id, body, bodyEnd, out);
+    }
+    p = bodyEnd;
+  }
+  return p - data;
+}
+
+void BinaryLogDecoder::decodeFormat(uint32_t id,
+                                    const char* body,
+                                    const char* end) {
+  Format format;
+  uint32_t level = readRaw<uint32_t>(body, end);
+  if (level > uint32_t(Level::NOTSET)) {
+    throw std::runtime_error(
+        formatError("invalid binary log level %u for format id %u",
+                    level, id));
+  }
+  format.level = static_cast<Level>(level);
+  format.line = readRaw<uint32_t>(body, end);
+  format.file = readCString(body, end);
+  format.format = readCString(body, end);
+  if (formats_.size() <= id) {
+    formats_.resize(id + 1);
+  }
+  formats_[id] = std::move(format);
+}
+
+void BinaryLogDecoder::decodeMessage(uint32_t id,
+                                     const char* body,
+                                     const char* end,
+                                     std::string& out) {
+  uint64_t timestamp = readRaw<uint64_t>(body, end);
+  if (id >= formats_.size() || formats_[id].file.empty()) {
+    // the format record is lost, the other messages can still be decoded
+    out.append("[? ");
+    appendTimestamp(out, timestamp);
+    appendf(out, "] <unknown format id %u>\n", id);
+    return;
+  }
+  const Format& format = formats_[id];
+
+  appendf(out, "[%c ", getLevelName(format.level)[0]);
+  appendTimestamp(out, timestamp);
+  appendf(out, " %s:%d] ", format.file.c_str(), format.line);
+
+  // Walk the format string, rendering each conversion with its argument.
+  const char* p = format.format.c_str();
+  std::string spec;
+  while (*p) {
+    if (*p != '%') {
+      out.push_back(*p++);
+      continue;
+    }
+    if (p[1] == '%') {
+      out.push_back('%');
+      p += 2;
+      continue;
+    }
+    spec.assign(1, *p++);
+    while (*p && strchr("-+ #0123456789.*", *p)) {
+      if (*p != '*') {
+        spec.push_back(*p++);
+        continue;
+      }
+      // the width or precision is the next argument
+      ++p;
+      int64_t value = readStarArg(body, end);
+      if (value < 0 && spec.back() == '.') {
+        spec.pop_back();    // a negative precision is taken as omitted
+      } else {
+        spec.append(std::to_string(value));
+      }
+    }
+    while (*p && strchr("hlLqjzt", *p)) {
+      ++p;    // length modifiers are replaced according to the arg type
+    }
+    if (!*p) {
+      break;
+    }
+    char conv = *p++;
+    if (body == end) {
+      out.append("<missing>");
+      continue;
+    }
+    uint8_t tag = readRaw<uint8_t>(body, end);
+    switch (tag) {
+      case detail::kArgInt: {
+        int64_t value = readRaw<int64_t>(body, end);
+        if (conv == 'c') {
+          spec.push_back('c');
+          appendf(out, spec.c_str(), int(value));
+        } else {
+          spec.append("ll");
+          spec.push_back(strchr("dioxXu", conv) ? conv : 'd');
+          appendf(out, spec.c_str(), (long long)value);
+        }
+        break;
+      }
+      case detail::kArgUInt:
+        spec.append("ll");
+        spec.push_back(strchr("dioxXu", conv) ? conv : 'u');
+        appendf(out, spec.c_str(),
+                (unsigned long long)readRaw<uint64_t>(body, end));
+        break;
+      case detail::kArgDouble:
+        spec.push_back(strchr("eEfFgGaA", conv) ? conv : 'g');
+        appendf(out, spec.c_str(), readRaw<double>(body, end));
+        break;
+      case detail::kArgString: {
+        uint16_t len = readRaw<uint16_t>(body, end);
+        if (size_t(end - body) < len) {
+          throw std::runtime_error("truncated binary log string");
+        }
+        std::string value(body, len);
+        body += len;
+        spec.push_back('s');
+        appendf(out, spec.c_str(), value.c_str());
+        break;
+      }
+      case detail::kArgPointer:
+        spec.push_back('p');
+        appendf(out, spec.c_str(),
+                reinterpret_cast<void*>(readRaw<uint64_t>(body, end)));
+        break;
+      default:
+        throw std::runtime_error(
+            formatError("invalid binary log argument tag %d", int(tag)));
+    }
+  }
+  out.push_back('\n');
+}
+
+} // namespace logging
+} // namespace folly
+
+#endif
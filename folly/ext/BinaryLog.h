@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOLLY_EXT_BINARY_LOG_H_
+#define FOLLY_EXT_BINARY_LOG_H_
+
+#include <folly/ext/Logging.h>
+
+#if !(FOLLY_HAVE_LIBGLOG && FOLLY_USE_GLOG)
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <folly/Likely.h>
+
+/**
+ * Binary (deferred format) logging.
+ *
+ * Every call site owns a static LogFormat descriptor (level, file, line and
+ * printf format string) which is written to the log once, the first time
+ * the call site fires. After that a message is only its descriptor id, a
+ * timestamp and the raw argument bytes; no formatting happens on the
+ * calling thread. Use BinaryLogDecoder (or the BinaryLogDecoder tool) to
+ * render the log as text offline.
+ *
+ *   folly::logging::initializeBinary(Level::INFO, "/var/log/app.blog");
+ *   BLOG(INFO, "request %s took %.3f ms", uri.c_str(), elapsed);
+ *
+ * Supported argument types are integers, floating point numbers, pointers
+ * and strings (const char*, std::string, StringPiece). Strings are copied
+ * and truncated so that a record fits in BUF_SIZE bytes. Records are in
+ * host byte order.
+ */
+
+namespace folly {
+
+template <class Iter> class Range;
+
+namespace logging {
+
+struct LogFormat {
+  Level level;
+  const char* file;
+  int line;
+  const char* format;
+  std::atomic<uint32_t> id;   // 0 until registered
+};
+
+namespace detail {
+
+// Record layout: uint32 size, uint32 id, then a body depending on the id.
+//   kSessionId:         uint32 magic, uint32 version
+//   kFormatBit | id:    uint32 level, uint32 line, file\0, format\0
+//   id:                 uint64 timestamp (ns since epoch), arguments
+// Each argument is a one byte tag followed by its value; strings are a
+// uint16 length followed by the bytes.
+
+constexpr uint32_t kSessionId = 0;
+constexpr uint32_t kFormatBit = 0x80000000;
+constexpr uint32_t kBinaryLogMagic = 0x474f4c42;  // "BLOG"
+constexpr uint32_t kBinaryLogVersion = 1;
+constexpr size_t kRecordHeaderSize = 2 * sizeof(uint32_t);
+
+enum ArgTag : uint8_t {
+  kArgInt = 'i',
+  kArgUInt = 'u',
+  kArgDouble = 'd',
+  kArgString = 's',
+  kArgPointer = 'p',
+};
+
+class BinaryEncoder {
+public:
+  BinaryEncoder(char* buf, size_t size)
+    : begin_(buf), pos_(buf), end_(buf + size) {}
+
+  template <class T>
+  void putRaw(const T& value) {
+    if (pos_ + sizeof(T) <= end_) {
+      memcpy(pos_, &value, sizeof(T));
+      pos_ += sizeof(T);
+    }
+  }
+
+  template <class T>
+  typename std::enable_if<std::is_integral<T>::value &&
+                          std::is_signed<T>::value>::type
+  put(T value) {
+    put(kArgInt, int64_t(value));
+  }
+
+  template <class T>
+  typename std::enable_if<std::is_integral<T>::value &&
+                          !std::is_signed<T>::value>::type
+  put(T value) {
+    put(kArgUInt, uint64_t(value));
+  }
+
+  template <class T>
+  typename std::enable_if<std::is_enum<T>::value>::type
+  put(T value) {
+    put(static_cast<typename std::underlying_type<T>::type>(value));
+  }
+
+  template <class T>
+  typename std::enable_if<std::is_floating_point<T>::value>::type
+  put(T value) {
+    put(kArgDouble, double(value));
+  }
+
+  void put(const char* value) {
+    value = value ? value : "(null)";
+    putString(value, strlen(value));
+  }
+  void put(char* value) {
+    put(static_cast<const char*>(value));
+  }
+  void put(const std::string& value) {
+    putString(value.data(), value.size());
+  }
+  template <class Iter>
+  void put(const Range<Iter>& value) {
+    putString(value.data(), value.size());
+  }
+
+  template <class T>
+  void put(const T* value) {
+    put(kArgPointer, uint64_t(uintptr_t(value)));
+  }
+
+  void putArgs() {}
+
+  template <class T, class... Args>
+  void putArgs(const T& value, const Args&... args) {
+    put(value);
+    putArgs(args...);
+  }
+
+  size_t size() const { return pos_ - begin_; }
+
+private:
+  void putString(const char* data, size_t size);
+
+  template <class T>
+  void put(ArgTag tag, T value) {
+    if (pos_ + 1 + sizeof(T) <= end_) {
+      *pos_++ = tag;
+      memcpy(pos_, &value, sizeof(T));
+      pos_ += sizeof(T);
+    }
+  }
+
+  char* begin_;
+  char* pos_;
+  char* end_;
+};
+
+uint32_t registerFormat(LogFormat* format);
+
+uint64_t binaryTimestamp();
+
+} // namespace detail
+
+/**
+ * Public initialization function - creates the LogWriter used for binary
+ * records. The file should not be shared with the text logger.
+ * Rotation can be set up on getBinary() as for the text logger; each new
+ * file starts with the formats registered so far.
+ */
+extern void initializeBinary(Level level,
+                             const char* name,
+                             bool async = true,
+                             size_t capacity = DEFAULT_ASYNC_CAPACITY,
+                             Overflow overflow = Overflow::DISCARD);
+
+/**
+ * Accessor for the binary LogWriter singleton instance
+ */
+extern LogWriter* getBinary();
+
+template <class... Args>
+void logBinary(LogFormat* format, const Args&... args) {
+  uint32_t id = format->id.load(std::memory_order_acquire);
+  if (UNLIKELY(id == 0)) {
+    id = detail::registerFormat(format);
+  }
+  char buf[BUF_SIZE];
+  detail::BinaryEncoder encoder(buf, BUF_SIZE);
+  encoder.putRaw(uint32_t(0));    // size, filled below
+  encoder.putRaw(id);
+  encoder.putRaw(detail::binaryTimestamp());
+  encoder.putArgs(args...);
+  uint32_t size = encoder.size();
+  memcpy(buf, &size, sizeof(size));
+  getBinary()->logString(buf, size);
+}
+
+/**
+ * Renders binary log records as text, in the format of LogMessage.
+ */
+class BinaryLogDecoder {
+public:
+  /**
+   * Decode all complete records in data, appending the text to out.
+   * Returns the number of bytes consumed; a trailing partial record is
+   * left for the next call. A message of an unknown format id is rendered
+   * as a placeholder line. Throws std::runtime_error on corrupt input.
+   */
+  size_t decode(const char* data, size_t size, std::string& out);
+
+private:
+  struct Format {
+    Level level;
+    int line;
+    std::string file;
+    std::string format;
+  };
+
+  void decodeFormat(uint32_t id, const char* body, const char* end);
+  void decodeMessage(uint32_t id,
+                     const char* body,
+                     const char* end,
+                     std::string& out);
+
+  std::vector<Format> formats_;
+};
+
+} // namespace logging
+} // namespace folly
+
+#define LOG_BINARY(severity, fmt, ...) do {                            \
+  static ::folly::logging::LogFormat folly_log_format_ = {             \
+    severity, __FILE__, __LINE__, fmt, {0}                             \
+  };                                                                   \
+  if (::folly::logging::getBinary()->isEnabled(severity)) {            \
+    ::folly::logging::logBinary(&folly_log_format_, ##__VA_ARGS__);    \
+  }                                                                    \
+  } while (0)
+
+#define BLOG(severity, fmt, ...) \
+  LOG_BINARY(::folly::logging::Level::severity, fmt, ##__VA_ARGS__)
+
+#endif /* !(FOLLY_HAVE_LIBGLOG && FOLLY_USE_GLOG) */
+
+#endif /* FOLLY_EXT_BINARY_LOG_H_ */
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <stdexcept>
+
+#include <folly/ext/BinaryLog.h>
+
+/**
+ * Renders binary logs written with BLOG as text.
+ *
+ * Use it like:
+ *   ./BinaryLogDecoder /var/log/app.blog [more.blog]...
+ * or read from stdin when no file is given.
+ */
+
+int decodeFile(FILE* in) {
+  folly::logging::BinaryLogDecoder decoder;
+  std::string buf;
+  std::string out;
+  char chunk[64 * 1024];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+    buf.append(chunk, n);
+    size_t consumed = decoder.decode(buf.data(), buf.size(), out);
+    buf.erase(0, consumed);
+    fwrite(out.data(), 1, out.size(), stdout);
+    out.clear();
+  }
+  if (!buf.empty()) {
+    fprintf(stderr, "%zu trailing bytes of a partial record\n", buf.size());
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  int ret = 0;
+  try {
+    if (argc < 2) {
+      return decodeFile(stdin);
+    }
+    for (int i = 1; i < argc; ++i) {
+      FILE* in = fopen(argv[i], "rb");
+      if (!in) {
+        perror(argv[i]);
+        ret = 1;
+        continue;
+      }
+      ret |= decodeFile(in);
+      fclose(in);
+    }
+  } catch (const std::exception& e) {
+    fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+  return ret;
+}
@@ -29,6 +29,37 @@ extern const char b32DecodeTable[];
 extern const char b64DecodeTable[];
 extern const char r13DecodeTable[];
 
+// Decode the longest prefix of whole quanta of [in, in + n) which are all
+// in the alphabet. Returns the number of characters decoded.
+size_t base64DecodeQuanta(const char* in, size_t n, char* out, bool url);
+
+/**
+ * The base64 kernels for a given SIMD level (SSSE3 or AVX2, any other
+ * level gives the scalar kernels), so that tests can check them against
+ * each other. Check simdLevelSupported first.
+ */
+struct Base64Kernels {
+  size_t (*encode)(const uint8_t* in, size_t n, char* out, bool url);
+  size_t (*decode)(const char* in, size_t n, char* out, bool url);
+};
+
+Base64Kernels base64Kernels(SimdLevel level);
+
+char* base32Encode(const char* in, size_t n, char* out, bool padding);
+char* base32DecodeStrict(const char* in, size_t n, char* out, bool padding);
+
+inline size_t base32EncodedSize(size_t n, bool padding) {
+  return padding ? (n + 4) / 5 * 8 : (n * 8 + 4) / 5;
+}
+
+// Resize out to hold n more bytes, returning where they go
+template <class String>
+char* appendUninitialized(String& out, size_t n) {
+  size_t size = out.size();
+  out.resize(size + n);
+  return &out[size];
+}
+
 } // namespace detail
 
 template <class String>
@@ -55,10 +86,24 @@ void base32Decode(StringPiece str, String& out) {
 
 template <class String>
 void base64Decode(StringPiece str, String& out) {
+  // out is grown once for the longest possible output, then cut down
+  size_t size = out.size();
+  char* begin = detail::appendUninitialized(out, str.size() / 4 * 3 + 2);
+  char* q = begin;
   uint32_t value = 0;
   int bits = 0;
 
-  for (uint8_t c : str) {
+  for (const char* p = str.begin(); p != str.end(); ++p) {
+    if (bits == 0 && str.end() - p >= 16) {
+      // on a quantum boundary, decode the valid run at once
+      size_t m = detail::base64DecodeQuanta(p, str.end() - p, q, false);
+      q += m / 4 * 3;
+      p += m;
+      if (p == str.end()) {
+        break;
+      }
+    }
+    uint8_t c = *p;
     if (c > 0x7f) {
       continue;
     }
@@ -68,11 +113,15 @@ void base64Decode(StringPiece str, String& out) {
     }
     value = (value << 6) | c;
     bits += 6;
-    while (bits >= 8) {
+    if (bits >= 8) {
       bits -= 8;
-      out.push_back((value >> bits) & 0xff);
+      *q++ = (value >> bits) & 0xff;
+    }
+    if (bits == 0) {
+      value = 0;
     }
   }
+  out.resize(size + (q - begin));
 }
 
 template <class String>
@@ -86,7 +135,44 @@ void rot13Decode(StringPiece str, String& out) {
   }
 }
 
+template <class String>
+void base32Encode(StringPiece str, String& out, bool padding) {
+  size_t n = detail::base32EncodedSize(str.size(), padding);
+  detail::base32Encode(str.data(), str.size(),
+                       detail::appendUninitialized(out, n), padding);
+}
+
+template <class String>
+void base32DecodeStrict(StringPiece str, String& out, bool padding) {
+  size_t size = out.size();
+  SCOPE_FAIL { out.resize(size); };
+  size_t n = (str.size() + 7) / 8 * 5;
+  char* p = detail::appendUninitialized(out, n);
+  char* end = detail::base32DecodeStrict(str.data(), str.size(), p, padding);
+  out.resize(size + (end - p));
+}
+
+template <class String>
+void base64Encode(StringPiece str, String& out, int flags) {
+  size_t n = base64EncodedSize(str.size(), flags);
+  char* p = detail::appendUninitialized(out, n);
+  Base64Encoder encoder(flags);
+  p = encoder.encode(reinterpret_cast<const uint8_t*>(str.data()),
+                     str.size(), p);
+  encoder.finish(p);
+}
+
+template <class String>
+void base64DecodeStrict(StringPiece str, String& out, int flags) {
+  size_t size = out.size();
+  SCOPE_FAIL { out.resize(size); };
+  size_t n = Base64Decoder::maxDecodedSize(str.size());
+  char* p = detail::appendUninitialized(out, n);
+  Base64Decoder decoder(flags);
+  char* end = decoder.finish(decoder.decode(str.data(), str.size(), p));
+  out.resize(size + (end - p));
+}
+
 } // namespace folly
 
 #endif /* FOLLY_EXT_BINASCII_INL_H_ */
-
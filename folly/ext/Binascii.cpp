@@ -16,6 +16,15 @@
 
 #include <folly/ext/Binascii.h>
 
+#include <cstring>
+
+#include <folly/Conv.h>
+#include <folly/detail/SimdDispatch.h>
+
+#if FOLLY_SIMD
+#include <immintrin.h>
+#endif
+
 namespace folly {
 
 namespace detail {
@@ -61,6 +70,598 @@ extern const char r13DecodeTable[] = {
   0x6b,0x6c,0x6d,0x7b,0x7c,0x7d,0x7e,0x7f,
 };
 
+} // namespace detail
+
+namespace {
+
+const char b64UrlDecodeTable[] = {
+  -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
+  -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
+  -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,62,-1,-1,
+  52,53,54,55, 56,57,58,59, 60,61,-1,-1, -1,-1,-1,-1,
+  -1, 0, 1, 2,  3, 4, 5, 6,  7, 8, 9,10, 11,12,13,14,
+  15,16,17,18, 19,20,21,22, 23,24,25,-1, -1,-1,-1,63,
+  -1,26,27,28, 29,30,31,32, 33,34,35,36, 37,38,39,40,
+  41,42,43,44, 45,46,47,48, 49,50,51,-1, -1,-1,-1,-1
+};
+
+const char* const kBase64Alphabets[] = {
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_",
+};
+
+const char kBase32Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+
+// -1 if c is not in the alphabet
+inline int base64Value(uint8_t c, bool url) {
+  return c > 0x7f ? -1 : (url ? b64UrlDecodeTable : detail::b64DecodeTable)[c];
+}
+
+inline int base32Value(uint8_t c) {
+  if (c >= 'A' && c <= 'Z') {
+    return c - 'A';
+  }
+  if (c >= '2' && c <= '7') {
+    return c - '2' + 26;
+  }
+  return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Kernels: encode whole 3 byte groups, decode whole 4 character quanta
+// (stopping at the first one with a character out of the alphabet).
+// They return the number of input bytes processed.
+
+size_t base64EncodeScalar(const uint8_t* in, size_t n, char* out, bool url) {
+  const char* alphabet = kBase64Alphabets[url];
+  size_t i = 0;
+  for (; i + 3 <= n; i += 3) {
+    uint32_t v = (in[i] << 16) | (in[i + 1] << 8) | in[i + 2];
+    *out++ = alphabet[v >> 18];
+    *out++ = alphabet[(v >> 12) & 0x3f];
+    *out++ = alphabet[(v >> 6) & 0x3f];
+    *out++ = alphabet[v & 0x3f];
+  }
+  return i;
+}
+
+size_t base64DecodeScalar(const char* in, size_t n, char* out, bool url) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    int a = base64Value(in[i], url);
+    int b = base64Value(in[i + 1], url);
+    int c = base64Value(in[i + 2], url);
+    int d = base64Value(in[i + 3], url);
+    if ((a | b | c | d) < 0) {
+      break;
+    }
+    uint32_t v = (a << 18) | (b << 12) | (c << 6) | d;
+    *out++ = v >> 16;
+    *out++ = (v >> 8) & 0xff;
+    *out++ = v & 0xff;
+  }
+  return i;
+}
+
+#if FOLLY_SIMD
+
+///////////////////////////////////////////////////////////////////////////
+// SSSE3, build even if -mssse3 is not passed to GCC
+//
+// Encoding spreads 3 bytes over the 4 bytes of each 32 bit lane, extracts
+// the 6 bit fields with multiplications and maps them to ASCII by adding
+// an offset picked with pshufb. Decoding classifies the characters with
+// comparisons and packs the values with multiply-add.
+
+__m128i base64EncodeBlockSsse3(__m128i in, __m128i offsets)
+  __attribute__ ((__target__("ssse3")));
+bool base64DecodeBlockSsse3(__m128i in, bool url, __m128i& out)
+  __attribute__ ((__target__("ssse3")));
+size_t base64EncodeSsse3(const uint8_t* in, size_t n, char* out, bool url)
+  __attribute__ ((__target__("ssse3"), noinline));
+size_t base64DecodeSsse3(const char* in, size_t n, char* out, bool url)
+  __attribute__ ((__target__("ssse3"), noinline));
+
+// Offsets from the 6 bit values to their characters, indexed by class
+inline __m128i base64Offsets(bool url) {
+  return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, (url ? '-' : '+') - 62,
+                       (url ? '_' : '/') - 63, 'A', 0, 0);
+}
+
+// 12 bytes (of 16) to 16 characters
+inline __m128i base64EncodeBlockSsse3(__m128i in, __m128i offsets) {
+  in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7,
+                                         4, 5, 3, 4, 1, 2, 0, 1));
+  __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  __m128i values = _mm_or_si128(t1, t3);
+  // class: 13 for 0..25, 0 for 26..51, 1..12 for 52..63
+  __m128i cls = _mm_subs_epu8(values, _mm_set1_epi8(51));
+  __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), values);
+  cls = _mm_or_si128(cls, _mm_and_si128(less, _mm_set1_epi8(13)));
+  return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, cls));
+}
+
+// 16 characters to 12 bytes (of 16), false if one is not in the alphabet
+inline bool base64DecodeBlockSsse3(__m128i in, bool url, __m128i& out) {
+  char c62 = url ? '-' : '+';
+  char c63 = url ? '_' : '/';
+  __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('A' - 1)),
+                                _mm_cmplt_epi8(in, _mm_set1_epi8('Z' + 1)));
+  __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('a' - 1)),
+                                _mm_cmplt_epi8(in, _mm_set1_epi8('z' + 1)));
+  __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)),
+                                _mm_cmplt_epi8(in, _mm_set1_epi8('9' + 1)));
+  __m128i is62 = _mm_cmpeq_epi8(in, _mm_set1_epi8(c62));
+  __m128i is63 = _mm_cmpeq_epi8(in, _mm_set1_epi8(c63));
+  __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                               _mm_or_si128(digit,
+                                            _mm_or_si128(is62, is63)));
+  if (_mm_movemask_epi8(valid) != 0xffff) {
+    return false;
+  }
+  __m128i shift = _mm_or_si128(
+    _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+                 _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+    _mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+                 _mm_or_si128(_mm_and_si128(is62, _mm_set1_epi8(62 - c62)),
+                              _mm_and_si128(is63, _mm_set1_epi8(63 - c63)))));
+  __m128i values = _mm_add_epi8(in, shift);
+  // 4 x 6 bits to 24 bits in each 32 bit lane, then drop the top bytes
+  values = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  values = _mm_madd_epi16(values, _mm_set1_epi32(0x00011000));
+  out = _mm_shuffle_epi8(values, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8,
+                                               14, 13, 12, -1, -1, -1, -1));
+  return true;
+}
+
+// Store the 12 bytes of a decoded block
+inline void storeBlock(char* out, __m128i v) {
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(out), v);
+  uint32_t tail = _mm_cvtsi128_si32(_mm_srli_si128(v, 8));
+  memcpy(out + 8, &tail, sizeof(tail));
+}
+
+size_t base64EncodeSsse3(const uint8_t* in, size_t n, char* out, bool url) {
+  __m128i offsets = base64Offsets(url);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 12, out += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                     base64EncodeBlockSsse3(v, offsets));
+  }
+  return i + base64EncodeScalar(in + i, n - i, out, url);
+}
+
+size_t base64DecodeSsse3(const char* in, size_t n, char* out, bool url) {
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16, out += 12) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    if (!base64DecodeBlockSsse3(v, url, v)) {
+      break;
+    }
+    storeBlock(out, v);
+  }
+  return i + base64DecodeScalar(in + i, n - i, out, url);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// AVX2, the same on two lanes
+
+__m256i base64EncodeBlockAvx2(__m256i in, __m256i offsets)
+  __attribute__ ((__target__("avx2")));
+bool base64DecodeBlockAvx2(__m256i in, bool url, __m256i& out)
+  __attribute__ ((__target__("avx2")));
+size_t base64EncodeAvx2(const uint8_t* in, size_t n, char* out, bool url)
+  __attribute__ ((__target__("avx2"), noinline));
+size_t base64DecodeAvx2(const char* in, size_t n, char* out, bool url)
+  __attribute__ ((__target__("avx2"), noinline));
+
+inline __m256i base64EncodeBlockAvx2(__m256i in, __m256i offsets) {
+  in = _mm256_shuffle_epi8(in, _mm256_set_epi8(
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+  __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+  __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+  __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+  __m256i values = _mm256_or_si256(t1, t3);
+  __m256i cls = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+  __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+  cls = _mm256_or_si256(cls, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+  return _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, cls));
+}
+
+inline bool base64DecodeBlockAvx2(__m256i in, bool url, __m256i& out) {
+  char c62 = url ? '-' : '+';
+  char c63 = url ? '_' : '/';
+  __m256i upper = _mm256_and_si256(
+    _mm256_cmpgt_epi8(in, _mm256_set1_epi8('A' - 1)),
+    _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), in));
+  __m256i lower = _mm256_and_si256(
+    _mm256_cmpgt_epi8(in, _mm256_set1_epi8('a' - 1)),
+    _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), in));
+  __m256i digit = _mm256_and_si256(
+    _mm256_cmpgt_epi8(in, _mm256_set1_epi8('0' - 1)),
+    _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), in));
+  __m256i is62 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(c62));
+  __m256i is63 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(c63));
+  __m256i valid = _mm256_or_si256(_mm256_or_si256(upper, lower),
+                                  _mm256_or_si256(digit,
+                                                  _mm256_or_si256(is62, is63)));
+  if (_mm256_movemask_epi8(valid) != -1) {
+    return false;
+  }
+  __m256i shift = _mm256_or_si256(
+    _mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-'A')),
+                    _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))),
+    _mm256_or_si256(
+      _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')),
+      _mm256_or_si256(_mm256_and_si256(is62, _mm256_set1_epi8(62 - c62)),
+                      _mm256_and_si256(is63, _mm256_set1_epi8(63 - c63)))));
+  __m256i values = _mm256_add_epi8(in, shift);
+  values = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+  values = _mm256_madd_epi16(values, _mm256_set1_epi32(0x00011000));
+  out = _mm256_shuffle_epi8(values, _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  return true;
+}
+
+size_t base64EncodeAvx2(const uint8_t* in, size_t n, char* out, bool url) {
+  __m256i offsets = _mm256_broadcastsi128_si256(base64Offsets(url));
+  size_t i = 0;
+  // two loads of 16 bytes, 12 of each used
+  for (; i + 28 <= n; i += 24, out += 32) {
+    auto p = reinterpret_cast<const __m128i*>(in + i);
+    auto q = reinterpret_cast<const __m128i*>(in + i + 12);
+    __m256i v = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128(p)), _mm_loadu_si128(q), 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                        base64EncodeBlockAvx2(v, offsets));
+  }
+  return i + base64EncodeScalar(in + i, n - i, out, url);
+}
+
+size_t base64DecodeAvx2(const char* in, size_t n, char* out, bool url) {
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32, out += 24) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+    if (!base64DecodeBlockAvx2(v, url, v)) {
+      break;
+    }
+    storeBlock(out, _mm256_castsi256_si128(v));
+    storeBlock(out + 12, _mm256_extracti128_si256(v, 1));
+  }
+  return i + base64DecodeScalar(in + i, n - i, out, url);
+}
+
+#endif // FOLLY_SIMD
+
+size_t base64EncodeGroups(const uint8_t* in, size_t n, char* out, bool url) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSSE3, base64Encode, Ssse3);
+  return fn(in, n, out, url);
+}
+
+} // namespace anon
+
+namespace detail {
+
+size_t base64DecodeQuanta(const char* in, size_t n, char* out, bool url) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSSE3, base64Decode, Ssse3);
+  return fn(in, n, out, url);
+}
+
+Base64Kernels base64Kernels(SimdLevel level) {
+  switch (level) {
+#if FOLLY_SIMD
+    case SimdLevel::SSSE3:
+      return {base64EncodeSsse3, base64DecodeSsse3};
+    case SimdLevel::AVX2:
+      return {base64EncodeAvx2, base64DecodeAvx2};
+#endif
+    default:
+      return {base64EncodeScalar, base64DecodeScalar};
+  }
+}
+
+char* base32Encode(const char* in, size_t n, char* out, bool padding) {
+  auto p = reinterpret_cast<const uint8_t*>(in);
+  for (; n >= 5; n -= 5, p += 5) {
+    uint64_t v = (uint64_t(p[0]) << 32) | (uint64_t(p[1]) << 24) |
+                 (p[2] << 16) | (p[3] << 8) | p[4];
+    for (int shift = 35; shift >= 0; shift -= 5) {
+      *out++ = kBase32Alphabet[(v >> shift) & 0x1f];
+    }
+  }
+  if (n > 0) {
+    uint64_t v = 0;
+    for (size_t i = 0; i < n; ++i) {
+      v |= uint64_t(p[i]) << (32 - 8 * i);
+    }
+    size_t chars = (n * 8 + 4) / 5;
+    for (size_t i = 0; i < chars; ++i) {
+      *out++ = kBase32Alphabet[(v >> (35 - 5 * i)) & 0x1f];
+    }
+    if (padding) {
+      for (size_t i = chars; i < 8; ++i) {
+        *out++ = '=';
+      }
+    }
+  }
+  return out;
+}
+
+char* base32DecodeStrict(const char* in, size_t n, char* out, bool padding) {
+  uint64_t v = 0;
+  size_t k = 0;   // characters of the current quantum
+  size_t i = 0;
+  for (; i < n && in[i] != '='; ++i) {
+    int c = base32Value(in[i]);
+    if (c < 0) {
+      throw BinasciiError("base32", i);
+    }
+    v = (v << 5) | c;
+    if (++k == 8) {
+      for (int shift = 32; shift >= 0; shift -= 8) {
+        *out++ = (v >> shift) & 0xff;
+      }
+      v = 0;
+      k = 0;
+    }
+  }
+  if (k == 0) {
+    if (i < n) {
+      throw BinasciiError("base32", i);   // padding of nothing
+    }
+    return out;
+  }
+  // the last quantum: 2, 4, 5 or 7 characters for 1 to 4 bytes
+  if (k == 1 || k == 3 || k == 6) {
+    throw BinasciiError("base32", i);
+  }
+  if (padding) {
+    for (size_t j = k; j < 8; ++j, ++i) {
+      if (i == n || in[i] != '=') {
+        throw BinasciiError("base32", i);
+      }
+    }
+  }
+  if (i != n) {
+    throw BinasciiError("base32", i);
+  }
+  size_t bytes = k * 5 / 8;
+  size_t unused = k * 5 - bytes * 8;
+  if (v & ((1 << unused) - 1)) {
+    throw BinasciiError("base32", i - (padding ? 8 - k : 0) - 1);
+  }
+  v >>= unused;
+  for (size_t j = bytes; j > 0; --j) {
+    *out++ = (v >> (8 * (j - 1))) & 0xff;
+  }
+  return out;
+}
+
+} // namespace detail
+
+BinasciiError::BinasciiError(const char* codec, size_t position)
+  : std::invalid_argument(to<std::string>(
+        "invalid ", codec, " input at offset ", position))
+  , position_(position) {
+}
+
+size_t base64EncodedSize(size_t n, int flags) {
+  size_t chars = (flags & BASE64_NO_PADDING) ? (n * 4 + 2) / 3
+                                             : (n + 2) / 3 * 4;
+  if ((flags & BASE64_MIME) && chars > 0) {
+    chars += (chars - 1) / 76 * 2;
+  }
+  return chars;
+}
+
+Base64Encoder::Base64Encoder(int flags) : flags_(flags) {
+}
+
+size_t Base64Encoder::maxEncodedSize(size_t n) const {
+  size_t chars = (n + 4) / 3 * 4;
+  return (flags_ & BASE64_MIME) ? chars + (chars / 76 + 1) * 2 : chars;
+}
+
+void Base64Encoder::encode(ByteRange data, IOBufQueue& out) {
+  size_t n = maxEncodedSize(data.size());
+  char* p = static_cast<char*>(out.preallocate(n, n).first);
+  out.postallocate(encode(data.data(), data.size(), p) - p);
+}
+
+void Base64Encoder::encode(const IOBuf& buf, IOBufQueue& out) {
+  for (auto data : buf) {
+    encode(data, out);
+  }
 }
 
+void Base64Encoder::finish(IOBufQueue& out) {
+  char* p = static_cast<char*>(out.preallocate(6, 6).first);
+  out.postallocate(finish(p) - p);
 }
+
+char* Base64Encoder::encode(const uint8_t* data, size_t n, char* out) {
+  if (npending_ > 0) {
+    while (npending_ < 3 && n > 0) {
+      pending_[npending_++] = *data++;
+      --n;
+    }
+    if (npending_ < 3) {
+      return out;
+    }
+    out = encodeLine(pending_, 3, out);
+    npending_ = 0;
+  }
+  size_t whole = n / 3 * 3;
+  out = encodeLine(data, whole, out);
+  npending_ = n - whole;
+  memcpy(pending_, data + whole, npending_);
+  return out;
+}
+
+char* Base64Encoder::encodeLine(const uint8_t* data, size_t n, char* out) {
+  bool url = flags_ & BASE64_URL;
+  if (!(flags_ & BASE64_MIME)) {
+    base64EncodeGroups(data, n, out, url);
+    return out + n / 3 * 4;
+  }
+  while (n > 0) {
+    if (column_ == 76) {
+      *out++ = '\r';
+      *out++ = '\n';
+      column_ = 0;
+    }
+    size_t k = std::min(n, (76 - column_) / 4 * 3);
+    base64EncodeGroups(data, k, out, url);
+    out += k / 3 * 4;
+    column_ += k / 3 * 4;
+    data += k;
+    n -= k;
+  }
+  return out;
+}
+
+char* Base64Encoder::finish(char* out) {
+  if (npending_ > 0) {
+    if ((flags_ & BASE64_MIME) && column_ == 76) {
+      *out++ = '\r';
+      *out++ = '\n';
+    }
+    const char* alphabet = kBase64Alphabets[bool(flags_ & BASE64_URL)];
+    uint32_t v = (pending_[0] << 16) | (npending_ > 1 ? pending_[1] << 8 : 0);
+    *out++ = alphabet[v >> 18];
+    *out++ = alphabet[(v >> 12) & 0x3f];
+    if (npending_ > 1) {
+      *out++ = alphabet[(v >> 6) & 0x3f];
+    }
+    if (!(flags_ & BASE64_NO_PADDING)) {
+      for (size_t i = npending_; i < 3; ++i) {
+        *out++ = '=';
+      }
+    }
+  }
+  npending_ = 0;
+  column_ = 0;
+  return out;
+}
+
+Base64Decoder::Base64Decoder(int flags) : flags_(flags) {
+}
+
+void Base64Decoder::decode(StringPiece data, IOBufQueue& out) {
+  size_t n = maxDecodedSize(data.size());
+  char* p = static_cast<char*>(out.preallocate(n, n).first);
+  out.postallocate(decode(data.data(), data.size(), p) - p);
+}
+
+void Base64Decoder::decode(const IOBuf& buf, IOBufQueue& out) {
+  for (auto data : buf) {
+    decode(StringPiece(data), out);
+  }
+}
+
+void Base64Decoder::finish(IOBufQueue& out) {
+  char* p = static_cast<char*>(out.preallocate(2, 2).first);
+  out.postallocate(finish(p) - p);
+}
+
+char* Base64Decoder::decode(const char* data, size_t n, char* out) {
+  bool url = flags_ & BASE64_URL;
+  const char* p = data;
+  const char* end = data + n;
+  while (p != end) {
+    if (npending_ == 0 && npadding_ == 0 && !done_) {
+      size_t m = detail::base64DecodeQuanta(p, end - p, out, url);
+      p += m;
+      out += m / 4 * 3;
+      if (p == end) {
+        break;
+      }
+    }
+    out = decodeChar(*p, offset_ + (p - data), out);
+    ++p;
+  }
+  offset_ += n;
+  return out;
+}
+
+char* Base64Decoder::decodeChar(char c, size_t offset, char* out) {
+  if ((flags_ & BASE64_MIME) && (c == '\r' || c == '\n')) {
+    return out;
+  }
+  if (done_) {
+    throw BinasciiError("base64", offset);
+  }
+  if (c == '=') {
+    if ((flags_ & BASE64_NO_PADDING) || npending_ < 2) {
+      throw BinasciiError("base64", offset);
+    }
+    if (npending_ + ++npadding_ == 4) {
+      out = decodeLast(out);
+      done_ = true;
+    }
+    return out;
+  }
+  int v = base64Value(c, flags_ & BASE64_URL);
+  if (v < 0 || npadding_ > 0) {
+    throw BinasciiError("base64", offset);
+  }
+  quantum_[npending_++] = v;
+  lastOffset_ = offset;
+  if (npending_ == 4) {
+    uint32_t x = (quantum_[0] << 18) | (quantum_[1] << 12) |
+                 (quantum_[2] << 6) | quantum_[3];
+    *out++ = x >> 16;
+    *out++ = (x >> 8) & 0xff;
+    *out++ = x & 0xff;
+    npending_ = 0;
+  }
+  return out;
+}
+
+char* Base64Decoder::decodeLast(char* out) {
+  // 2 or 3 characters, for 1 or 2 bytes; the unused bits must be zero
+  uint32_t x = (quantum_[0] << 18) | (quantum_[1] << 12);
+  if (npending_ == 3) {
+    x |= quantum_[2] << 6;
+  }
+  if (x & (npending_ == 3 ? 0xff : 0xffff)) {
+    throw BinasciiError("base64", lastOffset_);
+  }
+  *out++ = x >> 16;
+  if (npending_ == 3) {
+    *out++ = (x >> 8) & 0xff;
+  }
+  npending_ = 0;
+  return out;
+}
+
+char* Base64Decoder::finish(char* out) {
+  if (!done_ && (npending_ > 0 || npadding_ > 0)) {
+    if (npadding_ > 0 || npending_ == 1 || !(flags_ & BASE64_NO_PADDING)) {
+      size_t offset = offset_;
+      reset();
+      throw BinasciiError("base64", offset);
+    }
+    out = decodeLast(out);
+  }
+  reset();
+  return out;
+}
+
+void Base64Decoder::reset() {
+  npending_ = 0;
+  npadding_ = 0;
+  done_ = false;
+  offset_ = 0;
+}
+
+} // namespace folly
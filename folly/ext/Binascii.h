@@ -17,10 +17,42 @@
 #ifndef FOLLY_EXT_BINASCII_H_
 #define FOLLY_EXT_BINASCII_H_
 
+#include <stdexcept>
+#include <string>
+
 #include <folly/Range.h>
+#include <folly/ScopeGuard.h>
+#include <folly/detail/SimdDispatch.h>
+#include <folly/io/IOBuf.h>
+#include <folly/io/IOBufQueue.h>
 
 namespace folly {
 
+enum Base64Flags {
+  BASE64_DEFAULT = 0,
+  BASE64_URL = 1 << 0,          // '-' and '_' for '+' and '/' (RFC 4648)
+  BASE64_NO_PADDING = 1 << 1,   // no trailing '='
+  BASE64_MIME = 1 << 2,         // lines of 76 characters, CRLF separated
+};
+
+/**
+ * Thrown by the strict decoders; position is the offset of the first
+ * invalid byte in the input (its size if the input is truncated).
+ */
+class BinasciiError : public std::invalid_argument {
+public:
+  BinasciiError(const char* codec, size_t position);
+
+  size_t position() const { return position_; }
+
+private:
+  size_t position_;
+};
+
+/**
+ * The lenient decoders skip the bytes which are not in the alphabet,
+ * padding included.
+ */
 template <class String>
 void base32Decode(StringPiece str, String& out);
 
@@ -37,7 +69,7 @@ void base64Decode(StringPiece str, String& out);
 template <class String>
 String base64Decode(StringPiece str) {
   String out;
-  base32Decode(str, out);
+  base64Decode(str, out);
   return out;
 }
 
@@ -47,13 +79,163 @@ void rot13Decode(StringPiece str, String& out);
 template <class String>
 String rot13Decode(StringPiece str) {
   String out;
-  base32Decode(str, out);
+  rot13Decode(str, out);
+  return out;
+}
+
+/**
+ * Base32 encoding (RFC 4648 alphabet), padded to a multiple of 8.
+ */
+template <class String>
+void base32Encode(StringPiece str, String& out, bool padding = true);
+
+template <class String>
+String base32Encode(StringPiece str, bool padding = true) {
+  String out;
+  base32Encode(str, out, padding);
+  return out;
+}
+
+/**
+ * Strict base32 decoding: only the upper case alphabet, complete padding
+ * (or none at all if !padding) and zero unused bits are accepted.
+ * Throws BinasciiError, leaving out as it was.
+ */
+template <class String>
+void base32DecodeStrict(StringPiece str, String& out, bool padding = true);
+
+template <class String>
+String base32DecodeStrict(StringPiece str, bool padding = true) {
+  String out;
+  base32DecodeStrict(str, out, padding);
   return out;
 }
 
+/**
+ * Base64 encoding, with Base64Flags.
+ */
+template <class String>
+void base64Encode(StringPiece str, String& out, int flags = BASE64_DEFAULT);
+
+template <class String>
+String base64Encode(StringPiece str, int flags = BASE64_DEFAULT) {
+  String out;
+  base64Encode(str, out, flags);
+  return out;
+}
+
+/**
+ * Strict base64 decoding: the input must be in the alphabet given by
+ * flags, padded unless BASE64_NO_PADDING, with zero unused bits; CR and
+ * LF are skipped with BASE64_MIME. Throws BinasciiError, leaving out as
+ * it was.
+ */
+template <class String>
+void base64DecodeStrict(StringPiece str, String& out,
+                        int flags = BASE64_DEFAULT);
+
+template <class String>
+String base64DecodeStrict(StringPiece str, int flags = BASE64_DEFAULT) {
+  String out;
+  base64DecodeStrict(str, out, flags);
+  return out;
+}
+
+/**
+ * Size of the base64 encoding of n bytes.
+ */
+size_t base64EncodedSize(size_t n, int flags = BASE64_DEFAULT);
+
+/**
+ * Incremental base64 encoding; the input may be split anywhere.
+ *
+ *   Base64Encoder encoder;
+ *   IOBufQueue out;
+ *   while (auto buf = readSomething()) {
+ *     encoder.encode(*buf, out);
+ *   }
+ *   encoder.finish(out);
+ */
+class Base64Encoder {
+public:
+  explicit Base64Encoder(int flags = BASE64_DEFAULT);
+
+  void encode(ByteRange data, IOBufQueue& out);
+
+  /**
+   * Encode all the buffers of a chain.
+   */
+  void encode(const IOBuf& buf, IOBufQueue& out);
+
+  /**
+   * Write the last, partial quantum. The encoder may then be reused.
+   */
+  void finish(IOBufQueue& out);
+
+  /**
+   * Low level interface: out must have room for maxEncodedSize(n) bytes
+   * (6 for finish()), the end of the output is returned.
+   */
+  char* encode(const uint8_t* data, size_t n, char* out);
+  char* finish(char* out);
+
+  size_t maxEncodedSize(size_t n) const;
+
+private:
+  char* encodeLine(const uint8_t* data, size_t n, char* out);
+
+  int flags_;
+  uint8_t pending_[3];
+  size_t npending_{0};
+  size_t column_{0};  // on the current line, with BASE64_MIME
+};
+
+/**
+ * Incremental strict base64 decoding; the input may be split anywhere.
+ * Errors are thrown as BinasciiError, with positions in the stream.
+ */
+class Base64Decoder {
+public:
+  explicit Base64Decoder(int flags = BASE64_DEFAULT);
+
+  void decode(StringPiece data, IOBufQueue& out);
+
+  /**
+   * Decode all the buffers of a chain.
+   */
+  void decode(const IOBuf& buf, IOBufQueue& out);
+
+  /**
+   * Check that the input is complete (and decode the last quantum if
+   * unpadded). The decoder may then be reused.
+   */
+  void finish(IOBufQueue& out);
+
+  /**
+   * Low level interface: out must have room for maxDecodedSize(n) bytes
+   * (2 for finish()), the end of the output is returned.
+   */
+  char* decode(const char* data, size_t n, char* out);
+  char* finish(char* out);
+
+  static size_t maxDecodedSize(size_t n) { return (n + 3) / 4 * 3; }
+
+private:
+  char* decodeChar(char c, size_t offset, char* out);
+  char* decodeLast(char* out);
+  void reset();
+
+  int flags_;
+  uint8_t quantum_[4];
+  size_t npending_{0};
+  size_t npadding_{0};
+  bool done_{false};        // after the padding
+  size_t offset_{0};        // of the data passed to decode()
+  size_t lastOffset_{0};    // of the last character of quantum_
+};
+
 } // namespace folly
 
 #include <folly/ext/Binascii-inl.h>
 
 #endif /* FOLLY_EXT_BINASCII_H_ */
-
@@ -19,8 +19,20 @@
 #if !(FOLLY_HAVE_LIBGLOG && FOLLY_USE_GLOG)
 
 #include <cerrno>
+#include <climits>
+#include <condition_variable>
 #include <cstdarg>
+#include <mutex>
 #include <system_error>
+#include <thread>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <unordered_map>
+
+#include <folly/Bits.h>
+#include <folly/detail/CacheLocality.h>
 
 namespace folly {
 namespace logging {
@@ -64,50 +76,485 @@ int scnprintf(char* buf, size_t size, const char* format, ...) {
 
 static LogWriter* logger = nullptr;
 
+// Bumped by the reopen signal handler, see LogWriter::reopenOnSignal.
+static std::atomic<int> reopenSignalGeneration(0);
+
+void onReopenSignal(int) {
+  reopenSignalGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Write out the messages still in the ring buffer at exit. The flusher
+// thread is left running, messages logged later by static destructors are
+// written on a best effort basis.
+void flushAtExit() {
+  if (logger) {
+    logger->flush();
+  }
+}
+
+struct CategoryRegistry {
+  std::mutex lock;
+  std::unordered_map<std::string, std::unique_ptr<LogCategory>> categories;
+};
+
+CategoryRegistry& categoryRegistry() {
+  static CategoryRegistry* registry = new CategoryRegistry();
+  return *registry;
+}
+
+/**
+ * Write all iovecs to fd, handling short writes and EINTR.
+ */
+void writevFull(int fd, struct iovec* iov, int count) {
+  while (count > 0) {
+    ssize_t n = writev(fd, iov, count);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;   // nowhere to report a logging failure
+    }
+    while (count > 0 && size_t(n) >= iov->iov_len) {
+      n -= iov->iov_len;
+      ++iov;
+      --count;
+    }
+    if (count > 0) {
+      iov->iov_base = static_cast<char*>(iov->iov_base) + n;
+      iov->iov_len -= n;
+    }
+  }
+}
+
 } // namespace anon
 
+/**
+ * Bounded multi-producer, single-consumer ring of fixed size slots.
+ *
+ * Producers claim a slot by advancing tail_ with a CAS, copy the message
+ * into it and publish it by bumping the slot sequence (Vyukov's bounded
+ * queue). The consumer gathers consecutive published slots into an iovec
+ * array and hands them to writev without an extra copy.
+ *
+ * Consuming is serialized by consumerLock_, so both the flusher thread and
+ * flush() callers may drain the buffer.
+ */
+class LogRingBuffer {
+public:
+  LogRingBuffer(LogWriter* writer, size_t capacity, Overflow overflow)
+    : writer_(writer)
+    , fd_(fileno(writer->file_))
+    , capacity_(nextPowTwo(std::max<size_t>(capacity, 2)))
+    , mask_(capacity_ - 1)
+    , overflow_(overflow)
+    , slots_(new Slot[capacity_])
+    , head_(0)
+    , padding_()
+    , tail_(0)
+    , discarded_(0)
+    , stop_(false) {
+    for (size_t i = 0; i < capacity_; ++i) {
+      slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+    thread_ = std::thread(&LogRingBuffer::run, this);
+  }
+
+  ~LogRingBuffer() {
+    {
+      std::lock_guard<std::mutex> guard(waitLock_);
+      stop_ = true;
+    }
+    waitCond_.notify_one();
+    thread_.join();
+    drain();
+  }
+
+  void write(const char* message, size_t len) {
+    assert(len <= BUF_SIZE);
+    uint64_t pos = tail_.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+      slot = &slots_[pos & mask_];
+      uint64_t seq = slot->seq.load(std::memory_order_acquire);
+      int64_t diff = int64_t(seq) - int64_t(pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // full
+        if (overflow_ == Overflow::DISCARD) {
+          discarded_.fetch_add(1, std::memory_order_relaxed);
+          return;
+        }
+        waitCond_.notify_one();
+        std::this_thread::yield();
+        pos = tail_.load(std::memory_order_relaxed);
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+    memcpy(slot->data, message, len);
+    slot->len = len;
+    slot->seq.store(pos + 1, std::memory_order_release);
+    // wake the flusher early every half buffer of messages, so that a burst
+    // doesn't have to wait for the flush interval
+    if ((pos & (mask_ >> 1)) == 0) {
+      waitCond_.notify_one();
+    }
+  }
+
+  /**
+   * Write out everything published up to now.
+   */
+  void drain() {
+    std::lock_guard<std::mutex> guard(consumerLock_);
+    uint64_t target = tail_.load(std::memory_order_acquire);
+    while (head_ < target) {
+      if (writeBatch() == 0) {
+        // a producer claimed the slot but has not published it yet
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  /**
+   * Run fn while no batch is being written.
+   */
+  template <class F>
+  void exclusive(F fn) {
+    std::lock_guard<std::mutex> guard(consumerLock_);
+    fn();
+  }
+
+  uint64_t discarded() const {
+    return discarded_.load(std::memory_order_relaxed);
+  }
+
+private:
+  struct Slot {
+    std::atomic<uint64_t> seq;
+    size_t len;
+    char data[BUF_SIZE];
+  };
+
+  static constexpr size_t kMaxIovecs = IOV_MAX < 1024 ? IOV_MAX : 1024;
+  static constexpr std::chrono::milliseconds kFlushInterval{10};
+
+  // Called with consumerLock_ held; returns the number of messages written.
+  size_t writeBatch() {
+    struct iovec iov[kMaxIovecs];
+    size_t count = 0;
+    uint64_t pos = head_;
+    while (count < kMaxIovecs) {
+      Slot& slot = slots_[pos & mask_];
+      if (slot.seq.load(std::memory_order_acquire) != pos + 1) {
+        break;
+      }
+      iov[count].iov_base = slot.data;
+      iov[count].iov_len = slot.len;
+      ++count;
+      ++pos;
+    }
+    if (count == 0) {
+      return 0;
+    }
+    writevFull(fd_, iov, count);
+    if (writer_->checkRotation_) {
+      size_t bytes = 0;
+      for (size_t i = 0; i < count; ++i) {
+        bytes += slots_[(head_ + i) & mask_].len;
+      }
+      writer_->afterWrite(bytes);
+    }
+    for (pos = head_; pos < head_ + count; ++pos) {
+      slots_[pos & mask_].seq.store(pos + capacity_,
+                                    std::memory_order_release);
+    }
+    head_ += count;
+    return count;
+  }
+
+  void run() {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(waitLock_);
+        if (stop_) {
+          break;
+        }
+        waitCond_.wait_for(lock, kFlushInterval);
+      }
+      std::lock_guard<std::mutex> guard(consumerLock_);
+      while (writeBatch() == kMaxIovecs) {}
+    }
+  }
+
+  LogWriter* const writer_;
+  const int fd_;
+  const size_t capacity_;
+  const size_t mask_;
+  const Overflow overflow_;
+  std::unique_ptr<Slot[]> slots_;
+
+  // consumer position, guarded by consumerLock_
+  uint64_t head_;
+  std::mutex consumerLock_;
+
+  // keep producers and the consumer on different cache lines
+  char padding_[folly::detail::CacheLocality::kFalseSharingRange];
+  std::atomic<uint64_t> tail_;
+  std::atomic<uint64_t> discarded_;
+
+  std::mutex waitLock_;
+  std::condition_variable waitCond_;
+  bool stop_;
+  std::thread thread_;
+};
+
+constexpr size_t LogRingBuffer::kMaxIovecs;
+constexpr std::chrono::milliseconds LogRingBuffer::kFlushInterval;
+
 LogWriter::LogWriter(Level level, const char* name)
-  : level_(level) {
+  : level_(level)
+  , checkRotation_(false)
+  , bytes_(0)
+  , nextRotation_(0)
+  , reopenGeneration_(0) {
   if (name && strlen(name) > 0) {
     file_ = fopen(name, "a+");
     if (!file_) {
       throw std::system_error(
           errno, std::system_category(), "open log file failed");
     }
+    name_ = name;
+    struct stat st;
+    if (fstat(fileno(file_), &st) == 0) {
+      bytes_ = st.st_size;
+    }
   } else {
     file_ = stderr;
   }
 }
 
 LogWriter::~LogWriter() {
+  buffer_.reset();
   if (file_ != nullptr && file_ != stderr) {
     fclose(file_);
   }
 }
 
-void LogWriter::log(Level level,
-                    const char* file,
-                    int line,
-                    const char* format, ...) {
-  char buf[BUF_SIZE];
+void LogWriter::startAsync(size_t capacity, Overflow overflow) {
+  if (buffer_) {
+    return;
+  }
+  fflush(file_);
+  buffer_.reset(new LogRingBuffer(this, capacity, overflow));
+}
+
+void LogWriter::setRotation(const RotationPolicy& policy) {
+  if (name_.empty()) {
+    return;
+  }
+  rotation_ = policy;
+  rotation_.maxFiles = std::max(rotation_.maxFiles, 1);
+  updateNextRotation();
+  checkRotation_ = true;
+}
+
+void LogWriter::reopenOnSignal(int sig) {
+  if (name_.empty()) {
+    return;
+  }
+  reopenGeneration_ = reopenSignalGeneration.load();
+  struct sigaction sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = onReopenSignal;
+  sa.sa_flags = SA_RESTART;
+  sigemptyset(&sa.sa_mask);
+  if (sigaction(sig, &sa, nullptr) != 0) {
+    throw std::system_error(
+        errno, std::system_category(), "install reopen signal failed");
+  }
+  checkRotation_ = true;
+}
+
+void LogWriter::updateNextRotation() {
+  time_t interval = rotation_.interval.count();
+  if (interval > 0) {
+    nextRotation_ = (time(nullptr) / interval + 1) * interval;
+  }
+}
+
+void LogWriter::afterWrite(size_t len) {
+  size_t bytes = bytes_.fetch_add(len, std::memory_order_relaxed) + len;
+  int generation = reopenSignalGeneration.load(std::memory_order_relaxed);
+  bool bySize = rotation_.maxSize > 0 && bytes >= rotation_.maxSize;
+  bool byTime = rotation_.interval.count() > 0 &&
+    time(nullptr) >= nextRotation_.load(std::memory_order_relaxed);
+  bool bySignal =
+    generation != reopenGeneration_.load(std::memory_order_relaxed);
+  if (!bySize && !byTime && !bySignal) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(rotateLock_);
+  // Check again, another thread may have done it meanwhile
+  if ((rotation_.maxSize > 0 && bytes_ >= rotation_.maxSize) ||
+      (rotation_.interval.count() > 0 && time(nullptr) >= nextRotation_)) {
+    rotateLocked();
+  } else if (reopenSignalGeneration.load() != reopenGeneration_) {
+    reopenGeneration_ = reopenSignalGeneration.load();
+    reopenLocked();
+  }
+}
+
+void LogWriter::rotate() {
+  if (name_.empty()) {
+    return;
+  }
+  auto fn = [this] {
+    std::lock_guard<std::mutex> guard(rotateLock_);
+    rotateLocked();
+  };
+  if (buffer_) {
+    buffer_->exclusive(fn);
+  } else {
+    fn();
+  }
+}
+
+void LogWriter::rotateLocked() {
+  // Holding the FILE lock keeps other threads' messages out of the stdio
+  // buffer until the new file is set up.
+  flockfile(file_);
+  fflush(file_);
+  for (int i = rotation_.maxFiles - 1; i > 0; --i) {
+    std::string from = name_ + "." + std::to_string(i);
+    std::string to = name_ + "." + std::to_string(i + 1);
+    rename(from.c_str(), to.c_str());
+  }
+  rename(name_.c_str(), (name_ + ".1").c_str());
+  updateNextRotation();
+  reopenLocked();
+  funlockfile(file_);
+}
+
+void LogWriter::reopen() {
+  if (name_.empty()) {
+    return;
+  }
+  auto fn = [this] {
+    std::lock_guard<std::mutex> guard(rotateLock_);
+    reopenLocked();
+  };
+  if (buffer_) {
+    buffer_->exclusive(fn);
+  } else {
+    fn();
+  }
+}
+
+void LogWriter::reopenLocked() {
+  flockfile(file_);
+  fflush(file_);
+  int fd = open(name_.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+  if (fd < 0) {
+    funlockfile(file_);
+    return;   // keep writing to the old file
+  }
+  // Replace the descriptor in place, so that the FILE and the ring buffer
+  // keep working without synchronization.
+  dup2(fd, fileno(file_));
+  close(fd);
+  struct stat st;
+  bytes_ = fstat(fileno(file_), &st) == 0 ? st.st_size : 0;
+  if (reopenCallback_) {
+    reopenCallback_();
+  }
+  funlockfile(file_);
+}
+
+void LogWriter::writeDirect(const char* message, size_t len) {
+  if (buffer_) {
+    struct iovec iov = { const_cast<char*>(message), len };
+    writevFull(fileno(file_), &iov, 1);
+  } else {
+    fwrite(message, sizeof(char), len, file_);
+  }
+  bytes_.fetch_add(len, std::memory_order_relaxed);
+}
+
+void LogWriter::flush() {
+  if (buffer_) {
+    buffer_->drain();
+  } else {
+    fflush(file_);
+  }
+}
+
+uint64_t LogWriter::discarded() const {
+  return buffer_ ? buffer_->discarded() : 0;
+}
+
+void LogWriter::logStringAsync(const char* message, size_t len) {
+  if (len <= BUF_SIZE) {
+    buffer_->write(message, len);
+  } else {
+    // too large for a slot (e.g. hexdump), keep ordering and write directly
+    buffer_->drain();
+    fwrite(message, sizeof(char), len, file_);
+    fflush(file_);
+  }
+}
+
+void LogWriter::logStringSync(const char* message, size_t len) {
+  flush();
+  writeDirect(message, len);
+  flush();
+}
+
+size_t LogWriter::formatMessage(char* buf,
+                                Level level,
+                                const char* file,
+                                int line,
+                                const char* format,
+                                va_list args) {
   size_t len = 0;
   size_t size = BUF_SIZE;
 
   len += scnprintf(buf + len, size - len, "[%c", getLevelName(level)[0]);
 #if FOLLY_LOG_TIMESTAMP
-  time_t t = time(nullptr);
-  len += strftime (buf + len, size - len, " %y%m%d %T", localtime(&t));
+  len += scnprintf(buf + len, size - len, " %s",
+                   timeNowFormat(TimeFormat::LOG));
 #endif
   len += scnprintf(buf + len, size - len, " %s:%d] ", file, line);
+  len += vscnprintf(buf + len, size - len, format, args);
+  buf[len++] = '\n';
+  return len;
+}
 
+void LogWriter::log(Level level,
+                    const char* file,
+                    int line,
+                    const char* format, ...) {
+  char buf[BUF_SIZE];
   va_list args;
   va_start(args, format);
-  len += vscnprintf(buf + len, size - len, format, args);
+  size_t len = formatMessage(buf, level, file, line, format, args);
   va_end(args);
-  buf[len++] = '\n';
   logString(buf, len);
 }
 
+void LogWriter::logFatal(const char* file, int line, const char* format, ...) {
+  char buf[BUF_SIZE];
+  va_list args;
+  va_start(args, format);
+  size_t len = formatMessage(buf, Level::FATAL, file, line, format, args);
+  va_end(args);
+  logStringSync(buf, len);
+}
+
 // Hexadecimal dump in the canonical hex + ascii display
 // See -C option in man hexdump
 void LogWriter::logHexdump(const char* file,
@@ -122,9 +569,8 @@ void LogWriter::logHexdump(const char* file,
   int i;
 
 #if FOLLY_LOG_TIMESTAMP
-  time_t t = time(nullptr);
-  len += strftime (buf + len, size - len, "[- %y%m%d %T", localtime(&t));
-  len += scnprintf(buf + len, size - len, " %s:%d] ", file, line);
+  len += scnprintf(buf + len, size - len, "[- %s %s:%d] ",
+                   timeNowFormat(TimeFormat::LOG), file, line);
 #else
   len += scnprintf(buf + len, size - len, "[- %s:%d] ", file, line);
 #endif
@@ -172,6 +618,60 @@ void initialize(Level level, const char* name) {
   }
 }
 
+void initializeAsync(Level level,
+                     const char* name,
+                     size_t capacity,
+                     Overflow overflow) {
+  if (!logger) {
+    logger = new LogWriter(level, name);
+    logger->startAsync(capacity, overflow);
+    atexit(flushAtExit);
+  }
+}
+
+LogCategory* getCategory(const std::string& name) {
+  CategoryRegistry& registry = categoryRegistry();
+  std::lock_guard<std::mutex> guard(registry.lock);
+  auto& category = registry.categories[name];
+  if (!category) {
+    category.reset(new LogCategory(name, get()->getLevel()));
+  }
+  return category.get();
+}
+
+void setCategoryLevel(const std::string& name, Level level) {
+  getCategory(name)->setLevel(level);
+}
+
+void setCategoryLevels(const std::string& spec) {
+  size_t pos = 0;
+  while (pos < spec.size()) {
+    size_t end = spec.find(',', pos);
+    if (end == std::string::npos) {
+      end = spec.size();
+    }
+    size_t eq = spec.find('=', pos);
+    if (eq != std::string::npos && eq > pos && eq + 1 < end) {
+      setCategoryLevel(spec.substr(pos, eq - pos), getLevel(spec[eq + 1]));
+    }
+    pos = end + 1;
+  }
+}
+
+namespace detail {
+
+bool logEveryMs(std::atomic<int64_t>& last, int64_t ms) {
+  int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  int64_t prev = last.load(std::memory_order_relaxed);
+  if (prev != 0 && now - prev < ms) {
+    return false;
+  }
+  return last.compare_exchange_strong(prev, now, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
 LogWriter* get() {
   if (!logger) {
     logger = new LogWriter(DEFAULT_LOGLEVEL);
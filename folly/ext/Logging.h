@@ -30,8 +30,15 @@
 
 #include <cassert>
 #include <csignal>
+#include <cstdarg>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
 
 #include <folly/ext/FixedStream.h>
 #include <folly/ext/Time.h>
@@ -101,25 +108,117 @@ inline const char* getLevelName(Level level) {
   return levelName[static_cast<int>(level)];
 }
 
+/**
+ * What to do when the asynchronous ring buffer is full.
+ *
+ * DISCARD drops the message and counts it, BLOCK waits for the flusher
+ * thread to free a slot.
+ */
+enum class Overflow {
+  DISCARD,
+  BLOCK
+};
+
+constexpr size_t DEFAULT_ASYNC_CAPACITY = 4096;
+
+/**
+ * When to rotate the log file.
+ *
+ * The file is rotated when it grows beyond maxSize bytes, or when an
+ * interval boundary (aligned to the epoch, so 86400 rotates at midnight
+ * UTC) is crossed. Rotated files are renamed to name.1 ... name.maxFiles,
+ * older ones are removed. Zero disables the corresponding trigger.
+ */
+struct RotationPolicy {
+  size_t maxSize{0};
+  std::chrono::seconds interval{0};
+  int maxFiles{1};
+};
+
+class LogRingBuffer;
+
 class LogWriter {
 public:
   LogWriter(Level level, const char* name = nullptr);
   ~LogWriter();
 
+  /**
+   * Switch to asynchronous output.
+   *
+   * Messages are copied into a lock-free ring buffer of `capacity` slots
+   * (rounded up to a power of two, each slot holds BUF_SIZE bytes) and a
+   * dedicated thread writes them out in batches with writev(2).
+   * Should be called once, before logging from multiple threads.
+   */
+  void startAsync(size_t capacity = DEFAULT_ASYNC_CAPACITY,
+                  Overflow overflow = Overflow::DISCARD);
+
+  bool isAsync() const {
+    return buffer_ != nullptr;
+  }
+
+  /**
+   * Write out all pending messages from the calling thread.
+   */
+  void flush();
+
+  /**
+   * Number of messages dropped because the ring buffer was full.
+   */
+  uint64_t discarded() const;
+
+  /**
+   * Rotate the file according to policy; has no effect on stderr.
+   * Should be called once, before logging from multiple threads.
+   */
+  void setRotation(const RotationPolicy& policy);
+
+  /**
+   * Reopen the file the next time something is written after signal
+   * `sig` is received, for external rotation tools like logrotate.
+   */
+  void reopenOnSignal(int sig = SIGHUP);
+
+  /**
+   * Rotate the file now.
+   */
+  void rotate();
+
+  /**
+   * Reopen the file by name, e.g. after it has been moved away.
+   */
+  void reopen();
+
+  /**
+   * Called after the file is reopened or rotated, before anything else is
+   * written to the new file. Used by writers of self-describing formats.
+   */
+  void setReopenCallback(std::function<void()> callback) {
+    reopenCallback_ = std::move(callback);
+  }
+
+  /**
+   * Write straight to the file, bypassing the asynchronous buffer.
+   */
+  void writeDirect(const char* message, size_t len);
+
   void setLevel(Level level) {
-    level_ = level;
+    level_.store(level, std::memory_order_relaxed);
   }
 
   Level getLevel() const {
-    return level_;
+    return level_.load(std::memory_order_relaxed);
   }
 
   bool isEnabled(Level level) const {
-    return level <= level_;
+    return level <= level_.load(std::memory_order_relaxed);
   }
 
   void log(Level level, const char* file, int line, const char* format, ...);
 
+  // As log(Level::FATAL, ...), through logStringSync()
+  void logFatal(const char* file, int line, const char* format, ...);
+
   // Hexadecimal dump in the canonical hex + ascii display
   // See -C option in man hexdump
   void logHexdump(const char* file,
@@ -129,19 +228,132 @@ public:
                   const char* format, ...);
 
   void logString(const char* message, size_t len) {
-    fwrite(message, sizeof(char), len, file_);
+    if (buffer_) {
+      logStringAsync(message, len);
+    } else {
+      fwrite(message, sizeof(char), len, file_);
+      if (checkRotation_) {
+        afterWrite(len);
+      }
+    }
   }
 
+  /**
+   * Write message after the pending ones and flush, bypassing the
+   * asynchronous buffer, which drops messages when full in DISCARD mode.
+   * Used for fatal messages, before aborting.
+   */
+  void logStringSync(const char* message, size_t len);
+
 private:
-  Level level_;         // The current level (everything above is filtered)
+  friend class LogRingBuffer;
+
+  void logStringAsync(const char* message, size_t len);
+
+  // Print the prefix and the formatted message, returning the length
+  size_t formatMessage(char* buf, Level level, const char* file, int line,
+                       const char* format, va_list args);
+
+  // Rotate or reopen the file if needed, len bytes have just been written
+  void afterWrite(size_t len);
+  void rotateLocked();
+  void reopenLocked();
+  void updateNextRotation();
+
+  std::atomic<Level> level_;  // The current level (everything above is
+                              // filtered)
   FILE *file_;          // The output file descriptor
+  std::string name_;    // The file name, empty for stderr
+  std::unique_ptr<LogRingBuffer> buffer_;  // Set in asynchronous mode
+
+  bool checkRotation_;  // Either rotation or reopen on signal is enabled
+  RotationPolicy rotation_;
+  std::atomic<size_t> bytes_;         // Size of the current file
+  std::atomic<time_t> nextRotation_;  // Next interval boundary
+  std::atomic<int> reopenGeneration_; // Last signal generation handled
+  std::mutex rotateLock_;
+  std::function<void()> reopenCallback_;
+};
+
+/**
+ * A named logging category with its own level, for per module control.
+ * Categories live forever; the level can be changed at any time.
+ */
+class LogCategory {
+public:
+  LogCategory(const std::string& name, Level level)
+    : name_(name), level_(level) {}
+
+  const std::string& name() const {
+    return name_;
+  }
+
+  void setLevel(Level level) {
+    level_.store(level, std::memory_order_relaxed);
+  }
+
+  Level getLevel() const {
+    return level_.load(std::memory_order_relaxed);
+  }
+
+  bool isEnabled(Level level) const {
+    return level <= level_.load(std::memory_order_relaxed);
+  }
+
+private:
+  const std::string name_;
+  std::atomic<Level> level_;
 };
 
+/**
+ * Get the category with given name, creating it with the level of the
+ * LogWriter singleton if it does not exist yet.
+ */
+extern LogCategory* getCategory(const std::string& name);
+
+/**
+ * Set the level of the category with given name, creating it if needed.
+ */
+extern void setCategoryLevel(const std::string& name, Level level);
+
+/**
+ * Set levels from a spec like "net=DEBUG,db=W" (only the first letter of
+ * the level matters, as in SET_LOGLEVEL).
+ */
+extern void setCategoryLevels(const std::string& spec);
+
+namespace detail {
+
+// Returns true for the first `n` calls per `count` counter.
+inline bool logFirstN(std::atomic<int>& count, int n) {
+  return count.load(std::memory_order_relaxed) < n &&
+         count.fetch_add(1, std::memory_order_relaxed) < n;
+}
+
+// Returns true for every `n`-th call per `count` counter, from the first.
+inline bool logEveryN(std::atomic<uint64_t>& count, uint64_t n) {
+  return count.fetch_add(1, std::memory_order_relaxed) % n == 0;
+}
+
+// Returns true at most once every `ms` milliseconds per `last` counter.
+bool logEveryMs(std::atomic<int64_t>& last, int64_t ms);
+
+} // namespace detail
+
 /**
  * Public initialization function - creates a singleton instance of LogWriter
  */
 extern void initialize(Level level, const char* name = nullptr);
 
+/**
+ * Same as initialize, but the LogWriter writes asynchronously.
+ * Pending messages are flushed when the process exits normally.
+ */
+extern void initializeAsync(Level level,
+                            const char* name = nullptr,
+                            size_t capacity = DEFAULT_ASYNC_CAPACITY,
+                            Overflow overflow = Overflow::DISCARD);
+
 #ifndef SET_LOGLEVEL
 #define SET_LOGLEVEL(severity) \
   ::folly::logging::initialize(::folly::logging::getLevel(#severity[0]))
@@ -159,7 +371,7 @@ public:
   , abort_(abort) {
     out_ << "[" << getLevelName(level)[0]
 #if FOLLY_LOG_TIMESTAMP
-    << timeNowPrintf(" %y%m%d %T ")
+    << " " << timeNowFormat(TimeFormat::LOG) << " "
 #else
     << " "
 #endif
@@ -168,10 +380,11 @@ public:
 
   ~LogMessage() {
     out_ << std::endl;
-    std::string message = out_.str();
-    get()->logString(message.c_str(), message.size());
-    if (abort_)
+    if (abort_) {
+      get()->logStringSync(out_.output(), out_.output_ptr() - out_.output());
       FOLLY_LOG_ABORT;
+    }
+    get()->logString(out_.output(), out_.output_ptr() - out_.output());
   }
 
   FixedOstream& stream() { return out_; }
@@ -216,6 +429,15 @@ public:
       severity, __FILENAME__, __LINE__, abort).stream()
 #endif
 
+#ifndef LOG_CATEGORY_STREAM
+#define LOG_CATEGORY_STREAM(category, severity, abort)    \
+  (!(category)->isEnabled(severity)) ?                    \
+  (void) 0 :                                              \
+  ::folly::logging::LogMessageVoidify() &                 \
+  ::folly::logging::LogMessage(                           \
+      severity, __FILENAME__, __LINE__, abort).stream()
+#endif
+
 ///////////////////////////////////////////////////////////////////////////
 // Logging macros interface starts here
 
@@ -241,9 +463,9 @@ public:
 #define LOG_ALERT(...)  LOG_FORMAT(::folly::logging::Level::ALERT, __VA_ARGS__)
 #define LOG_EMERG(...)  LOG_FORMAT(::folly::logging::Level::EMERG, __VA_ARGS__)
 
-#define LOG_FATAL(...) do {                                 \
-  LOG_FORMAT(::folly::logging::Level::FATAL, __VA_ARGS__);  \
-  FOLLY_LOG_ABORT;                                          \
+#define LOG_FATAL(...) do {                                             \
+  ::folly::logging::get()->logFatal(__FILENAME__, __LINE__, __VA_ARGS__); \
+  FOLLY_LOG_ABORT;                                                      \
   } while (0)
 
 #ifndef NDEBUG
@@ -273,10 +495,57 @@ public:
 // currently just alias to LOG(DEBUG)
 #define VLOG(i)         LOG_STREAM_DEBUG
 
-#define LOG_FIRST_N(severity, n)                  \
-  static int LOG_OCCURRENCES = 0;               \
-  if (LOG_OCCURRENCES <= n) ++LOG_OCCURRENCES;  \
-  if (LOG_OCCURRENCES <= n) LOG(severity)
+// Per module logging, with a category from getCategory:
+//
+//   static auto* netLog = ::folly::logging::getCategory("net");
+//   CLOG(netLog, DEBUG) << "connected to " << peer;
+#define CLOG(category, severity) CLOG_STREAM_ ## severity(category)
+
+#define CLOG_STREAM_TRACE(c) \
+  LOG_CATEGORY_STREAM(c, ::folly::logging::Level::TRACE, false)
+#define CLOG_STREAM_DEBUG(c) \
+  LOG_CATEGORY_STREAM(c, ::folly::logging::Level::DEBUG, false)
+#define CLOG_STREAM_INFO(c) \
+  LOG_CATEGORY_STREAM(c, ::folly::logging::Level::INFO, false)
+#define CLOG_STREAM_NOTICE(c) \
+  LOG_CATEGORY_STREAM(c, ::folly::logging::Level::NOTICE, false)
+#define CLOG_STREAM_WARN(c) \
+  LOG_CATEGORY_STREAM(c, ::folly::logging::Level::WARN, false)
+#define CLOG_STREAM_WARNING(c) \
+  LOG_CATEGORY_STREAM(c, ::folly::logging::Level::WARN, false)
+#define CLOG_STREAM_ERROR(c) \
+  LOG_CATEGORY_STREAM(c, ::folly::logging::Level::ERROR, false)
+#define CLOG_STREAM_CRIT(c) \
+  LOG_CATEGORY_STREAM(c, ::folly::logging::Level::CRIT, false)
+#define CLOG_STREAM_ALERT(c) \
+  LOG_CATEGORY_STREAM(c, ::folly::logging::Level::ALERT, false)
+#define CLOG_STREAM_EMERG(c) \
+  LOG_CATEGORY_STREAM(c, ::folly::logging::Level::EMERG, false)
+#define CLOG_STREAM_FATAL(c) \
+  LOG_CATEGORY_STREAM(c, ::folly::logging::Level::FATAL, true)
+
+// Rate limited logging. Each call site keeps its own atomic counter, so
+// these are safe to use from multiple threads. Like LOG, each expands to
+// a single expression, so it can be the body of an unbraced if / else.
+
+// A static atomic counter of the call site, by the lambda's unique type
+#define FOLLY_LOG_SITE_COUNTER(type)                                      \
+  ([]() -> ::std::atomic<type>& {                                         \
+    static ::std::atomic<type> counter{0};                                \
+    return counter;                                                       \
+  }())
+
+#define LOG_FIRST_N(severity, n)                                          \
+  !::folly::logging::detail::logFirstN(                                   \
+      FOLLY_LOG_SITE_COUNTER(int), (n)) ? (void) 0 : LOG(severity)
+
+#define LOG_EVERY_N(severity, n)                                          \
+  !::folly::logging::detail::logEveryN(                                   \
+      FOLLY_LOG_SITE_COUNTER(uint64_t), (n)) ? (void) 0 : LOG(severity)
+
+#define LOG_EVERY_MS(severity, ms)                                        \
+  !::folly::logging::detail::logEveryMs(                                  \
+      FOLLY_LOG_SITE_COUNTER(int64_t), (ms)) ? (void) 0 : LOG(severity)
 
 #ifndef NDEBUG
 # define DCHECK(condition) \
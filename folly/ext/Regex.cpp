@@ -18,7 +18,14 @@
 
 #include <folly/ext/Regex.h>
 
+#include <algorithm>
+#include <cstring>
+#include <deque>
+
+#include <glog/logging.h>
+
 #include <folly/Conv.h>
+#include <folly/ThreadLocal.h>
 
 namespace folly {
 
@@ -36,78 +43,377 @@ void region_free(OnigRegion* r) {
   onig_region_free(r, 1);
 }
 
-} // namespace anon
+typedef std::shared_ptr<OnigRegion> OnigRegionPtr;
 
-bool regexValidate(StringPiece pattern, std::string* error) {
+std::shared_ptr<OnigRegexType> compile(StringPiece pattern,
+                                       OnigOptionType options) {
   OnigRegex tmp = NULL;
   OnigErrorInfo err;
   int r = onig_new(&tmp,
-                   (OnigUChar*)pattern.data(),
-                   (OnigUChar*)pattern.data() + pattern.size(),
-                   ONIG_OPTION_CAPTURE_GROUP,
+                   (OnigUChar*)pattern.begin(),
+                   (OnigUChar*)pattern.end(),
+                   options,
                    ONIG_ENCODING_UTF8,
                    ONIG_SYNTAX_DEFAULT,
                    &err);
   if (r != ONIG_NORMAL) {
     OnigUChar s[ONIG_MAX_ERROR_MESSAGE_LEN];
     onig_error_code_to_str(s, r, &err);
-    *error = (const char*)s;
+    LOG(ERROR) << "regex error: " << s << " (" << pattern << ")";
+    if (tmp) {
+      onig_free(tmp);
+    }
+    return nullptr;
   }
-  if (tmp) {
-    onig_free(tmp);
+  return std::shared_ptr<OnigRegexType>(tmp, onig_free);
+}
+
+} // namespace anon
+
+constexpr size_t RegexCache::kDefaultCapacity;
+
+RegexCache::RegexCache(size_t capacity) : cache_(capacity) {
+}
+
+std::shared_ptr<OnigRegexType> RegexCache::get(StringPiece pattern,
+                                               OnigOptionType options) {
+  std::string key;
+  key.reserve(sizeof(options) + pattern.size());
+  key.append((const char*)&options, sizeof(options));
+  key.append(pattern.begin(), pattern.end());
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = cache_.find(key);
+    if (it != cache_.end()) {
+      return it->second;
+    }
+  }
+  // Compile outside of the lock; if another thread compiled the same
+  // pattern meanwhile, the last one wins, both are equivalent.
+  auto re = compile(pattern, options);
+  if (re) {
+    std::lock_guard<std::mutex> guard(lock_);
+    cache_.set(key, re);
   }
+  return re;
+}
+
+size_t RegexCache::size() const {
+  std::lock_guard<std::mutex> guard(lock_);
+  return cache_.size();
+}
+
+void RegexCache::clear() {
+  std::lock_guard<std::mutex> guard(lock_);
+  cache_.clear();
 }
 
-void Regex::Regex(StringPiece pattern, OnigOptionType options) {
-  pattern_ = pattern.str();
+RegexCache& RegexCache::getDefault() {
+  // Leaked, to be usable by static Regex objects
+  static auto cache = new RegexCache();
+  return *cache;
+}
 
+bool regexValidate(StringPiece pattern, std::string* error) {
   OnigRegex tmp = NULL;
   OnigErrorInfo err;
-  if (!(options & ONIG_OPTION_DONT_CAPTURE_GROUP)) {
-    options |= ONIG_OPTION_CAPTURE_GROUP;
-  }
   int r = onig_new(&tmp,
-                   (OnigUChar*)pattern.begin(),
-                   (OnigUChar*)pattern.end(),
-                   options,
+                   (OnigUChar*)pattern.data(),
+                   (OnigUChar*)pattern.data() + pattern.size(),
+                   ONIG_OPTION_CAPTURE_GROUP,
                    ONIG_ENCODING_UTF8,
                    ONIG_SYNTAX_DEFAULT,
                    &err);
-  if (r != ONIG_NORMAL) {
+  if (r != ONIG_NORMAL && error) {
     OnigUChar s[ONIG_MAX_ERROR_MESSAGE_LEN];
     onig_error_code_to_str(s, r, &err);
-    LOG(ERROR) << "regex error: " << s << " (" << pattern_ << ")";
-    if (tmp) {
-      onig_free(tmp);
-    }
-  } else {
-    re_.reset(tmp, onig_free);
+    *error = (const char*)s;
   }
+  if (tmp) {
+    onig_free(tmp);
+  }
+  return r == ONIG_NORMAL;
+}
+
+Regex::Regex(StringPiece pattern, OnigOptionType options, RegexCache* cache)
+  : pattern_(pattern.str()) {
+  if (!(options & ONIG_OPTION_DONT_CAPTURE_GROUP)) {
+    options |= ONIG_OPTION_CAPTURE_GROUP;
+  }
+  re_ = cache ? cache->get(pattern, options) : compile(pattern, options);
 }
 
 #ifndef ONIG_OPTION_NOTGPOS
 #define ONIG_OPTION_NOTGPOS (ONIG_OPTION_MAXBIT << 1)
 #endif
 
+namespace {
+
+const char* search(StringPiece sp, const Regex& regex, OnigRegion* region,
+                   const char* from, const char* to,
+                   OnigOptionType options) {
+  from = from ?: sp.begin();
+  to = to ?: sp.end();
+  const char* gpos = (options & ONIG_OPTION_NOTGPOS) ? nullptr : from;
+  options &= ~ONIG_OPTION_NOTGPOS;
+
+  return ONIG_MISMATCH != onig_search_gpos(regex.regex().get(),
+                                           (OnigUChar*)sp.begin(),
+                                           (OnigUChar*)sp.end(),
+                                           (OnigUChar*)gpos,
+                                           (OnigUChar*)from,
+                                           (OnigUChar*)to,
+                                           region,
+                                           options) ? sp.begin() : nullptr;
+}
+
+struct RegionPool {
+  ~RegionPool() {
+    for (auto region : regions) {
+      region_free(region);
+    }
+  }
+
+  std::vector<OnigRegion*> regions;
+};
+
+const size_t kRegionPoolSize = 16;
+
+RegionPool& regionPool() {
+  static ThreadLocal<RegionPool> pool;
+  return *pool;
+}
+
+OnigRegion* acquireRegion() {
+  auto& regions = regionPool().regions;
+  if (regions.empty()) {
+    return onig_region_new();
+  }
+  auto region = regions.back();
+  regions.pop_back();
+  return region;
+}
+
+void releaseRegion(OnigRegion* region) {
+  auto& regions = regionPool().regions;
+  if (regions.size() < kRegionPoolSize) {
+    regions.push_back(region);
+  } else {
+    region_free(region);
+  }
+}
+
+OnigRegionPtr& spareRegion() {
+  static ThreadLocal<OnigRegionPtr> region;
+  return *region;
+}
+
+} // namespace anon
+
 bool regexSearch(StringPiece sp, Match& match, const Regex& regex,
                  const char* from, const char* to,
                  OnigOptionType options) {
-  if (regex.isValid()) {
-    OnigRegionPtr region(onig_region_new(), region_free);
-    from = from ?: sp.begin();
-    to = to ?: sp.end();
-    const char* gpos = (options & ONIG_OPTION_NOTGPOS) ? nullptr : from;
-    options &= ~ONIG_OPTION_NOTGPOS;
-
-    if (ONIG_MISMATCH != onig_search_gpos(regex.get(),
-                                          (OnigUChar*)sp.begin(),
-                                          (OnigUChar*)sp.end(),
-                                          (OnigUChar*)gpos,
-                                          (OnigUChar*)from,
-                                          (OnigUChar*)to,
-                                          region.get(),
-                                          options)) {
-      match = Match(regex.regex(), region);
+  if (!regex.isValid()) {
+    return false;
+  }
+  // Search into the spare region, so that match is left as it was on
+  // failure; on success, the region of match becomes the spare one if
+  // nothing else shares it.
+  OnigRegionPtr& spare = spareRegion();
+  if (!spare.unique()) {
+    spare.reset(onig_region_new(), region_free);
+  }
+  if (!search(sp, regex, spare.get(), from, to, options)) {
+    return false;
+  }
+  OnigRegionPtr region = std::move(spare);
+  if (match.region_.unique()) {
+    spare = std::move(match.region_);
+  }
+  match = Match(sp, regex.regex(), region);
+  return true;
+}
+
+bool regexSearch(StringPiece sp, MatchRegion& match, const Regex& regex,
+                 const char* from, const char* to,
+                 OnigOptionType options) {
+  match.re_.reset();
+  if (regex.isValid() &&
+      search(sp, regex, match.region_, from, to, options)) {
+    match.buffer_ = sp;
+    match.re_ = regex.regex();
+    return true;
+  }
+  return false;
+}
+
+MatchRegion::MatchRegion() : region_(acquireRegion()) {
+}
+
+MatchRegion::~MatchRegion() {
+  if (region_) {
+    releaseRegion(region_);
+  }
+}
+
+MatchRegion::MatchRegion(MatchRegion&& other) noexcept
+  : buffer_(other.buffer_)
+  , re_(std::move(other.re_))
+  , region_(other.region_) {
+  other.region_ = nullptr;
+}
+
+MatchRegion& MatchRegion::operator=(MatchRegion&& other) noexcept {
+  std::swap(buffer_, other.buffer_);
+  std::swap(re_, other.re_);
+  std::swap(region_, other.region_);
+  return *this;
+}
+
+StringPiece MatchRegion::capture(StringPiece name) const {
+  if (!re_) {
+    return StringPiece();
+  }
+  int n = onig_name_to_backref_number(re_.get(),
+                                      (const OnigUChar*)name.begin(),
+                                      (const OnigUChar*)name.end(),
+                                      region_);
+  return n > 0 ? matchPiece(n) : StringPiece();
+}
+
+constexpr size_t IOBufRegexSearcher::kDefaultMaxMatchLength;
+
+namespace {
+
+// Bytes kept between the end of a match and the end of a window which
+// isn't the end of the chain: \z matches there, and \Z before a newline.
+const size_t kEndMargin = 2;
+
+} // namespace anon
+
+IOBufRegexSearcher::IOBufRegexSearcher(const Regex& regex,
+                                       const IOBuf* buf,
+                                       size_t maxMatchLength,
+                                       OnigOptionType options)
+  : regex_(regex)
+  , options_(options)
+  , maxMatchLength_(std::max(maxMatchLength, size_t(1))) {
+  if (buf) {
+    auto p = buf;
+    do {
+      if (p->length() > 0) {
+        auto data = reinterpret_cast<const char*>(p->data());
+        segments_.emplace_back(length_, StringPiece(data, p->length()));
+        length_ += p->length();
+      }
+      p = p->next();
+    } while (p != buf);
+  }
+}
+
+void IOBufRegexSearcher::setWindow() {
+  const size_t m = maxMatchLength_;
+  if (segments_.empty()) {
+    window_ = scratch_;
+    windowOffset_ = 0;
+    return;
+  }
+  while (segment_ + 1 < segments_.size() &&
+         pos_ >= segments_[segment_ + 1].first) {
+    ++segment_;
+  }
+  // In place if the segment holds maxMatchLength bytes of context before
+  // pos_ and after the last position searched from, or the chain ends.
+  size_t begin = segments_[segment_].first;
+  size_t end = begin + segments_[segment_].second.size();
+  if ((begin == 0 || pos_ - begin >= m) &&
+      (end == length_ || end - pos_ > m + kEndMargin)) {
+    window_ = segments_[segment_].second;
+    windowOffset_ = begin;
+    return;
+  }
+  begin = pos_ >= m ? pos_ - m : 0;
+  end = std::min(length_, pos_ + 2 * m + kEndMargin);
+  size_t i = segment_;
+  while (segments_[i].first > begin) {
+    --i;
+  }
+  scratch_.clear();
+  for (size_t p = begin; p < end; ++i) {
+    auto& seg = segments_[i];
+    size_t from = p - seg.first;
+    size_t n = std::min(seg.second.size() - from, end - p);
+    scratch_.append(seg.second.begin() + from, n);
+    p += n;
+  }
+  window_ = scratch_;
+  windowOffset_ = begin;
+}
+
+bool IOBufRegexSearcher::next() {
+  auto isTrail = [](char c) { return (c & 0xc0) == 0x80; };
+  match_.re_.reset();
+  if (!regex_.isValid()) {
+    return false;
+  }
+  while (pos_ <= length_) {
+    setWindow();
+    bool atEnd = windowOffset_ + window_.size() == length_;
+    const char* start = window_.begin() + (pos_ - windowOffset_);
+    // The last start with maxMatchLength + kEndMargin bytes after it in
+    // the window.
+    // Not passed as the search range, which also bounds the subject in
+    // some Oniguruma versions.
+    const char* last = window_.end();
+    if (!atEnd) {
+      last -= maxMatchLength_ + kEndMargin;
+      while (last > start && isTrail(*last)) {
+        --last;
+      }
+    }
+    int r = onig_search(regex_.regex().get(),
+                        (OnigUChar*)window_.begin(),
+                        (OnigUChar*)window_.end(),
+                        (OnigUChar*)start,
+                        (OnigUChar*)window_.end(),
+                        match_.region_,
+                        options_ | (atEnd ? 0 : ONIG_OPTION_NOTEOL));
+    bool found = r != ONIG_MISMATCH && window_.begin() + r <= last;
+    if (found && !atEnd &&
+        size_t(match_.region_->end[0]) + kEndMargin > window_.size()) {
+      // Stopped by the end of the window, which \z and \Z take for the
+      // end of the input: longer than maxMatchLength, or no match at all.
+      // Search from its start again with as much text after it as
+      // possible, or else go past it.
+      found = false;
+      if (window_.begin() + r > start) {
+        pos_ = windowOffset_ + r;
+        continue;
+      }
+      last = start;
+    }
+    size_t next;
+    if (!found) {
+      if (atEnd) {
+        pos_ = length_ + 1;
+        return false;
+      }
+      next = last - window_.begin() + 1;
+    } else {
+      match_.buffer_ = window_;
+      match_.re_ = regex_.regex();
+      next = match_.end();
+      if (next > size_t(r)) {
+        pos_ = windowOffset_ + next;
+        return true;
+      }
+      ++next;   // past an empty match
+    }
+    while (next < window_.size() && isTrail(window_[next])) {
+      ++next;
+    }
+    pos_ = windowOffset_ + next;
+    if (found) {
       return true;
     }
   }
@@ -174,7 +480,7 @@ std::map<std::string, std::string> Match::captures() const {
   const char* buffer = buffer_.data();
   OnigRegion* match = region_.get();
   OnigRegexType* re = re_.get();
-  for (size_t i = 0; i < match->num_regs; ++i) {
+  for (int i = 0; i < match->num_regs; ++i) {
     if (match->beg[i] != -1)
       out.emplace(
         to<std::string>(i),
@@ -182,6 +488,7 @@ std::map<std::string, std::string> Match::captures() const {
   }
   UData udata = { buffer, match, &out, nullptr };
   onig_foreach_name(re, &copyNamedCaptures, &udata);
+  return out;
 }
 
 std::multimap<std::string, SizeRange> Match::captureIndices() const {
@@ -189,15 +496,325 @@ std::multimap<std::string, SizeRange> Match::captureIndices() const {
   const char* buffer = buffer_.data();
   OnigRegion* match = region_.get();
   OnigRegexType* re = re_.get();
-  for (size_t i = 0; i < match->num_regs; ++i) {
+  for (int i = 0; i < match->num_regs; ++i) {
     if (match->beg[i] != -1)
       out.emplace(to<std::string>(i), SizeRange(match->beg[i], match->end[i]));
   }
   UData udata = { buffer, match, nullptr, &out };
   onig_foreach_name(re, &copyNamedCaptureIndices, &udata);
+  return out;
+}
+
+namespace detail {
+
+namespace {
+
+// Skip a character class, p is after the '['. Returns the position after
+// the closing ']', or nullptr if unsure where it is.
+const char* skipClass(const char* p, const char* end) {
+  if (p != end && *p == '^') {
+    ++p;
+  }
+  if (p != end && *p == ']') {
+    return nullptr;
+  }
+  int depth = 1;
+  while (p != end) {
+    char c = *p++;
+    if (c == '\\') {
+      if (p == end) {
+        return nullptr;
+      }
+      ++p;
+    } else if (c == '[') {
+      ++depth;    // nested class or [:alpha:]
+    } else if (c == ']' && --depth == 0) {
+      return p;
+    }
+  }
+  return nullptr;
+}
+
+// Skip a group, p is after the '('. Returns the position after the
+// closing ')', or nullptr if unsure where it is.
+const char* skipGroup(const char* p, const char* end) {
+  int depth = 1;
+  while (p != end) {
+    char c = *p++;
+    if (c == '\\') {
+      if (p == end) {
+        return nullptr;
+      }
+      ++p;
+    } else if (c == '[') {
+      p = skipClass(p, end);
+      if (!p) {
+        return nullptr;
+      }
+    } else if (c == '(') {
+      if (end - p >= 2 && p[0] == '?' && p[1] == '#') {
+        p = static_cast<const char*>(memchr(p, ')', end - p));
+        if (!p) {
+          return nullptr;
+        }
+        ++p;
+      } else {
+        ++depth;
+      }
+    } else if (c == ')' && --depth == 0) {
+      return p;
+    }
+  }
+  return nullptr;
+}
+
+// Skip an interval {n}, {n,}, {,m} or {n,m}, p is after the '{'.
+const char* skipInterval(const char* p, const char* end) {
+  bool digit = false;
+  while (p != end && isdigit(uint8_t(*p))) {
+    ++p;
+    digit = true;
+  }
+  if (p != end && *p == ',') {
+    ++p;
+  }
+  while (p != end && isdigit(uint8_t(*p))) {
+    ++p;
+    digit = true;
+  }
+  return digit && p != end && *p == '}' ? p + 1 : nullptr;
+}
+
+} // namespace anon
+
+std::string regexRequiredLiteral(StringPiece pattern, OnigOptionType options) {
+  if (options & (ONIG_OPTION_IGNORECASE | ONIG_OPTION_EXTEND)) {
+    return "";
+  }
+  // run is the current sequence of literal atoms, last the size of the last
+  // one (0 if the last atom was not a literal): a quantifier removes it.
+  std::string best;
+  std::string run;
+  size_t last = 0;
+  auto endRun = [&]() {
+    if (run.size() > best.size()) {
+      best = run;
+    }
+    run.clear();
+    last = 0;
+  };
+  const char* p = pattern.begin();
+  const char* end = pattern.end();
+  while (p != end) {
+    char c = *p++;
+    switch (c) {
+      case '\\': {
+        if (p == end) {
+          return "";
+        }
+        char e = *p++;
+        if (e & 0x80) {
+          return "";
+        }
+        if (!isalnum(e)) {
+          run += e;
+          last = 1;
+          break;
+        }
+        const char* special = strchr("tnrfvae", e);
+        if (special) {
+          run += "\t\n\r\f\v\a\x1b"[special - "tnrfvae"];
+          last = 1;
+        } else if (strchr("dDwWsShHbBAzZG", e)) {
+          endRun();
+        } else {
+          return "";    // back reference, code point, property...
+        }
+        break;
+      }
+      case '[':
+        p = skipClass(p, end);
+        if (!p) {
+          return "";
+        }
+        endRun();
+        break;
+      case '(':
+        if (end - p >= 2 && p[0] == '?' && strchr("imxadlu-", p[1])) {
+          return "";    // inline options
+        }
+        p = skipGroup(p, end);
+        if (!p) {
+          return "";
+        }
+        endRun();
+        break;
+      case '{':
+        p = skipInterval(p, end);
+        if (!p) {
+          return "";
+        }
+        // fall through
+      case '*':
+      case '?':
+        run.resize(run.size() - last);
+        endRun();
+        break;
+      case '+':
+        endRun();
+        break;
+      case ')':
+      case '|':
+        return "";
+      case '.':
+      case '^':
+      case '$':
+        endRun();
+        break;
+      default:
+        if ((c & 0xc0) == 0x80 && last > 0) {
+          ++last;   // continuation of a multibyte code point
+        } else {
+          last = 1;
+        }
+        run += c;
+        break;
+    }
+  }
+  endRun();
+  return best;
+}
+
+} // namespace detail
+
+RegexSet::RegexSet() : nodes_(1) {
+  std::fill(root_, root_ + 256, 0);
+}
+
+size_t RegexSet::add(StringPiece pattern, OnigOptionType options) {
+  uint32_t index = regexes_.size();
+  regexes_.emplace_back(pattern, options);
+  std::string literal = detail::regexRequiredLiteral(pattern, options);
+  filtered_.push_back(!literal.empty());
+  if (!literal.empty()) {
+    addLiteral(literal, index);
+    buildFailureLinks();
+  }
+  return index;
+}
+
+std::vector<size_t> RegexSet::matches(StringPiece sp) const {
+  std::vector<bool> candidates;
+  findCandidates(sp, candidates);
+  std::vector<size_t> out;
+  for (size_t i = 0; i < regexes_.size(); ++i) {
+    auto re = regexes_[i].regex().get();
+    if (candidates[i] && re &&
+        onig_search(re,
+                    (OnigUChar*)sp.begin(),
+                    (OnigUChar*)sp.end(),
+                    (OnigUChar*)sp.begin(),
+                    (OnigUChar*)sp.end(),
+                    nullptr,
+                    ONIG_OPTION_NONE) != ONIG_MISMATCH) {
+      out.push_back(i);
+    }
+  }
+  return out;
+}
+
+ssize_t RegexSet::firstMatch(StringPiece sp, Match* match) const {
+  std::vector<bool> candidates;
+  findCandidates(sp, candidates);
+  Match m;
+  for (size_t i = 0; i < regexes_.size(); ++i) {
+    if (candidates[i] && regexSearch(sp, m, regexes_[i])) {
+      if (match) {
+        *match = std::move(m);
+      }
+      return i;
+    }
+  }
+  return -1;
+}
+
+void RegexSet::addLiteral(StringPiece literal, uint32_t index) {
+  uint32_t node = 0;
+  for (uint8_t c : literal) {
+    auto& next = nodes_[node].next;
+    auto it = std::lower_bound(next.begin(), next.end(),
+                               std::make_pair(c, uint32_t(0)));
+    if (it == next.end() || it->first != c) {
+      uint32_t n = nodes_.size();
+      next.emplace(it, c, n);
+      nodes_.emplace_back();  // invalidates next
+      node = n;
+    } else {
+      node = it->second;
+    }
+  }
+  nodes_[node].patterns.push_back(index);
+}
+
+uint32_t RegexSet::child(uint32_t node, uint8_t c) const {
+  auto& next = nodes_[node].next;
+  auto it = std::lower_bound(next.begin(), next.end(),
+                             std::make_pair(c, uint32_t(0)));
+  return it != next.end() && it->first == c ? it->second : 0;
+}
+
+void RegexSet::buildFailureLinks() {
+  std::fill(root_, root_ + 256, 0);
+  std::deque<uint32_t> queue;
+  for (auto& p : nodes_[0].next) {
+    root_[p.first] = p.second;
+    nodes_[p.second].fail = 0;
+    nodes_[p.second].output = 0;
+    queue.push_back(p.second);
+  }
+  // breadth first, so the fail links of shorter prefixes are known
+  while (!queue.empty()) {
+    uint32_t node = queue.front();
+    queue.pop_front();
+    for (auto& p : nodes_[node].next) {
+      uint32_t f = nodes_[node].fail;
+      while (f != 0 && child(f, p.first) == 0) {
+        f = nodes_[f].fail;
+      }
+      f = f == 0 ? root_[p.first] : child(f, p.first);
+      auto& n = nodes_[p.second];
+      n.fail = f;
+      n.output = nodes_[f].patterns.empty() ? nodes_[f].output : f;
+      queue.push_back(p.second);
+    }
+  }
+}
+
+void RegexSet::findCandidates(StringPiece sp,
+                              std::vector<bool>& candidates) const {
+  candidates.resize(regexes_.size());
+  for (size_t i = 0; i < regexes_.size(); ++i) {
+    candidates[i] = !filtered_[i];
+  }
+  if (nodes_.size() == 1) {
+    return;
+  }
+  uint32_t node = 0;
+  for (uint8_t c : sp) {
+    uint32_t n = 0;
+    while (node != 0 && (n = child(node, c)) == 0) {
+      node = nodes_[node].fail;
+    }
+    node = node == 0 ? root_[c] : n;
+    uint32_t out = nodes_[node].patterns.empty() ? nodes_[node].output : node;
+    for (; out != 0; out = nodes_[out].output) {
+      for (auto i : nodes_[out].patterns) {
+        candidates[i] = true;
+      }
+    }
+  }
 }
 
 } // namespace folly
 
 #endif
-
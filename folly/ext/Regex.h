@@ -21,16 +21,62 @@
 
 #include <oniguruma.h>
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <folly/EvictingCacheMap.h>
 #include <folly/Range.h>
 #include <folly/ext/NumericRange.h>
+#include <folly/io/IOBuf.h>
 
 namespace folly {
 
+/**
+ * Bounded LRU cache of compiled patterns, keyed by pattern and options.
+ * Thread-safe; compiled patterns are shared, searching them concurrently
+ * is fine.
+ */
+class RegexCache {
+public:
+  static constexpr size_t kDefaultCapacity = 1024;
+
+  explicit RegexCache(size_t capacity = kDefaultCapacity);
+
+  /**
+   * Return the compiled pattern, compiling it on a miss. Invalid patterns
+   * are logged and not cached, nullptr is returned for them.
+   */
+  std::shared_ptr<OnigRegexType> get(StringPiece pattern,
+                                     OnigOptionType options);
+
+  size_t size() const;
+
+  void clear();
+
+  /**
+   * The cache used by Regex by default.
+   */
+  static RegexCache& getDefault();
+
+private:
+  mutable std::mutex lock_;
+  EvictingCacheMap<std::string, std::shared_ptr<OnigRegexType>> cache_;
+};
+
 class Regex {
 public:
   Regex() : pattern_("(?=un)initialized") { }
 
-  Regex(StringPiece pattern, OnigOptionType options = ONIG_OPTION_NONE);
+  /**
+   * Look up pattern in cache, compiling it there if missing; with a null
+   * cache the pattern is compiled for this Regex (and its copies) only.
+   */
+  Regex(StringPiece pattern,
+        OnigOptionType options = ONIG_OPTION_NONE,
+        RegexCache* cache = &RegexCache::getDefault());
 
   bool isValid() const {
     return re_ != nullptr;
@@ -97,7 +143,8 @@ public:
   const StringPiece& origin() const { return buffer_; }
 
   StringPiece matchPiece(size_t i) const {
-    return buffer_.subpiece((*this)[i]);
+    return matched(i) ? buffer_.subpiece(begin(i), end(i) - begin(i))
+                      : StringPiece();
   }
 
   explicit operator bool() const { return bool(region_); }
@@ -106,11 +153,96 @@ public:
   std::multimap<std::string, SizeRange> captureIndices() const;
 
 private:
+  // reuses region_ when not shared with another Match
+  friend bool regexSearch(StringPiece, Match&, const Regex&,
+                          const char*, const char*, OnigOptionType);
+
   StringPiece buffer_;
   std::shared_ptr<OnigRegexType> re_;
   std::shared_ptr<OnigRegion> region_;
 };
 
+/**
+ * Match results in a region owned by the caller. Unlike Match, searching
+ * into it again reuses the region, and captures are returned as pieces of
+ * the input, so matching in a loop doesn't allocate. Regions are taken
+ * from (and given back to) a small per-thread pool, which makes a local
+ * MatchRegion per search cheap as well.
+ *
+ *   MatchRegion m;
+ *   for (auto line : lines) {
+ *     if (regexSearch(line, m, re)) {
+ *       StringPiece user = m.capture("user");
+ *     }
+ *   }
+ */
+class MatchRegion {
+public:
+  MatchRegion();
+  ~MatchRegion();
+
+  MatchRegion(MatchRegion&& other) noexcept;
+  MatchRegion& operator=(MatchRegion&& other) noexcept;
+
+  MatchRegion(const MatchRegion&) = delete;
+  MatchRegion& operator=(const MatchRegion&) = delete;
+
+  /**
+   * Number of groups of the last successful search, 0 if none.
+   */
+  size_t size() const {
+    return re_ ? region_->num_regs : 0;
+  }
+
+  bool matched(size_t i = 0) const {
+    return i < size() && region_->beg[i] != -1;
+  }
+
+  ptrdiff_t begin(size_t i = 0) const {
+    return i < size() ? region_->beg[i] : -1;
+  }
+
+  ptrdiff_t end(size_t i = 0) const {
+    return i < size() ? region_->end[i] : -1;
+  }
+
+  bool empty(size_t i = 0) const {
+    return begin(i) == end(i);
+  }
+
+  SizeRange operator[](size_t i) const {
+    if (matched(i)) {
+      return SizeRange(begin(i), end(i));
+    } else {
+      return SizeRange();
+    }
+  }
+
+  const StringPiece& origin() const { return buffer_; }
+
+  StringPiece matchPiece(size_t i) const {
+    return matched(i) ? buffer_.subpiece(begin(i), end(i) - begin(i))
+                      : StringPiece();
+  }
+
+  /**
+   * The named group; for a name used by several groups, the last one
+   * which matched. Empty if there is no such group or it didn't match.
+   */
+  StringPiece capture(StringPiece name) const;
+
+  explicit operator bool() const { return bool(re_); }
+
+private:
+  friend bool regexSearch(StringPiece, MatchRegion&, const Regex&,
+                          const char*, const char*, OnigOptionType);
+  friend class IOBufRegexSearcher;
+
+  StringPiece buffer_;
+  std::shared_ptr<OnigRegexType> re_;   // of the last successful search
+  OnigRegion* region_;
+};
+
 bool regexValidate(StringPiece pattern, std::string* error = nullptr);
 
 bool regexSearch(StringPiece sp, Match& match, const Regex& regex,
@@ -118,6 +250,143 @@ bool regexSearch(StringPiece sp, Match& match, const Regex& regex,
                  const char* to = nullptr,
                  OnigOptionType options = ONIG_OPTION_NONE);
 
+bool regexSearch(StringPiece sp, MatchRegion& match, const Regex& regex,
+                 const char* from = nullptr,
+                 const char* to = nullptr,
+                 OnigOptionType options = ONIG_OPTION_NONE);
+
+/**
+ * Finds all the matches of a regex in an IOBuf chain, in order, without
+ * coalescing the chain: the search runs in place inside each buffer, only
+ * windows of about 3 * maxMatchLength bytes around buffer boundaries are
+ * copied. A match crossing a boundary is found if it (and the text its
+ * anchors and look-arounds inspect) is at most maxMatchLength bytes long.
+ * \z and \Z only match at the end of the chain.
+ *
+ *   IOBufRegexSearcher searcher(re, buf.get());
+ *   while (searcher.next()) {
+ *     size_t pos = searcher.offset();    // of the match in the chain
+ *     StringPiece text = searcher.match().matchPiece(0);
+ *   }
+ *
+ * The pieces of a match are valid until the next call to next(), as long
+ * as the chain is.
+ */
+class IOBufRegexSearcher {
+public:
+  static constexpr size_t kDefaultMaxMatchLength = 4096;
+
+  IOBufRegexSearcher(const Regex& regex,
+                     const IOBuf* buf,
+                     size_t maxMatchLength = kDefaultMaxMatchLength,
+                     OnigOptionType options = ONIG_OPTION_NONE);
+
+  /**
+   * Find the next match, false if there are no more.
+   */
+  bool next();
+
+  /**
+   * The current match; its positions are relative to a window of the
+   * chain, use offset() for positions in the chain.
+   */
+  const MatchRegion& match() const { return match_; }
+
+  /**
+   * Position of group i of the current match in the chain.
+   */
+  size_t offset(size_t i = 0) const {
+    return windowOffset_ + match_.begin(i);
+  }
+
+private:
+  void setWindow();
+
+  Regex regex_;
+  OnigOptionType options_;
+  size_t maxMatchLength_;
+  std::vector<std::pair<size_t, StringPiece>> segments_;  // non-empty bufs
+  size_t segment_{0};       // containing pos_
+  size_t length_{0};        // of the chain
+  size_t pos_{0};           // where to search next
+  StringPiece window_;
+  size_t windowOffset_{0};  // of window_ in the chain
+  std::string scratch_;     // copied windows
+  MatchRegion match_;
+};
+
+/**
+ * A set of patterns matched against the same input.
+ *
+ * When a pattern is added, the longest literal which all its matches
+ * contain is extracted. Matching scans the input once for all these
+ * literals (Aho-Corasick), and only runs the patterns whose literal
+ * occurs, or which have none.
+ *
+ *   RegexSet routes;
+ *   routes.add("^/user/\\d+/profile$");
+ *   routes.add("^/static/");
+ *   ssize_t i = routes.firstMatch(path);
+ *
+ * Not thread-safe while adding patterns; matching is const.
+ */
+class RegexSet {
+public:
+  RegexSet();
+
+  /**
+   * Add a pattern, returning its index. An invalid pattern is logged (as
+   * by Regex) and never matches.
+   */
+  size_t add(StringPiece pattern, OnigOptionType options = ONIG_OPTION_NONE);
+
+  size_t size() const { return regexes_.size(); }
+
+  const Regex& operator[](size_t i) const { return regexes_[i]; }
+
+  /**
+   * Indices of the patterns matching in sp, in increasing order.
+   */
+  std::vector<size_t> matches(StringPiece sp) const;
+
+  /**
+   * Index of the first pattern matching in sp, -1 if none. If match is
+   * given, it is set to the match of that pattern.
+   */
+  ssize_t firstMatch(StringPiece sp, Match* match = nullptr) const;
+
+private:
+  struct Node {
+    std::vector<std::pair<uint8_t, uint32_t>> next;   // sorted by byte
+    uint32_t fail{0};
+    uint32_t output{0};   // next node on the fail chain with patterns
+    std::vector<uint32_t> patterns;
+  };
+
+  void addLiteral(StringPiece literal, uint32_t index);
+  void buildFailureLinks();
+  uint32_t child(uint32_t node, uint8_t c) const;
+
+  // Set candidates[i] for the patterns which may match in sp
+  void findCandidates(StringPiece sp, std::vector<bool>& candidates) const;
+
+  std::vector<Regex> regexes_;
+  std::vector<bool> filtered_;  // has a literal in the automaton
+  std::vector<Node> nodes_;     // the trie of literals, root is 0
+  uint32_t root_[256];          // dense transitions from the root
+};
+
+namespace detail {
+
+/**
+ * The longest literal contained in every match of pattern, or empty if
+ * none was found. Conservative: gives up on alternation, inline options,
+ * case-insensitive or extended patterns and escapes it doesn't know.
+ */
+std::string regexRequiredLiteral(StringPiece pattern, OnigOptionType options);
+
+} // namespace detail
+
 } // namespace folly
 
 #endif
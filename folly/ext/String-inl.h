@@ -29,52 +29,22 @@ namespace folly {
 namespace detail {
 
 /*
- * These output conversion templates allow us to support multiple
- * output string types, even when we are using an arbitrary
- * OutputIterator.
- */
-template<class OutStringT> struct OutputConverter {};
-
-template<> struct OutputConverter<std::string> {
-  std::string operator()(StringPiece sp) const {
-    return sp.toString();
-  }
-};
-
-template<> struct OutputConverter<fbstring> {
-  fbstring operator()(StringPiece sp) const {
-    return sp.toFbstring();
-  }
-};
-
-template<> struct OutputConverter<StringPiece> {
-  StringPiece operator()(StringPiece sp) const { return sp; }
-};
-
-/*
- * For splitLines.
+ * For splitLines, on the delimiter search of split().
  */
 template<class OutStringT, class OutputIterator>
 void internalSplitLines(StringPiece sp, OutputIterator out) {
   assert(sp.empty() || sp.start() != nullptr);
 
-  const char* s = sp.start();
-  const size_t strSize = sp.size();
-
   OutputConverter<OutStringT> conv;
 
   size_t tokenStartPos = 0;
-  size_t tokenSize = 0;
-  for (size_t i = 0; i < strSize; ++i) {
-    ++tokenSize;
-    if (s[i] == '\n') {
-      *out++ = conv(StringPiece(&s[tokenStartPos], tokenSize));
-      tokenStartPos = i + 1;
-      tokenSize = 0;
-    }
-  }
-  tokenSize = strSize - tokenStartPos; // empty line also added
-  *out++ = conv(StringPiece(&s[tokenStartPos], tokenSize));
+  forEachDelim('\n', sp, [&](size_t pos) {
+    *out++ = conv(
+      StringPiece(sp.start() + tokenStartPos, sp.start() + pos + 1));
+    tokenStartPos = pos + 1;
+  });
+  // empty line also added
+  *out++ = conv(StringPiece(sp.start() + tokenStartPos, sp.end()));
 }
 
 #if FOLLY_HAVE_LIBICU
@@ -156,6 +126,7 @@ void internalSplitSoftBreakLines(Utf8StringPiece sp,
 
 template<class String, class OutputType>
 void splitLines(const String& input, std::vector<OutputType>& out) {
+  detail::reserveSplit('\n', input, out);
   detail::internalSplitLines<OutputType>(
     StringPiece(input),
     std::back_inserter(out));
@@ -163,6 +134,7 @@ void splitLines(const String& input, std::vector<OutputType>& out) {
 
 template<class String, class OutputType>
 void splitLines(const String& input, fbvector<OutputType>& out) {
+  detail::reserveSplit('\n', input, out);
   detail::internalSplitLines<OutputType>(
     StringPiece(input),
     std::back_inserter(out));
@@ -25,6 +25,7 @@
 #include <folly/FBVector.h>
 #include <folly/Portability.h>
 #include <folly/Range.h>
+#include <folly/String.h>
 #include <folly/Unicode.h>
 #include <folly/ext/Utf8StringPiece.h>
 
@@ -47,7 +48,8 @@ struct StrCaseLess {
 };
 
 /*
- * Split a string into lines by '\n', '\n' IS included.
+ * Split a string into lines by '\n', '\n' IS included. The search is the
+ * one of folly::split().
  */
 template<class String, class OutputType>
 void splitLines(const String& input, std::vector<OutputType>& out);
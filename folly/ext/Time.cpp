@@ -17,12 +17,15 @@
 #include <folly/ext/Time.h>
 
 #include <cfloat>
+#include <climits>
 #include <cstring>
+#include <memory>
 #include <stdexcept>
 #include <sys/time.h>
 #include <glog/logging.h>
 
 #include <folly/Conv.h>
+#include <folly/ThreadLocal.h>
 
 namespace folly {
 
@@ -126,5 +129,120 @@ void timeAppendf(std::string *out, const char *format, const struct tm *tm) {
   timePrintfImpl(*out, format, tm);
 }
 
+namespace {
+
+const int kLocalTime = INT_MIN;
+
+// Same rules as timeZoneOffset, resolved once per format.
+int parseZoneOffset(const char* format) {
+  size_t n = strlen(format);
+  if (n >= 5) {
+    const char* p = format + n - 5;
+    if ((*p == '+' || *p == '-') && std::all_of(p+1, p+5, isdigit)) {
+      int tz = folly::to<int>(StringPiece(p+1, p+5));
+      return (*p == '+' ? 1 : -1) * (tz / 100 * 60 + tz % 100) * 60;
+    }
+  }
+  if (n >= 3) {
+    const char* p = format + n - 3;
+    if (strcasecmp(p, "GMT") == 0 || strcasecmp(p, "UTC") == 0) {
+      return 0;
+    }
+  }
+  return kLocalTime;
+}
+
+// "%f" is only understood by TimeFormatter, not by timePrintf
+const char* const kIso8601MsTimeFormat = "%FT%T.%f%z";
+
+const char* const kTimeFormats[] = {
+  LOG_TIME_FORMAT,
+  ISO8601_TIME_FORMAT,
+  kIso8601MsTimeFormat,
+  SYSLOG_TIME_FORMAT,
+  RFC1123_TIME_FORMAT,
+};
+
+constexpr size_t kTimeFormatCount =
+  sizeof(kTimeFormats) / sizeof(kTimeFormats[0]);
+
+struct ThreadTimeFormatters {
+  std::unique_ptr<TimeFormatter> formatters[kTimeFormatCount];
+};
+
+} // namespace anon
+
+TimeFormatter::TimeFormatter(const char* format, int digits)
+  : digits_(0)
+  , zoneOffset_(parseZoneOffset(format))
+  , second_(-1)
+  , prefixLen_(0)
+  , len_(0) {
+  const char* p = strstr(format, "%f");
+  if (p) {
+    prefixFormat_.assign(format, p);
+    suffixFormat_.assign(p + 2);
+    digits_ = std::min(std::max(digits, 1), 9);
+  } else {
+    prefixFormat_.assign(format);
+  }
+}
+
+void TimeFormatter::update(time_t sec) {
+  struct tm tm;
+  if (zoneOffset_ == kLocalTime) {
+    localtime_r(&sec, &tm);
+  } else {
+    time_t t = sec + zoneOffset_;
+    gmtime_r(&t, &tm);
+  }
+  // strftime returns 0 both for overflow and for empty output,
+  // both end up as an empty part.
+  prefixLen_ = strftime(buf_, sizeof(buf_) - digits_ - 1,
+                        prefixFormat_.c_str(), &tm);
+  len_ = prefixLen_ + digits_;
+  if (!suffixFormat_.empty()) {
+    len_ += strftime(buf_ + len_, sizeof(buf_) - len_,
+                     suffixFormat_.c_str(), &tm);
+  }
+  buf_[len_] = '\0';
+  second_ = sec;
+}
+
+const char* TimeFormatter::format(time_t sec, long nsec) {
+  if (sec != second_) {
+    update(sec);
+  }
+  if (digits_ > 0) {
+    static const long kDivisors[] = {
+      1000000000, 100000000, 10000000, 1000000, 100000,
+      10000, 1000, 100, 10, 1
+    };
+    unsigned long frac = nsec / kDivisors[digits_];
+    for (char* p = buf_ + prefixLen_ + digits_ - 1; p >= buf_ + prefixLen_;
+         --p) {
+      *p = '0' + frac % 10;
+      frac /= 10;
+    }
+  }
+  return buf_;
+}
+
+const char* TimeFormatter::formatNow() {
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  return format(ts.tv_sec, ts.tv_nsec);
+}
+
+const char* timeNowFormat(TimeFormat format) {
+  static ThreadLocal<ThreadTimeFormatters> formatters;
+  size_t i = static_cast<size_t>(format);
+  auto& formatter = formatters->formatters[i];
+  if (!formatter) {
+    formatter.reset(new TimeFormatter(kTimeFormats[i]));
+  }
+  return formatter->formatNow();
+}
+
 } // namespace folly
 
@@ -121,6 +121,69 @@ inline void timeNowAppendf(std::string *out, const char *format) {
  */
 const char *const EMAIL_TIME_FORMAT = "%a, %d %b %Y %T GMT";
 const char *const APPLE_TIME_FORMAT = "%F %T +0000";
+const char *const RFC1123_TIME_FORMAT = "%a, %d %b %Y %T GMT";
+const char *const ISO8601_TIME_FORMAT = "%FT%T%z";
+const char *const SYSLOG_TIME_FORMAT = "%b %e %T";
+const char *const LOG_TIME_FORMAT = "%y%m%d %T";
+
+/**
+ * TimeFormatter is a strftime with a per-second cache.
+ *
+ * The text of the current second is formatted once and reused until the
+ * second changes, so most calls just return the cached buffer. "%f" in
+ * the format stands for `digits` fractional digits (3 for milliseconds,
+ * 6 for microseconds, 9 for nanoseconds), which are written with integer
+ * arithmetic on every call. Time zones follow
+ * timePrintf: +dddd, UTC and GMT at the end of the format are honored,
+ * otherwise local time is used.
+ *
+ * A TimeFormatter is not thread safe, use one per thread or timeNowFormat.
+ * The returned string is valid until the next call, size() is its length.
+ */
+class TimeFormatter {
+public:
+  explicit TimeFormatter(const char* format, int digits = 3);
+
+  const char* format(time_t sec, long nsec = 0);
+
+  const char* format(const struct timespec& ts) {
+    return format(ts.tv_sec, ts.tv_nsec);
+  }
+
+  const char* formatNow();
+
+  size_t size() const { return len_; }
+
+private:
+  void update(time_t sec);
+
+  std::string prefixFormat_;  // before %f
+  std::string suffixFormat_;  // after %f
+  int digits_;                // 0 if no %f
+  int zoneOffset_;            // seconds east of UTC, or kLocalTime
+  time_t second_;
+  size_t prefixLen_;
+  size_t len_;
+  char buf_[128];
+};
+
+/**
+ * Common formats for timeNowFormat.
+ */
+enum class TimeFormat {
+  LOG,          // LOG_TIME_FORMAT, used by ext/Logging
+  ISO8601,      // ISO8601_TIME_FORMAT
+  ISO8601_MS,   // ISO8601_TIME_FORMAT with milliseconds
+  SYSLOG,       // SYSLOG_TIME_FORMAT
+  RFC1123,      // RFC1123_TIME_FORMAT, e.g. HTTP Date headers
+};
+
+/**
+ * Format the current time with a thread local TimeFormatter.
+ * The returned string is valid until the next call with the same
+ * format on the same thread.
+ */
+const char* timeNowFormat(TimeFormat format);
 
 } // namespace folly
 
@@ -18,8 +18,13 @@
 #include <folly/ext/Unicode.h>
 
 #include <folly/Conv.h>
+#include <folly/detail/SimdDispatch.h>
 #include <folly/ext/Utf8StringPiece.h>
 
+#if FOLLY_SIMD
+#include <immintrin.h>
+#endif
+
 #if FOLLY_HAVE_LIBICU
 
 //#define U_HIDE_DRAFT_API 1
@@ -144,10 +149,493 @@ char32_t utf8ToCodePointUnsafe(const unsigned char* p) {
   return cp;
 }
 
+///////////////////////////////////////////////////////////////////////////
+// Vectorized scanning.
+//
+// Validation works on bit masks with one bit per byte: a lead byte requires
+// trail bytes at the next 1..5 positions (see U8_COUNT_TRAIL_BYTES), and
+// the string is valid iff all required positions hold trail bytes. This is
+// exactly what utf8ForwardCodePointSafe checks, one code point at a time.
+// Requirements of the last bytes of a block are carried to the next one.
+
+namespace {
+
+bool utf8StringIsValidScalar(const char* begin, const char* end) {
+  return utf8StringIsValid<const char*>(begin, end);
+}
+
+size_t utf8CountScalar(const char* begin, const char* end, bool utf16) {
+  size_t count = 0;
+  for (const char* p = begin; p != end; ++p) {
+    uint8_t c = *p;
+    count += !U8_IS_TRAIL(c) + (utf16 && c >= 0xf0);
+  }
+  return count;
+}
+
+bool stringIsAsciiScalar(const char* begin, const char* end) {
+  for (const char* p = begin; p != end; ++p) {
+    if (!U8_IS_SINGLE(*p)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline char asciiCaseMap(char c, bool upper) {
+  if (upper) {
+    return c >= 'a' && c <= 'z' ? c - ('a' - 'A') : c;
+  }
+  return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
+
+// Case map the leading ASCII bytes of in (up to n), returns their number
+size_t asciiCaseMapScalar(const char* in, char* out, size_t n, bool upper) {
+  size_t i = 0;
+  for (; i < n && U8_IS_SINGLE(in[i]); ++i) {
+    out[i] = asciiCaseMap(in[i], upper);
+  }
+  return i;
+}
+
+/**
+ * Check one block of width bytes.
+ * lead[k] marks the bytes followed by more than k trail bytes.
+ */
+inline bool utf8CheckBlock(const uint64_t* lead,
+                           uint64_t trail,
+                           unsigned width,
+                           uint64_t& carry) {
+  uint64_t required = carry;
+  for (unsigned k = 0; k < 5; ++k) {
+    required |= lead[k] << (k + 1);
+  }
+  if (required & ((uint64_t(1) << width) - 1) & ~trail) {
+    return false;
+  }
+  carry = required >> width;
+  return true;
+}
+
+#if FOLLY_SIMD
+
+///////////////////////////////////////////////////////////////////////////
+// SSE4.2, build even if -msse4.2 is not passed to GCC
+
+inline __m128i geSse42(__m128i v, uint8_t c)
+  __attribute__ ((__target__("sse4.2")));
+bool utf8CheckBlockSse42(__m128i v, uint64_t& carry)
+  __attribute__ ((__target__("sse4.2")));
+bool utf8StringIsValidSse42(const char* begin, const char* end)
+  __attribute__ ((__target__("sse4.2"), noinline));
+size_t utf8CountSse42(const char* begin, const char* end, bool utf16)
+  __attribute__ ((__target__("sse4.2"), noinline));
+bool stringIsAsciiSse42(const char* begin, const char* end)
+  __attribute__ ((__target__("sse4.2"), noinline));
+
+// unsigned v >= c, per byte
+inline __m128i geSse42(__m128i v, uint8_t c) {
+  return _mm_cmpeq_epi8(_mm_max_epu8(v, _mm_set1_epi8(c)), v);
+}
+
+bool utf8CheckBlockSse42(__m128i v, uint64_t& carry) {
+  if (_mm_movemask_epi8(v) == 0) {
+    return carry == 0;    // all ASCII
+  }
+  uint64_t invalid = _mm_movemask_epi8(geSse42(v, 0xfe));
+  uint64_t lead[5] = {
+    _mm_movemask_epi8(geSse42(v, 0xc0)) & ~invalid,
+    _mm_movemask_epi8(geSse42(v, 0xe0)) & ~invalid,
+    _mm_movemask_epi8(geSse42(v, 0xf0)) & ~invalid,
+    _mm_movemask_epi8(geSse42(v, 0xf8)) & ~invalid,
+    _mm_movemask_epi8(geSse42(v, 0xfc)) & ~invalid,
+  };
+  uint64_t trail = _mm_movemask_epi8(
+    _mm_cmpeq_epi8(_mm_and_si128(v, _mm_set1_epi8(0xc0)),
+                   _mm_set1_epi8(0x80)));
+  return utf8CheckBlock(lead, trail, 16, carry);
+}
+
+bool utf8StringIsValidSse42(const char* begin, const char* end) {
+  size_t n = end - begin;
+  size_t i = 0;
+  uint64_t carry = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i));
+    if (!utf8CheckBlockSse42(v, carry)) {
+      return false;
+    }
+  }
+  if (i < n) {
+    // zero padding is ASCII, so a truncated sequence fails as it should
+    char tail[16] = {};
+    memcpy(tail, begin + i, n - i);
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tail));
+    if (!utf8CheckBlockSse42(v, carry)) {
+      return false;
+    }
+  }
+  return carry == 0;
+}
+
+size_t utf8CountSse42(const char* begin, const char* end, bool utf16) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i maxTrail = _mm_set1_epi8(0xbf);
+  size_t n = end - begin;
+  size_t i = 0;
+  size_t count = 0;
+  while (n - i >= 16) {
+    // per byte counters, at most 2 per block: flush before they overflow
+    size_t blocks = std::min<size_t>((n - i) / 16, 127);
+    __m128i acc = zero;
+    for (size_t b = 0; b < blocks; ++b, i += 16) {
+      __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i));
+      // signed compare: trail bytes are the smallest non-ASCII values
+      acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(v, maxTrail));
+      if (utf16) {
+        acc = _mm_sub_epi8(acc, geSse42(v, 0xf0));
+      }
+    }
+    __m128i sums = _mm_sad_epu8(acc, zero);
+    count += _mm_cvtsi128_si64(sums) + _mm_extract_epi64(sums, 1);
+  }
+  return count + utf8CountScalar(begin + i, end, utf16);
+}
+
+bool stringIsAsciiSse42(const char* begin, const char* end) {
+  size_t n = end - begin;
+  size_t i = 0;
+  for (; i + 64 <= n; i += 64) {
+    auto p = reinterpret_cast<const __m128i*>(begin + i);
+    __m128i v = _mm_or_si128(
+      _mm_or_si128(_mm_loadu_si128(p), _mm_loadu_si128(p + 1)),
+      _mm_or_si128(_mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3)));
+    if (_mm_movemask_epi8(v) != 0) {
+      return false;
+    }
+  }
+  return stringIsAsciiScalar(begin + i, end);
+}
+
+size_t asciiCaseMapSse42(const char* in, char* out, size_t n, bool upper)
+  __attribute__ ((__target__("sse4.2"), noinline));
+
+size_t asciiCaseMapSse42(const char* in, char* out, size_t n, bool upper) {
+  // shift the letters to convert to the lowest signed values
+  const __m128i shift = _mm_set1_epi8(0x80 - (upper ? 'a' : 'A'));
+  const __m128i limit = _mm_set1_epi8(char(0x80 + 26));
+  const __m128i flip = _mm_set1_epi8(0x20);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    int nonAscii = _mm_movemask_epi8(v);
+    if (nonAscii != 0) {
+      return i + asciiCaseMapScalar(in + i, out + i,
+                                    __builtin_ctz(nonAscii), upper);
+    }
+    __m128i letters = _mm_cmplt_epi8(_mm_add_epi8(v, shift), limit);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm_xor_si128(v, _mm_and_si128(letters, flip)));
+  }
+  return i + asciiCaseMapScalar(in + i, out + i, n - i, upper);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// AVX2
+
+inline __m256i geAvx2(__m256i v, uint8_t c)
+  __attribute__ ((__target__("avx2")));
+bool utf8CheckBlockAvx2(__m256i v, uint64_t& carry)
+  __attribute__ ((__target__("avx2")));
+bool utf8StringIsValidAvx2(const char* begin, const char* end)
+  __attribute__ ((__target__("avx2"), noinline));
+size_t utf8CountAvx2(const char* begin, const char* end, bool utf16)
+  __attribute__ ((__target__("avx2"), noinline));
+bool stringIsAsciiAvx2(const char* begin, const char* end)
+  __attribute__ ((__target__("avx2"), noinline));
+
+inline __m256i geAvx2(__m256i v, uint8_t c) {
+  return _mm256_cmpeq_epi8(_mm256_max_epu8(v, _mm256_set1_epi8(c)), v);
+}
+
+inline uint64_t movemaskAvx2(__m256i v)
+  __attribute__ ((__target__("avx2")));
+
+inline uint64_t movemaskAvx2(__m256i v) {
+  return uint32_t(_mm256_movemask_epi8(v));
+}
+
+bool utf8CheckBlockAvx2(__m256i v, uint64_t& carry) {
+  if (_mm256_movemask_epi8(v) == 0) {
+    return carry == 0;    // all ASCII
+  }
+  uint64_t invalid = movemaskAvx2(geAvx2(v, 0xfe));
+  uint64_t lead[5] = {
+    movemaskAvx2(geAvx2(v, 0xc0)) & ~invalid,
+    movemaskAvx2(geAvx2(v, 0xe0)) & ~invalid,
+    movemaskAvx2(geAvx2(v, 0xf0)) & ~invalid,
+    movemaskAvx2(geAvx2(v, 0xf8)) & ~invalid,
+    movemaskAvx2(geAvx2(v, 0xfc)) & ~invalid,
+  };
+  uint64_t trail = movemaskAvx2(
+    _mm256_cmpeq_epi8(_mm256_and_si256(v, _mm256_set1_epi8(0xc0)),
+                      _mm256_set1_epi8(0x80)));
+  return utf8CheckBlock(lead, trail, 32, carry);
+}
+
+bool utf8StringIsValidAvx2(const char* begin, const char* end) {
+  size_t n = end - begin;
+  size_t i = 0;
+  uint64_t carry = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i v =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin + i));
+    if (!utf8CheckBlockAvx2(v, carry)) {
+      return false;
+    }
+  }
+  if (i < n) {
+    char tail[32] = {};
+    memcpy(tail, begin + i, n - i);
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tail));
+    if (!utf8CheckBlockAvx2(v, carry)) {
+      return false;
+    }
+  }
+  return carry == 0;
+}
+
+size_t utf8CountAvx2(const char* begin, const char* end, bool utf16) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i maxTrail = _mm256_set1_epi8(0xbf);
+  size_t n = end - begin;
+  size_t i = 0;
+  size_t count = 0;
+  while (n - i >= 32) {
+    size_t blocks = std::min<size_t>((n - i) / 32, 127);
+    __m256i acc = zero;
+    for (size_t b = 0; b < blocks; ++b, i += 32) {
+      __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin + i));
+      acc = _mm256_sub_epi8(acc, _mm256_cmpgt_epi8(v, maxTrail));
+      if (utf16) {
+        acc = _mm256_sub_epi8(acc, geAvx2(v, 0xf0));
+      }
+    }
+    __m256i sums = _mm256_sad_epu8(acc, zero);
+    __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(sums),
+                                _mm256_extracti128_si256(sums, 1));
+    count += _mm_cvtsi128_si64(sum) + _mm_extract_epi64(sum, 1);
+  }
+  return count + utf8CountScalar(begin + i, end, utf16);
+}
+
+bool stringIsAsciiAvx2(const char* begin, const char* end) {
+  size_t n = end - begin;
+  size_t i = 0;
+  for (; i + 128 <= n; i += 128) {
+    auto p = reinterpret_cast<const __m256i*>(begin + i);
+    __m256i v = _mm256_or_si256(
+      _mm256_or_si256(_mm256_loadu_si256(p), _mm256_loadu_si256(p + 1)),
+      _mm256_or_si256(_mm256_loadu_si256(p + 2), _mm256_loadu_si256(p + 3)));
+    if (_mm256_movemask_epi8(v) != 0) {
+      return false;
+    }
+  }
+  return stringIsAsciiScalar(begin + i, end);
+}
+
+size_t asciiCaseMapAvx2(const char* in, char* out, size_t n, bool upper)
+  __attribute__ ((__target__("avx2"), noinline));
+
+size_t asciiCaseMapAvx2(const char* in, char* out, size_t n, bool upper) {
+  const __m256i shift = _mm256_set1_epi8(0x80 - (upper ? 'a' : 'A'));
+  const __m256i limit = _mm256_set1_epi8(char(0x80 + 26));
+  const __m256i flip = _mm256_set1_epi8(0x20);
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i v =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+    int nonAscii = _mm256_movemask_epi8(v);
+    if (nonAscii != 0) {
+      return i + asciiCaseMapScalar(in + i, out + i,
+                                    __builtin_ctz(nonAscii), upper);
+    }
+    __m256i letters =
+      _mm256_cmpgt_epi8(limit, _mm256_add_epi8(v, shift));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_xor_si256(v, _mm256_and_si256(letters, flip)));
+  }
+  return i + asciiCaseMapScalar(in + i, out + i, n - i, upper);
+}
+
+#endif // FOLLY_SIMD
+
+} // namespace anon
+
+bool utf8StringIsValid(const char* begin, const char* end) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE42, utf8StringIsValid, Sse42);
+  return fn(begin, end);
+}
+
+size_t utf8CodePointCount(const char* begin, const char* end) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE42, utf8Count, Sse42);
+  return fn(begin, end, false);
+}
+
+bool stringIsAscii(const char* begin, const char* end) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE42, stringIsAscii, Sse42);
+  return fn(begin, end);
+}
+
+namespace detail {
+
+size_t utf8Utf16Length(const char* begin, const char* end) {
+  static auto const fn = FOLLY_SIMD_KERNEL(SSE42, utf8Count, Sse42);
+  return fn(begin, end, true);
+}
+
+Utf8Kernels utf8Kernels(SimdLevel level) {
+  switch (level) {
+#if FOLLY_SIMD
+    case SimdLevel::SSE42:
+      return {utf8StringIsValidSse42, utf8CountSse42, stringIsAsciiSse42,
+              asciiCaseMapSse42};
+    case SimdLevel::AVX2:
+      return {utf8StringIsValidAvx2, utf8CountAvx2, stringIsAsciiAvx2,
+              asciiCaseMapAvx2};
+#endif
+    default:
+      return {utf8StringIsValidScalar, utf8CountScalar, stringIsAsciiScalar,
+              asciiCaseMapScalar};
+  }
+}
+
+namespace {
+
+// Decode the code point at p, returns its length or 0 if malformed
+size_t decodeUtf8(const unsigned char* p,
+                  const unsigned char* e,
+                  char32_t& cp) {
+  size_t len = 1 + U8_COUNT_TRAIL_BYTES_UNSAFE(*p);
+  if (*p < 0xc2 || *p > 0xf4 || size_t(e - p) < len) {
+    return 0;
+  }
+  cp = *p & (0x7f >> len);
+  for (size_t i = 1; i < len; ++i) {
+    if (!U8_IS_TRAIL(p[i])) {
+      return 0;
+    }
+    cp = (cp << 6) | (p[i] & 0x3f);
+  }
+  if (U8_LENGTH(cp) != len) {
+    return 0;   // overlong, surrogate or out of range
+  }
+  return len;
+}
+
+size_t encodeUtf8(char32_t cp, char* out) {
+  if (cp < 0x80) {
+    out[0] = cp;
+    return 1;
+  }
+  if (cp < 0x800) {
+    out[0] = 0xc0 | (cp >> 6);
+    out[1] = 0x80 | (cp & 0x3f);
+    return 2;
+  }
+  if (cp < 0x10000) {
+    out[0] = 0xe0 | (cp >> 12);
+    out[1] = 0x80 | ((cp >> 6) & 0x3f);
+    out[2] = 0x80 | (cp & 0x3f);
+    return 3;
+  }
+  out[0] = 0xf0 | (cp >> 18);
+  out[1] = 0x80 | ((cp >> 12) & 0x3f);
+  out[2] = 0x80 | ((cp >> 6) & 0x3f);
+  out[3] = 0x80 | (cp & 0x3f);
+  return 4;
+}
+
+} // namespace anon
+
+char* utf8CaseMap(const char*& in,
+                  const char* inEnd,
+                  char* out,
+                  char* outEnd,
+                  bool upper,
+                  bool sameLength) {
+  static auto const asciiFn = FOLLY_SIMD_KERNEL(SSE42, asciiCaseMap, Sse42);
+  while (in != inEnd && out != outEnd) {
+    size_t n = asciiFn(in, out, std::min(inEnd - in, outEnd - out), upper);
+    in += n;
+    out += n;
+    if (in == inEnd || out == outEnd) {
+      break;
+    }
+    auto p = reinterpret_cast<const unsigned char*>(in);
+    char32_t cp;
+    size_t len = decodeUtf8(p, reinterpret_cast<const unsigned char*>(inEnd),
+                            cp);
+    if (len == 0) {
+      *out++ = *in++;
+      continue;
+    }
+    auto& props = getUnicodeProperties(cp);
+    char32_t mapped = cp + (upper ? props.upperDelta : props.lowerDelta);
+    size_t outLen = U8_LENGTH(mapped);
+    if ((sameLength && outLen != len) || size_t(outEnd - out) < outLen) {
+      break;
+    }
+    encodeUtf8(mapped, out);
+    in += len;
+    out += outLen;
+  }
+  return out;
+}
+
+} // namespace detail
+
+namespace unicode {
+namespace u16 {
+
+const char* advance(const char* first, size_t n, const char* last) {
+  constexpr size_t kBlockSize = 256;
+  const char* end = utf8StringEnd(first, last);
+  DCHECK(end == last);
+  const char* p = first;
+  // A block has at most kBlockSize units, skip whole blocks while more
+  // than that remain, then step back to the code point boundary.
+  while (n > kBlockSize && size_t(end - p) >= kBlockSize) {
+    n -= detail::utf8Utf16Length(p, p + kBlockSize);
+    p += kBlockSize;
+  }
+  if (p != first && p != end && U8_IS_TRAIL(*p)) {
+    p = utf8BackCodePoint(p);
+    n += uint8_t(*p) >= 0xf0 ? 2 : 1;
+  }
+  for (; n && p != end; p = utf8ForwardCodePoint(p)) {
+    n -= uint8_t(*p) >= 0xf0 ? 2 : 1;
+  }
+  return p;
+}
+
+} // namespace u16
+} // namespace unicode
+
 #if FOLLY_HAVE_LIBICU
 
 namespace unicode {
 
+namespace {
+
+inline bool hasFlag(char32_t cp, uint32_t flag) {
+  return detail::hasUnicodeFlag(cp, flag);
+}
+
+} // namespace anon
+
 // Reference:
 //  https://en.wikipedia.org/wiki/Unicode_character_property
 //  http://www.unicode.org/Public/5.1.0/ucd/UCD.html
@@ -195,9 +683,9 @@ namespace unicode {
 bool isAlpha(char32_t cp) {
   if (cp < 0x80) return isalpha(cp);
 #if FOLLY_UNICODE_JAVA_API
-  return u_isalpha(cp);
+  return hasFlag(cp, detail::kUnicodeJavaAlpha);
 #else
-  return u_isUAlphabetic(cp);
+  return hasFlag(cp, detail::kUnicodeAlpha);
 #endif
 }
 
@@ -212,9 +700,9 @@ bool isAlpha(char32_t cp) {
 bool isLower(char32_t cp) {
   if (cp < 0x80) return islower(cp);
 #if FOLLY_UNICODE_JAVA_API
-  return u_islower(cp);
+  return hasFlag(cp, detail::kUnicodeJavaLower);
 #else
-  return u_isULowercase(cp);
+  return hasFlag(cp, detail::kUnicodeLower);
 #endif
 }
 
@@ -229,9 +717,9 @@ bool isLower(char32_t cp) {
 bool isUpper(char32_t cp) {
   if (cp < 0x80) return isupper(cp);
 #if FOLLY_UNICODE_JAVA_API
-  return u_isupper(cp);
+  return hasFlag(cp, detail::kUnicodeJavaUpper);
 #else
-  return u_isUUppercase(cp);
+  return hasFlag(cp, detail::kUnicodeUpper);
 #endif
 }
 
@@ -240,7 +728,7 @@ bool isUpper(char32_t cp) {
  * True for general category "Lt" (titlecase letter).
  */
 bool isTitle(char32_t cp) {
-  return u_istitle(cp);
+  return hasFlag(cp, detail::kUnicodeTitle);
 }
 
 /**
@@ -249,7 +737,7 @@ bool isTitle(char32_t cp) {
  */
 bool isPunct(char32_t cp) {
   if (cp < 0x80) return ispunct(cp);
-  return u_ispunct(cp);
+  return hasFlag(cp, detail::kUnicodePunct);
 }
 
 /**
@@ -261,7 +749,7 @@ bool isPunct(char32_t cp) {
  */
 bool isDigit(char32_t cp) {
   if (cp < 0x80) return isdigit(cp);
-  return u_isdigit(cp);
+  return hasFlag(cp, detail::kUnicodeDigit);
 }
 
 /**
@@ -277,7 +765,7 @@ bool isDigit(char32_t cp) {
  */
 bool isXDigit(char32_t cp) {
   if (cp < 0x80) return isxdigit(cp);
-  return u_isxdigit(cp);
+  return hasFlag(cp, detail::kUnicodeXDigit);
 }
 
 /**
@@ -292,9 +780,9 @@ bool isXDigit(char32_t cp) {
 bool isAlnum(char32_t cp) {
   if (cp < 0x80) return isalnum(cp);
 #if FOLLY_UNICODE_JAVA_API
-  return u_isalnum(cp);
+  return hasFlag(cp, detail::kUnicodeJavaAlnum);
 #else
-  return u_hasBinaryProperty(cp, UCHAR_POSIX_ALNUM);
+  return hasFlag(cp, detail::kUnicodeAlnum);
 #endif
 }
 
@@ -308,7 +796,7 @@ bool isAlnum(char32_t cp) {
  *  = isWhitespace (C/POSIX) + 001c-001f
  */
 bool isSpace(char32_t cp) {
-  return u_isspace(cp);
+  return hasFlag(cp, detail::kUnicodeSpace);
 }
 
 /**
@@ -323,7 +811,7 @@ bool isSpace(char32_t cp) {
  *  = isWhitespace (C/POSIX) - 0009-000d - 0085
  */
 bool isJavaSpace(char32_t cp) {
-  return u_isJavaSpaceChar(cp);
+  return hasFlag(cp, detail::kUnicodeJavaSpace);
 }
 
 /**
@@ -365,9 +853,9 @@ bool isJavaSpace(char32_t cp) {
  */
 bool isWhitespace(char32_t cp) {
 #if FOLLY_UNICODE_JAVA_API
-  return u_isWhitespace(cp);
+  return hasFlag(cp, detail::kUnicodeJavaWhitespace);
 #else
-  return u_isUWhiteSpace(cp);
+  return hasFlag(cp, detail::kUnicodeWhitespace);
 #endif
 }
 
@@ -396,7 +884,7 @@ bool isWhitespace(char32_t cp) {
  */
 bool isBlank(char32_t cp) {
   if (cp < 0x80) return isblank(cp);
-  return u_isblank(cp);
+  return hasFlag(cp, detail::kUnicodeBlank);
 }
 
 /**
@@ -414,9 +902,9 @@ bool isBlank(char32_t cp) {
 bool isCntrl(char32_t cp) {
   if (cp < 0x80) return iscntrl(cp);
 #if FOLLY_UNICODE_JAVA_API
-  return u_iscntrl(cp);
+  return hasFlag(cp, detail::kUnicodeJavaCntrl);
 #else
-  return u_charType(cp)==U_CONTROL_CHAR;
+  return hasFlag(cp, detail::kUnicodeCntrl);
 #endif
 }
 
@@ -426,7 +914,7 @@ bool isCntrl(char32_t cp) {
  */
 bool isISOControl(char32_t cp) {
   if (cp < 0x80) return iscntrl(cp);
-  return u_isISOControl(cp);
+  return hasFlag(cp, detail::kUnicodeISOControl);
 }
 
 /**
@@ -441,9 +929,9 @@ bool isISOControl(char32_t cp) {
 bool isGraph(char32_t cp) {
   if (cp < 0x80) return isgraph(cp);
 #if FOLLY_UNICODE_JAVA_API
-  return u_isgraph(cp);
+  return hasFlag(cp, detail::kUnicodeJavaGraph);
 #else
-  return u_hasBinaryProperty(cp, UCHAR_POSIX_GRAPH);
+  return hasFlag(cp, detail::kUnicodeGraph);
 #endif
 }
 
@@ -456,9 +944,9 @@ bool isGraph(char32_t cp) {
 bool isPrint(char32_t cp) {
   if (cp < 0x80) return isprint(cp);
 #if FOLLY_UNICODE_JAVA_API
-  return u_isprint(cp);
+  return hasFlag(cp, detail::kUnicodeJavaPrint);
 #else
-  return u_hasBinaryProperty(cp, UCHAR_POSIX_PRINT);
+  return hasFlag(cp, detail::kUnicodePrint);
 #endif
 }
 
@@ -472,7 +960,7 @@ bool isPrint(char32_t cp) {
  * (they are Cn), but surrogate code points are "defined" (Cs).
  */
 bool isDefined(char32_t cp) {
-  return u_isdefined(cp);
+  return hasFlag(cp, detail::kUnicodeDefined);
 }
 
 /**
@@ -487,7 +975,7 @@ bool isDefined(char32_t cp) {
  * and that are neither control (Cc) or format (Cf) characters.
  */
 bool isBase(char32_t cp) {
-  return u_isbase(cp);
+  return hasFlag(cp, detail::kUnicodeBase);
 }
 
 /**
@@ -495,7 +983,7 @@ bool isBase(char32_t cp) {
  * Value defined in enum UCharCategory.
  */
 int8_t getUCharType(char32_t cp) {
-  return u_charType(cp);
+  return detail::getUnicodeProperties(cp).category;
 }
 
 /**
@@ -504,16 +992,16 @@ int8_t getUCharType(char32_t cp) {
  * Same as U_MASK(u_charType(c)).
  */
 uint32_t getUCharCategoryMask(char32_t cp) {
-  return U_GET_GC_MASK(cp);
+  return U_MASK(detail::getUnicodeProperties(cp).category);
 }
 
 bool isMemberOfUCharCategory(char32_t cp, uint32_t mask) {
-  return U_GET_GC_MASK(cp) & mask;
+  return getUCharCategoryMask(cp) & mask;
 }
 
 // = kCFCharacterSetNonBase (ignore unassigned code point).
 bool isNonBase(char32_t cp) {
-  return U_GET_GC_MASK(cp) & U_GC_M_MASK;
+  return getUCharCategoryMask(cp) & U_GC_M_MASK;
 }
 
 // East_Asian_Width Property:
@@ -526,9 +1014,7 @@ bool isNonBase(char32_t cp) {
 //  Python/Modules/unicodedata.c
 //
 bool isWide(char32_t cp) {
-  UEastAsianWidth ea =
-  (UEastAsianWidth)u_getIntPropertyValue(cp, UCHAR_EAST_ASIAN_WIDTH);
-  return ea == U_EA_FULLWIDTH || ea == U_EA_WIDE;
+  return hasFlag(cp, detail::kUnicodeWide);
 }
 
 /**
@@ -547,7 +1033,7 @@ bool isWide(char32_t cp) {
  * http://icu-project.org/userguide/posix.html#case_mappings
  */
 char32_t toLower(char32_t cp) {
-  return u_tolower(cp);
+  return cp + detail::getUnicodeProperties(cp).lowerDelta;
 }
 
 /**
@@ -567,11 +1053,17 @@ char32_t toLower(char32_t cp) {
  * http://icu-project.org/userguide/posix.html#case_mappings
  */
 char32_t toUpper(char32_t cp) {
-  return u_toupper(cp);
+  return cp + detail::getUnicodeProperties(cp).upperDelta;
 }
 
 std::string toLower(const folly::StringPiece& sp) {
   std::string result;
+  if (stringIsAscii(sp)) {
+    // full and simple mappings are the same for ASCII
+    result.reserve(sp.size());
+    toLower(sp, std::back_inserter(result));
+    return result;
+  }
   icu::StringPiece usp(sp.begin(), (int32_t)sp.size());
   icu::UnicodeString::fromUTF8(usp).toLower().toUTF8String(result);
   return result;
@@ -579,6 +1071,11 @@ std::string toLower(const folly::StringPiece& sp) {
 
 std::string toUpper(const folly::StringPiece& sp) {
   std::string result;
+  if (stringIsAscii(sp)) {
+    result.reserve(sp.size());
+    toUpper(sp, std::back_inserter(result));
+    return result;
+  }
   icu::StringPiece usp(sp.begin(), (int32_t)sp.size());
   icu::UnicodeString::fromUTF8(usp).toUpper().toUTF8String(result);
   return result;
@@ -21,12 +21,15 @@
 #define FOLLY_EXT_UNICODE_H_
 
 #include <algorithm>
+#include <iterator>
 #include <string>
 #include <boost/operators.hpp>
 #include <glog/logging.h>
 
 #include <folly/FBString.h>
+#include <folly/Likely.h>
 #include <folly/Range.h>
+#include <folly/detail/SimdDispatch.h>
 
 /**
  * Counts the trail bytes for a UTF-8 lead byte.
@@ -197,6 +200,63 @@ Iter utf8BackCodePointSafe(Iter p, Iter begin) {
   return p;
 }
 
+/**
+ * Vectorized versions for contiguous strings.
+ *
+ * SSE4.2 or AVX2 kernels are chosen at runtime (see CpuId), falling back to
+ * scalar code on other CPUs. Results are the same as the generic versions.
+ */
+
+/**
+ * Check if valid of UTF-8 string, with the same rules as the generic
+ * utf8StringIsValid below.
+ */
+bool utf8StringIsValid(const char* begin, const char* end);
+
+/**
+ * Count code points of UTF-8 string.
+ * "Unsafe", assumes well-formed UTF-8.
+ */
+size_t utf8CodePointCount(const char* begin, const char* end);
+
+template <class String>
+size_t utf8CodePointCount(const String& str) {
+  StringPiece sp(str);
+  return utf8CodePointCount(sp.begin(), sp.end());
+}
+
+/**
+ * Check if all bytes are US-ASCII (0..0x7f).
+ */
+bool stringIsAscii(const char* begin, const char* end);
+
+template <class String>
+bool stringIsAscii(const String& str) {
+  StringPiece sp(str);
+  return stringIsAscii(sp.begin(), sp.end());
+}
+
+namespace detail {
+
+// Number of UTF-16 code units of well-formed UTF-8 [begin, end)
+size_t utf8Utf16Length(const char* begin, const char* end);
+
+/**
+ * The kernels behind the vectorized functions, for a given SIMD level
+ * (SSE42 or AVX2, any other level gives the scalar kernels), so that tests
+ * can check them against each other. Check simdLevelSupported first.
+ */
+struct Utf8Kernels {
+  bool (*isValid)(const char* begin, const char* end);
+  size_t (*count)(const char* begin, const char* end, bool utf16);
+  bool (*isAscii)(const char* begin, const char* end);
+  size_t (*asciiCaseMap)(const char* in, char* out, size_t n, bool upper);
+};
+
+Utf8Kernels utf8Kernels(SimdLevel level);
+
+} // namespace detail
+
 /**
  * Iterator end of UTF-8 string.
  */
@@ -208,7 +268,7 @@ Iter utf8StringEnd(Iter begin, Iter end) {
     return e;
   }
   Iter p = utf8BackCodePointSafe(e, b);
-  if (!p || e - p == utf8CodePointLength(p)) {
+  if (!p || size_t(e - p) == utf8CodePointLength(p)) {
     return e;
   }
   return p;
@@ -308,6 +368,119 @@ inline char32_t utf8ToCodePoint(const StringPiece& sp) {
   return utf8ToCodePoint(b, e);
 }
 
+namespace detail {
+
+/**
+ * Per code point properties, generated from ICU by
+ * build/GenerateUnicodeTables.cpp into build/UnicodeTables.cpp.
+ *
+ * The record of a code point is looked up through two levels of indexes,
+ * for blocks of 2^kUnicodeShift code points; identical blocks are shared.
+ */
+enum UnicodeFlag : uint32_t {
+  kUnicodeAlpha           = 1 << 0,
+  kUnicodeJavaAlpha       = 1 << 1,
+  kUnicodeLower           = 1 << 2,
+  kUnicodeJavaLower       = 1 << 3,
+  kUnicodeUpper           = 1 << 4,
+  kUnicodeJavaUpper       = 1 << 5,
+  kUnicodeTitle           = 1 << 6,
+  kUnicodePunct           = 1 << 7,
+  kUnicodeDigit           = 1 << 8,
+  kUnicodeXDigit          = 1 << 9,
+  kUnicodeAlnum           = 1 << 10,
+  kUnicodeJavaAlnum       = 1 << 11,
+  kUnicodeSpace           = 1 << 12,
+  kUnicodeJavaSpace       = 1 << 13,
+  kUnicodeWhitespace      = 1 << 14,
+  kUnicodeJavaWhitespace  = 1 << 15,
+  kUnicodeBlank           = 1 << 16,
+  kUnicodeCntrl           = 1 << 17,
+  kUnicodeJavaCntrl       = 1 << 18,
+  kUnicodeISOControl      = 1 << 19,
+  kUnicodeGraph           = 1 << 20,
+  kUnicodeJavaGraph       = 1 << 21,
+  kUnicodePrint           = 1 << 22,
+  kUnicodeJavaPrint       = 1 << 23,
+  kUnicodeDefined         = 1 << 24,
+  kUnicodeBase            = 1 << 25,
+  kUnicodeWide            = 1 << 26,
+};
+
+struct UnicodeProperties {
+  uint32_t flags;
+  int32_t lowerDelta;   // simple case mappings, as offsets
+  int32_t upperDelta;
+  uint8_t category;     // UCharCategory
+};
+
+constexpr int kUnicodeShift = 7;
+
+extern const uint16_t unicodeIndex1[];
+extern const uint16_t unicodeIndex2[];
+extern const UnicodeProperties unicodeProperties[];
+
+inline const UnicodeProperties& getUnicodeProperties(char32_t cp) {
+  if (UNLIKELY(cp > 0x10ffff)) {
+    return unicodeProperties[0];
+  }
+  uint32_t block = unicodeIndex1[cp >> kUnicodeShift];
+  return unicodeProperties[unicodeIndex2[
+    (block << kUnicodeShift) | (cp & ((1 << kUnicodeShift) - 1))]];
+}
+
+inline bool hasUnicodeFlag(char32_t cp, uint32_t flag) {
+  return getUnicodeProperties(cp).flags & flag;
+}
+
+/**
+ * Map UTF-8 from [in, inEnd) to out with the simple case mapping, until
+ * either the input is consumed or out is full. With sameLength it also
+ * stops before a code point whose mapping has a different UTF-8 length,
+ * so that in and out may be the same buffer. Malformed bytes are copied.
+ * Advances in and returns the new end of out.
+ */
+char* utf8CaseMap(const char*& in,
+                  const char* inEnd,
+                  char* out,
+                  char* outEnd,
+                  bool upper,
+                  bool sameLength);
+
+template <class OutputIterator>
+OutputIterator utf8CaseMap(const StringPiece& sp,
+                           OutputIterator out,
+                           bool upper) {
+  char buf[256];
+  const char* in = sp.begin();
+  while (in != sp.end()) {
+    char* end = utf8CaseMap(in, sp.end(), buf, buf + sizeof(buf),
+                            upper, false);
+    out = std::copy(buf, end, out);
+  }
+  return out;
+}
+
+template <class String>
+void utf8CaseMapInPlace(String& str, bool upper) {
+  if (str.empty()) {
+    return;
+  }
+  char* out = &str[0];   // unshares a copy-on-write string first
+  const char* in = out;
+  const char* end = in + str.size();
+  utf8CaseMap(in, end, out, out + str.size(), upper, true);
+  if (in != end) {
+    // rare: a mapping changes the length, map the rest out of place
+    size_t pos = in - out;
+    String rest;
+    utf8CaseMap(StringPiece(in, end), std::back_inserter(rest), upper);
+    str.replace(pos, str.size() - pos, rest);
+  }
+}
+
+} // namespace detail
+
 #if FOLLY_HAVE_LIBICU
 
 namespace unicode {
@@ -395,6 +568,36 @@ std::string toUpper(const String& str) {
   return toUpper(StringPiece(str));
 }
 
+/**
+ * Convert to lowercase / uppercase, writing UTF-8 to out.
+ * Uses the simple (single code point) case mapping; ASCII runs are
+ * converted a block at a time and nothing is allocated.
+ */
+template <class OutputIterator>
+OutputIterator toLower(const StringPiece& sp, OutputIterator out) {
+  return detail::utf8CaseMap(sp, out, false);
+}
+
+template <class OutputIterator>
+OutputIterator toUpper(const StringPiece& sp, OutputIterator out) {
+  return detail::utf8CaseMap(sp, out, true);
+}
+
+/**
+ * Convert to lowercase / uppercase in place, with the simple case mapping.
+ * Only allocates in the rare case a mapping changes the UTF-8 length
+ * (e.g. U+023A).
+ */
+template <class String>
+void toLowerInPlace(String& str) {
+  detail::utf8CaseMapInPlace(str, false);
+}
+
+template <class String>
+void toUpperInPlace(String& str) {
+  detail::utf8CaseMapInPlace(str, true);
+}
+
 /**
  * Convert to opposite-case string.
  * Can handle non single-code point case.
@@ -579,6 +782,8 @@ Iter advance(const Iter& first, size_t n, const Iter& last) {
   return &it;
 }
 
+const char* advance(const char* first, size_t n, const char* last);
+
 template <class Iter>
 size_t distance(const Iter& first, const Iter& last) {
   size_t d = 0;
@@ -592,6 +797,12 @@ size_t distance(const Iter& first, const Iter& last) {
   return d;
 }
 
+inline size_t distance(const char* first, const char* last) {
+  const char* end = utf8StringEnd(first, last);
+  DCHECK(end == last);
+  return detail::utf8Utf16Length(first, end);
+}
+
 } // namespace u16
 } // namespace unicode
 
@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/ext/UnicodeNormalizer.h>
+
+#if FOLLY_HAVE_LIBICU
+
+#include <stdexcept>
+
+#include <folly/Conv.h>
+
+#include <unicode/bytestream.h>
+#include <unicode/normalizer2.h>
+#include <unicode/unistr.h>
+#include <unicode/utf8.h>
+
+namespace folly {
+namespace unicode {
+
+namespace {
+
+class IOBufQueueSink : public icu::ByteSink {
+public:
+  explicit IOBufQueueSink(IOBufQueue& queue) : queue_(queue) {}
+
+  void Append(const char* bytes, int32_t n) override {
+    queue_.append(bytes, n);
+  }
+
+private:
+  IOBufQueue& queue_;
+};
+
+const icu::Normalizer2* getNormalizer(NormalizationMode mode) {
+  UErrorCode err = U_ZERO_ERROR;
+  const icu::Normalizer2* normalizer = nullptr;
+  switch (mode) {
+    case NORM_NONE:
+      return nullptr;
+    case NORM_NFD:
+      normalizer = icu::Normalizer2::getNFDInstance(err);
+      break;
+    case NORM_NFKD:
+      normalizer = icu::Normalizer2::getNFKDInstance(err);
+      break;
+    case NORM_NFC:
+      normalizer = icu::Normalizer2::getNFCInstance(err);
+      break;
+    case NORM_NFKC:
+      normalizer = icu::Normalizer2::getNFKCInstance(err);
+      break;
+    case NORM_FCD:
+      normalizer = icu::Normalizer2::getInstance(
+          nullptr, "nfc", UNORM2_FCD, err);
+      break;
+    default:
+      throw std::invalid_argument(
+        to<std::string>("unknown normalization mode ", int(mode)));
+  }
+  if (U_FAILURE(err)) {
+    throw std::runtime_error(
+      to<std::string>("create normalizer error: ", u_errorName(err)));
+  }
+  return normalizer;
+}
+
+} // namespace anon
+
+Normalizer::Normalizer(NormalizationMode mode)
+  : normalizer_(getNormalizer(mode)) {
+}
+
+void Normalizer::process(std::unique_ptr<IOBuf> buf, IOBufQueue& out) {
+  if (!buf) {
+    return;
+  }
+  // The clones written to out share the buffers, so buf may go away
+  const IOBuf* p = buf.get();
+  do {
+    auto data = reinterpret_cast<const char*>(p->data());
+    processRange(data, data + p->length(), p, out);
+    p = p->next();
+  } while (p != buf.get());
+}
+
+void Normalizer::process(io::Cursor& cursor, IOBufQueue& out) {
+  std::unique_ptr<IOBuf> buf;
+  cursor.clone(buf, cursor.totalLength());
+  process(std::move(buf), out);
+}
+
+void Normalizer::process(StringPiece chunk, IOBufQueue& out) {
+  processRange(chunk.begin(), chunk.end(), nullptr, out);
+}
+
+void Normalizer::finish(IOBufQueue& out) {
+  emit(pending_.data(), pending_.data() + pending_.size(), nullptr, out);
+  pending_.clear();
+}
+
+std::unique_ptr<IOBuf> Normalizer::normalize(std::unique_ptr<IOBuf> buf,
+                                             NormalizationMode mode) {
+  Normalizer normalizer(mode);
+  IOBufQueue out;
+  normalizer.process(std::move(buf), out);
+  normalizer.finish(out);
+  auto result = out.move();
+  return result ? std::move(result) : IOBuf::create(0);
+}
+
+void Normalizer::processRange(const char* begin,
+                              const char* end,
+                              const IOBuf* owner,
+                              IOBufQueue& out) {
+  if (begin == end) {
+    return;
+  }
+  if (!normalizer_) {
+    emit(begin, end, owner, out);
+    return;
+  }
+  if (!pending_.empty()) {
+    // pending_ holds a (possibly partial) combining sequence, which goes
+    // on up to the first boundary of this chunk
+    const char* p = firstBoundary(begin, end);
+    pending_.append(begin, p);
+    if (p == end) {
+      return;
+    }
+    finish(out);
+    begin = p;
+  }
+  const char* p = lastBoundary(begin, end);
+  emit(begin, p, owner, out);
+  pending_.assign(p, end);
+}
+
+void Normalizer::emit(const char* begin,
+                      const char* end,
+                      const IOBuf* owner,
+                      IOBufQueue& out) {
+  if (begin == end) {
+    return;
+  }
+  StringPiece sp(begin, end);
+  if (!normalizer_ || isNormalized(sp)) {
+    if (owner) {
+      auto buf = owner->cloneOne();
+      buf->trimStart(begin - reinterpret_cast<const char*>(owner->data()));
+      buf->trimEnd(reinterpret_cast<const char*>(owner->tail()) - end);
+      out.append(std::move(buf));
+    } else {
+      out.append(sp);
+    }
+    return;
+  }
+  IOBufQueueSink sink(out);
+  UErrorCode err = U_ZERO_ERROR;
+  icu::StringPiece usp(sp.begin(), (int32_t)sp.size());
+#if U_ICU_VERSION_MAJOR_NUM >= 60
+  normalizer_->normalizeUTF8(0, usp, sink, nullptr, err);
+#else
+  normalizer_->normalize(icu::UnicodeString::fromUTF8(usp), err)
+    .toUTF8(sink);
+#endif
+  if (U_FAILURE(err)) {
+    LOG(WARNING) << "normalize error: " << u_errorName(err);
+  }
+}
+
+const char* Normalizer::firstBoundary(const char* begin,
+                                      const char* end) const {
+  const char* p = begin;
+  // the rest of a code point split by the chunk boundary
+  while (p != end && U8_IS_TRAIL(*p)) {
+    ++p;
+  }
+  int32_t i = 0;
+  int32_t length = end - p;
+  while (i < length) {
+    int32_t start = i;
+    UChar32 c;
+    U8_NEXT(p, i, length, c);
+    if (c >= 0 && normalizer_->hasBoundaryBefore(c)) {
+      return p + start;
+    }
+  }
+  return end;
+}
+
+const char* Normalizer::lastBoundary(const char* begin,
+                                     const char* end) const {
+  // Only split before a well-formed code point: a sequence truncated by
+  // the end of the chunk stays pending.
+  int32_t i = end - begin;
+  while (i > 0) {
+    UChar32 c;
+    U8_PREV(begin, 0, i, c);
+    if (c >= 0 && normalizer_->hasBoundaryBefore(c)) {
+      return begin + i;
+    }
+  }
+  return begin;
+}
+
+bool Normalizer::isNormalized(StringPiece sp) const {
+  if (stringIsAscii(sp)) {
+    return true;    // in all forms
+  }
+  UErrorCode err = U_ZERO_ERROR;
+  icu::StringPiece usp(sp.begin(), (int32_t)sp.size());
+#if U_ICU_VERSION_MAJOR_NUM >= 60
+  bool normalized = normalizer_->isNormalizedUTF8(usp, err);
+#else
+  bool normalized =
+    normalizer_->isNormalized(icu::UnicodeString::fromUTF8(usp), err);
+#endif
+  return U_SUCCESS(err) && normalized;
+}
+
+} // namespace unicode
+} // namespace folly
+
+#endif
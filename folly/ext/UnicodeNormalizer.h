@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOLLY_EXT_UNICODE_NORMALIZER_H_
+#define FOLLY_EXT_UNICODE_NORMALIZER_H_
+
+#include <folly/ext/Unicode.h>
+
+#if FOLLY_HAVE_LIBICU
+
+#include <memory>
+#include <string>
+
+#include <folly/Range.h>
+#include <folly/io/Cursor.h>
+#include <folly/io/IOBuf.h>
+#include <folly/io/IOBufQueue.h>
+
+#ifdef __APPLE__
+#define U_DISABLE_RENAMING 1
+#endif
+
+#include <unicode/utypes.h>
+
+U_NAMESPACE_BEGIN
+class Normalizer2;
+U_NAMESPACE_END
+
+namespace folly {
+namespace unicode {
+
+/**
+ * Incremental Unicode normalization of UTF-8 streams.
+ *
+ *   Normalizer normalizer(NORM_NFC);
+ *   IOBufQueue out;
+ *   while (auto buf = readSomething()) {
+ *     normalizer.process(std::move(buf), out);
+ *   }
+ *   normalizer.finish(out);
+ *
+ * Input may be split anywhere, also inside a code point or a combining
+ * sequence: the text after the last normalization boundary of a chunk is
+ * kept until the next chunk (or finish()) tells where it ends.
+ *
+ * Text between boundaries which is already normalized (checked with the
+ * ASCII and ICU quick checks) is passed through; when it comes in as an
+ * IOBuf it is appended to out by reference, without copying.
+ *
+ * Ill-formed UTF-8 is handled as by ICU.
+ */
+class Normalizer {
+public:
+  explicit Normalizer(NormalizationMode mode);
+
+  /**
+   * Normalize a chain of buffers, taking ownership.
+   */
+  void process(std::unique_ptr<IOBuf> buf, IOBufQueue& out);
+
+  /**
+   * Normalize the remaining data of cursor, advancing it to the end.
+   */
+  void process(io::Cursor& cursor, IOBufQueue& out);
+
+  /**
+   * Normalize a chunk of bytes; they are copied when written to out.
+   */
+  void process(StringPiece chunk, IOBufQueue& out);
+
+  /**
+   * Write out the pending text, at the end of the stream.
+   * The normalizer may then be reused for another stream.
+   */
+  void finish(IOBufQueue& out);
+
+  /**
+   * Normalize a whole chain. Parts that are already normalized are not
+   * copied, so a normalized chain is returned as is.
+   */
+  static std::unique_ptr<IOBuf> normalize(std::unique_ptr<IOBuf> buf,
+                                          NormalizationMode mode);
+
+private:
+  void processRange(const char* begin,
+                    const char* end,
+                    const IOBuf* owner,
+                    IOBufQueue& out);
+
+  // Write out [begin, end), both at normalization boundaries
+  void emit(const char* begin,
+            const char* end,
+            const IOBuf* owner,
+            IOBufQueue& out);
+
+  // Position of the first boundary in [begin, end), end if none
+  const char* firstBoundary(const char* begin, const char* end) const;
+  // Position of the last boundary in [begin, end), begin if none
+  const char* lastBoundary(const char* begin, const char* end) const;
+
+  bool isNormalized(StringPiece sp) const;
+
+  const icu::Normalizer2* normalizer_;  // nullptr for NORM_NONE
+  std::string pending_;   // text after the last boundary seen
+};
+
+} // namespace unicode
+} // namespace folly
+
+#endif
+
+#endif /* FOLLY_EXT_UNICODE_NORMALIZER_H_ */
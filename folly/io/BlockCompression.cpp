@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/io/BlockCompression.h>
+
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <folly/Conv.h>
+#include <folly/MoveWrapper.h>
+#include <folly/Portability.h>
+#include <folly/SpookyHashV2.h>
+#include <folly/io/Cursor.h>
+
+namespace folly { namespace io {
+
+namespace detail {
+
+FOLLY_PACK_PUSH
+struct BlockIndexEntry {
+  uint64_t offset;        // of the compressed block in the container
+  uint64_t length;        // of the compressed block
+  uint64_t hash;          // of the compressed block
+} FOLLY_PACK_ATTR;
+FOLLY_PACK_POP
+
+}  // namespace detail
+
+namespace {
+
+using detail::BlockIndexEntry;
+
+FOLLY_PACK_PUSH
+struct Footer {
+  // Any value will do, as long as it differs from the RecordIO magic
+  static constexpr uint32_t kMagic = 0xb10c5eed;
+  uint64_t indexOffset;
+  uint64_t uncompressedLength;
+  uint64_t indexHash;
+  uint32_t blockCount;
+  uint32_t blockSize;
+  uint8_t  version;       // backwards incompatible version, currently 0
+  uint8_t  codecType;
+  uint16_t flags;         // reserved (must be 0)
+  uint32_t footerHash;
+  uint32_t magic;         // must be last
+} FOLLY_PACK_ATTR;
+FOLLY_PACK_POP
+
+static_assert(offsetof(Footer, magic) + sizeof(Footer::magic) ==
+              sizeof(Footer), "invalid footer layout");
+
+constexpr uint32_t kHashSeed = 0xdeadbeef;
+
+uint64_t dataHash(ByteRange range) {
+  return hash::SpookyHashV2::Hash64(range.data(), range.size(), kHashSeed);
+}
+
+uint64_t dataHash(const IOBuf* buf) {
+  hash::SpookyHashV2 hasher;
+  hasher.Init(kHashSeed, kHashSeed);
+  for (auto br : *buf) {
+    hasher.Update(br.data(), br.size());
+  }
+  uint64_t hash1;
+  uint64_t hash2;
+  hasher.Final(&hash1, &hash2);
+  return hash1;
+}
+
+uint32_t footerHash(const Footer& footer) {
+  return hash::SpookyHashV2::Hash32(&footer, offsetof(Footer, footerHash),
+                                    kHashSeed);
+}
+
+struct CompressedBlock {
+  std::unique_ptr<IOBuf> data;
+  uint64_t length;
+  uint64_t hash;
+};
+
+// Assemble the container from the compressed blocks, which it takes over
+std::unique_ptr<IOBuf> writeContainer(std::vector<CompressedBlock>& blocks,
+                                      CodecType type,
+                                      size_t blockSize,
+                                      uint64_t uncompressedLength) {
+  size_t indexLength = blocks.size() * sizeof(BlockIndexEntry);
+  auto tail = IOBuf::create(indexLength + sizeof(Footer));
+  tail->append(indexLength + sizeof(Footer));
+  auto index = reinterpret_cast<BlockIndexEntry*>(tail->writableData());
+
+  auto out = IOBuf::create(0);
+  uint64_t offset = 0;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    index[i].offset = offset;
+    index[i].length = blocks[i].length;
+    index[i].hash = blocks[i].hash;
+    offset += blocks[i].length;
+    out->prependChain(std::move(blocks[i].data));
+  }
+
+  auto footer = reinterpret_cast<Footer*>(tail->writableData() + indexLength);
+  memset(footer, 0, sizeof(Footer));
+  footer->indexOffset = offset;
+  footer->uncompressedLength = uncompressedLength;
+  footer->indexHash = dataHash(ByteRange(tail->data(), indexLength));
+  footer->blockCount = blocks.size();
+  footer->blockSize = blockSize;
+  footer->codecType = static_cast<uint8_t>(type);
+  footer->footerHash = footerHash(*footer);
+  footer->magic = Footer::kMagic;
+
+  out->prependChain(std::move(tail));
+  return out;
+}
+
+std::unique_ptr<IOBuf> joinBlocks(
+    std::vector<std::unique_ptr<IOBuf>>& blocks) {
+  auto out = IOBuf::create(0);
+  for (auto& block : blocks) {
+    out->prependChain(std::move(block));
+  }
+  return out;
+}
+
+}  // namespace
+
+Future<std::unique_ptr<IOBuf>> compressBlocks(
+    const IOBuf& data,
+    Executor* executor,
+    CodecType type,
+    int level,
+    size_t blockSize) {
+  if (blockSize == 0 || blockSize > std::numeric_limits<uint32_t>::max()) {
+    throw std::invalid_argument(to<std::string>(
+        "Invalid compression block size ", blockSize));
+  }
+  // Fail early if the codec isn't supported
+  auto codec = getCodec(type, level);
+  if (blockSize > codec->maxUncompressedLength()) {
+    throw std::invalid_argument(to<std::string>(
+        "Compression block size ", blockSize, " too large for codec ",
+        static_cast<int>(type)));
+  }
+
+  uint64_t length = data.computeChainDataLength();
+  std::vector<Future<CompressedBlock>> blocks;
+  blocks.reserve((length + blockSize - 1) / blockSize);
+
+  // Codecs aren't thread-safe, so each block gets its own
+  Cursor cursor(&data);
+  while (!cursor.isAtEnd()) {
+    std::unique_ptr<IOBuf> block;
+    cursor.cloneAtMost(block, blockSize);
+    auto wrapped = makeMoveWrapper(std::move(block));
+    blocks.push_back(via(executor, [wrapped, type, level] {
+      CompressedBlock compressed;
+      compressed.data = getCodec(type, level)->compress(wrapped->get());
+      compressed.length = compressed.data->computeChainDataLength();
+      compressed.hash = dataHash(compressed.data.get());
+      return compressed;
+    }));
+  }
+
+  return collect(blocks).then(
+      [type, blockSize, length] (std::vector<CompressedBlock>&& compressed) {
+    return writeContainer(compressed, type, blockSize, length);
+  });
+}
+
+BlockCompressedReader::BlockCompressedReader(ByteRange container)
+  : container_(container) {
+  if (container.size() < sizeof(Footer)) {
+    throw std::runtime_error("BlockCompressedReader: container too short");
+  }
+  const Footer* footer = reinterpret_cast<const Footer*>(
+      container.end() - sizeof(Footer));
+  if (footer->magic != Footer::kMagic ||
+      footer->version != 0 ||
+      footer->flags != 0 ||
+      footerHash(*footer) != footer->footerHash) {
+    throw std::runtime_error("BlockCompressedReader: invalid footer");
+  }
+
+  uint64_t indexLength =
+    uint64_t(footer->blockCount) * sizeof(BlockIndexEntry);
+  uint64_t length = footer->uncompressedLength;
+  uint64_t blockSize = footer->blockSize;
+  if (footer->codecType == static_cast<uint8_t>(CodecType::USER_DEFINED) ||
+      footer->codecType >= static_cast<uint8_t>(CodecType::NUM_CODEC_TYPES) ||
+      blockSize == 0 ||
+      length / blockSize + (length % blockSize != 0) != footer->blockCount ||
+      footer->indexOffset > container.size() - sizeof(Footer) ||
+      container.size() - sizeof(Footer) - footer->indexOffset !=
+        indexLength) {
+    throw std::runtime_error("BlockCompressedReader: invalid footer");
+  }
+
+  ByteRange index(container.begin() + footer->indexOffset, indexLength);
+  if (dataHash(index) != footer->indexHash) {
+    throw std::runtime_error("BlockCompressedReader: invalid index");
+  }
+
+  index_ = reinterpret_cast<const BlockIndexEntry*>(index.begin());
+  type_ = static_cast<CodecType>(footer->codecType);
+  blockCount_ = footer->blockCount;
+  blockSize_ = footer->blockSize;
+  uncompressedLength_ = footer->uncompressedLength;
+}
+
+const BlockIndexEntry& BlockCompressedReader::entry(size_t i) const {
+  if (i >= blockCount_) {
+    throw std::out_of_range(to<std::string>(
+        "BlockCompressedReader: no block ", i, " in ", blockCount_));
+  }
+  return index_[i];
+}
+
+size_t BlockCompressedReader::blockFor(uint64_t offset) const {
+  return offset / blockSize_;
+}
+
+ByteRange BlockCompressedReader::compressedBlock(size_t i) const {
+  const BlockIndexEntry& e = entry(i);
+  // the index is hashed, but may have been built maliciously
+  uint64_t indexOffset = reinterpret_cast<const uint8_t*>(index_) -
+                         container_.begin();
+  if (e.offset > indexOffset || e.length > indexOffset - e.offset) {
+    throw std::runtime_error(to<std::string>(
+        "BlockCompressedReader: block ", i, " out of bounds"));
+  }
+  return ByteRange(container_.begin() + e.offset, e.length);
+}
+
+std::unique_ptr<IOBuf> BlockCompressedReader::uncompressBlock(size_t i) const {
+  ByteRange range = compressedBlock(i);
+  if (dataHash(range) != index_[i].hash) {
+    throw std::runtime_error(to<std::string>(
+        "BlockCompressedReader: block ", i, " is corrupted"));
+  }
+  uint64_t length = std::min(uint64_t(blockSize_),
+                             uncompressedLength_ - uint64_t(i) * blockSize_);
+  auto buf = IOBuf::wrapBuffer(range);
+  return getCodec(type_)->uncompress(buf.get(), length);
+}
+
+Future<std::unique_ptr<IOBuf>> BlockCompressedReader::uncompress(
+    Executor* executor) const {
+  std::vector<Future<std::unique_ptr<IOBuf>>> blocks;
+  blocks.reserve(blockCount_);
+  for (size_t i = 0; i < blockCount_; ++i) {
+    blocks.push_back(via(executor, [this, i] {
+      return uncompressBlock(i);
+    }));
+  }
+  return collect(blocks).then(
+      [] (std::vector<std::unique_ptr<IOBuf>>&& uncompressed) {
+    return joinBlocks(uncompressed);
+  });
+}
+
+}}  // namespaces
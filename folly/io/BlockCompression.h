@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Block compression: parallel compression of large IOBuf chains
+ *
+ * The input is split into blocks of a fixed uncompressed size, which are
+ * compressed independently of each other on an Executor, using any of the
+ * codecs of folly/io/Compression.h.  The result is a seekable container:
+ *
+ *   block 0 | block 1 | ... | block N-1 | index | footer
+ *
+ * The index holds the offset, lengths and hash of each compressed block,
+ * and the fixed-size footer at the very end locates the index, so any
+ * block can be uncompressed on its own, given the container in memory
+ * (typically a MemoryMapping of the file it was written to).
+ *
+ *   auto container = compressBlocks(*data, executor, CodecType::ZSTD).get();
+ *   ...
+ *   BlockCompressedReader reader(mapping.range());
+ *   auto buf = reader.uncompressBlock(reader.blockFor(offset));
+ *
+ * Smaller blocks allow finer random access and more parallelism, at the
+ * expense of the compression ratio.
+ */
+#ifndef FOLLY_IO_BLOCKCOMPRESSION_H_
+#define FOLLY_IO_BLOCKCOMPRESSION_H_
+
+#include <cstdint>
+#include <memory>
+
+#include <folly/Executor.h>
+#include <folly/Range.h>
+#include <folly/futures/Future.h>
+#include <folly/io/Compression.h>
+#include <folly/io/IOBuf.h>
+
+namespace folly { namespace io {
+
+namespace detail {
+struct BlockIndexEntry;
+}
+
+constexpr size_t kDefaultCompressionBlockSize = 4 << 20;
+
+/**
+ * Compress data into a block compressed container, compressing the blocks
+ * on executor.  The blocks are cloned from data up front, so data needn't
+ * outlive the call, but it must not be modified in place before the
+ * future completes.
+ *
+ * Throws std::invalid_argument if blockSize is 0 or doesn't fit in 32 bits,
+ * or if the codec can't compress blocks of blockSize bytes; compression
+ * errors complete the future with an exception.
+ */
+Future<std::unique_ptr<IOBuf>> compressBlocks(
+    const IOBuf& data,
+    Executor* executor,
+    CodecType type,
+    int level = COMPRESSION_LEVEL_DEFAULT,
+    size_t blockSize = kDefaultCompressionBlockSize);
+
+/**
+ * Random access to a block compressed container.  The reader doesn't copy
+ * the container, which must outlive it, and the uncompressed IOBufs,
+ * which may share storage with it.
+ *
+ * BlockCompressedReader is thread-safe: blocks may be uncompressed
+ * concurrently.
+ */
+class BlockCompressedReader {
+public:
+  /**
+   * Parse the footer and index of container.  Throws std::runtime_error if
+   * they are invalid.
+   */
+  explicit BlockCompressedReader(ByteRange container);
+
+  CodecType type() const { return type_; }
+  size_t blockCount() const { return blockCount_; }
+  size_t blockSize() const { return blockSize_; }
+  uint64_t uncompressedLength() const { return uncompressedLength_; }
+
+  /**
+   * Number of the block holding uncompressed byte offset.
+   */
+  size_t blockFor(uint64_t offset) const;
+
+  /**
+   * Compressed bytes of block i, within the container.
+   */
+  ByteRange compressedBlock(size_t i) const;
+
+  /**
+   * Uncompress block i.  Throws std::out_of_range if there is no such block,
+   * and std::runtime_error if the block is corrupted.
+   */
+  std::unique_ptr<IOBuf> uncompressBlock(size_t i) const;
+
+  /**
+   * Uncompress the whole container, uncompressing the blocks on executor.
+   * The reader must outlive the future.
+   */
+  Future<std::unique_ptr<IOBuf>> uncompress(Executor* executor) const;
+
+private:
+  const detail::BlockIndexEntry& entry(size_t i) const;
+
+  ByteRange container_;
+  const detail::BlockIndexEntry* index_;
+  CodecType type_;
+  size_t blockCount_;
+  size_t blockSize_;
+  uint64_t uncompressedLength_;
+};
+
+}}  // namespaces
+
+#endif /* FOLLY_IO_BLOCKCOMPRESSION_H_ */
@@ -19,6 +19,7 @@
 #if FOLLY_HAVE_LIBLZ4
 #include <lz4.h>
 #include <lz4hc.h>
+#include <lz4frame.h>
 #endif
 
 #include <glog/logging.h>
@@ -36,12 +37,22 @@
 #include <lzma.h>
 #endif
 
+#if FOLLY_HAVE_LIBZSTD
+#include <atomic>
+#include <zstd.h>
+#include <zdict.h>
+#if ZSTD_VERSION_NUMBER < 10400
+#error "ZstdCodec needs zstd 1.4 or later"
+#endif
+#endif
+
 #include <folly/Conv.h>
 #include <folly/Memory.h>
 #include <folly/Portability.h>
 #include <folly/ScopeGuard.h>
 #include <folly/Varint.h>
 #include <folly/io/Cursor.h>
+#include <folly/io/IOBufQueue.h>
 
 namespace folly { namespace io {
 
@@ -98,6 +109,119 @@ uint64_t Codec::doMaxUncompressedLength() const {
 
 namespace {
 
+// Output is appended in buffers of this size, at least
+constexpr uint64_t kStreamBufferLength = uint64_t(64) << 10;  // 64KiB
+
+}  // namespace
+
+bool Codec::supportsStreaming() const {
+  return doSupportsStreaming();
+}
+
+void Codec::compressStream(IOBufQueue& input,
+                           IOBufQueue& output,
+                           FlushOp flushOp) {
+  if (!supportsStreaming()) {
+    throw std::invalid_argument("Codec: streaming not supported");
+  }
+
+  // Flush or end after the last buffer only, or right away if there's none
+  auto compressRange = [&] (ByteRange& in, FlushOp op) {
+    bool done;
+    do {
+      auto room = output.preallocate(doMinStreamOutputLength(),
+                                     kStreamBufferLength);
+      MutableByteRange out(static_cast<uint8_t*>(room.first), room.second);
+      done = doCompressStream(in, out, op);
+      output.postallocate(room.second - out.size());
+    } while (!done);
+  };
+
+  const IOBuf* front;
+  while ((front = input.front()) != nullptr) {
+    bool last = !front->isChained();
+    ByteRange in(front->data(), front->length());
+    compressRange(in, last ? flushOp : FlushOp::NONE);
+    if (front->empty()) {
+      input.pop_front();
+    } else {
+      input.trimStart(front->length());
+    }
+    if (last) {
+      return;
+    }
+  }
+  ByteRange in;
+  compressRange(in, flushOp);
+}
+
+bool Codec::uncompressStream(IOBufQueue& input,
+                             IOBufQueue& output,
+                             FlushOp flushOp) {
+  if (!supportsStreaming()) {
+    throw std::invalid_argument("Codec: streaming not supported");
+  }
+
+  const IOBuf* front;
+  while ((front = input.front()) != nullptr) {
+    ByteRange in(front->data(), front->length());
+    bool streamEnd;
+    bool outputFull;
+    do {
+      auto room = output.preallocate(doMinStreamOutputLength(),
+                                     kStreamBufferLength);
+      MutableByteRange out(static_cast<uint8_t*>(room.first), room.second);
+      streamEnd = doUncompressStream(in, out);
+      outputFull = out.empty();
+      output.postallocate(room.second - out.size());
+      // A full output may leave some pending in the codec
+    } while (!streamEnd && (!in.empty() || outputFull));
+
+    uint64_t consumed = front->length() - in.size();
+    if (front->empty()) {
+      input.pop_front();
+    } else if (consumed != 0) {
+      input.trimStart(consumed);
+    }
+    if (streamEnd) {
+      return true;
+    }
+  }
+
+  if (flushOp == FlushOp::END) {
+    throw std::runtime_error("Codec: truncated stream");
+  }
+  return false;
+}
+
+void Codec::resetStream() {
+  doResetStream();
+}
+
+bool Codec::doSupportsStreaming() const {
+  return false;
+}
+
+uint64_t Codec::doMinStreamOutputLength() const {
+  return 1;
+}
+
+void Codec::doResetStream() {
+}
+
+bool Codec::doCompressStream(ByteRange& input,
+                             MutableByteRange& output,
+                             FlushOp flushOp) {
+  throw std::invalid_argument("Codec: streaming not supported");
+}
+
+bool Codec::doUncompressStream(ByteRange& input,
+                               MutableByteRange& output) {
+  throw std::invalid_argument("Codec: streaming not supported");
+}
+
+namespace {
+
 /**
  * No compression
  */
@@ -148,6 +272,57 @@ std::unique_ptr<IOBuf> NoCompressionCodec::doUncompress(
   return data->clone();
 }
 
+/**
+ * Uncompress data with uncompressRange(input, output), which consumes
+ * input and fills output, returning true at the end of stream like
+ * doUncompressStream() does.
+ */
+template <class F>
+std::unique_ptr<IOBuf> uncompressRanges(const char* name,
+                                        const IOBuf* data,
+                                        uint64_t uncompressedLength,
+                                        F uncompressRange) {
+  // Max 64MiB in one go
+  constexpr uint64_t maxSingleStepLength = uint64_t(64) << 20;    // 64MiB
+  constexpr uint64_t defaultBufferLength = uint64_t(4) << 20;     // 4MiB
+
+  uint64_t bufferLength =
+    (uncompressedLength != Codec::UNKNOWN_UNCOMPRESSED_LENGTH &&
+     uncompressedLength <= maxSingleStepLength) ?
+    std::max(uncompressedLength, uint64_t(1)) :
+    defaultBufferLength;
+
+  IOBufQueue out(IOBufQueue::cacheChainLength());
+  bool streamEnd = false;
+  for (auto& range : *data) {
+    ByteRange in(range);
+    bool outputFull = false;
+    // A full output may leave some pending in the codec
+    while (!in.empty() || (outputFull && !streamEnd)) {
+      if (streamEnd) {
+        throw std::runtime_error(to<std::string>(
+            name, ": junk after end of data"));
+      }
+      auto room = out.preallocate(1, bufferLength);
+      MutableByteRange o(static_cast<uint8_t*>(room.first), room.second);
+      streamEnd = uncompressRange(in, o);
+      outputFull = o.empty();
+      out.postallocate(room.second - o.size());
+    }
+  }
+  if (!streamEnd) {
+    throw std::runtime_error(to<std::string>(name, ": truncated data"));
+  }
+  if (uncompressedLength != Codec::UNKNOWN_UNCOMPRESSED_LENGTH &&
+      uncompressedLength != out.chainLength()) {
+    throw std::runtime_error(to<std::string>(
+        name, ": invalid uncompressed length"));
+  }
+
+  auto result = out.move();
+  return result ? std::move(result) : IOBuf::create(0);
+}
+
 #if (FOLLY_HAVE_LIBLZ4 || FOLLY_HAVE_LIBLZMA)
 
 namespace {
@@ -314,6 +489,210 @@ std::unique_ptr<IOBuf> LZ4Codec::doUncompress(
   return out;
 }
 
+/**
+ * LZ4 frame format compression
+ */
+class LZ4FrameCodec FOLLY_FINAL : public Codec {
+ public:
+  static std::unique_ptr<Codec> create(int level, CodecType type);
+  explicit LZ4FrameCodec(int level, CodecType type);
+  ~LZ4FrameCodec();
+
+ private:
+  std::unique_ptr<IOBuf> doCompress(const IOBuf* data) FOLLY_OVERRIDE;
+  std::unique_ptr<IOBuf> doUncompress(
+      const IOBuf* data,
+      uint64_t uncompressedLength) FOLLY_OVERRIDE;
+
+  bool doSupportsStreaming() const FOLLY_OVERRIDE;
+  uint64_t doMinStreamOutputLength() const FOLLY_OVERRIDE;
+  void doResetStream() FOLLY_OVERRIDE;
+  bool doCompressStream(ByteRange& input,
+                        MutableByteRange& output,
+                        FlushOp flushOp) FOLLY_OVERRIDE;
+  bool doUncompressStream(ByteRange& input,
+                          MutableByteRange& output) FOLLY_OVERRIDE;
+
+  LZ4F_preferences_t prefs_;
+
+  // Streaming state, created on first use
+  LZ4F_compressionContext_t cctx_{nullptr};
+  LZ4F_decompressionContext_t dctx_{nullptr};
+  bool frameStarted_{false};
+};
+
+namespace {
+
+// LZ4F_compressUpdate() needs room for a whole compressed step
+constexpr size_t kLZ4FrameStep = size_t(64) << 10;  // 64KiB
+
+size_t checkLZ4F(size_t code, const char* what) {
+  if (LZ4F_isError(code)) {
+    throw std::runtime_error(to<std::string>(
+        "LZ4FrameCodec: ", what, " error: ", LZ4F_getErrorName(code)));
+  }
+  return code;
+}
+
+LZ4F_decompressionContext_t createLZ4FDecompressionContext() {
+  LZ4F_decompressionContext_t dctx;
+  checkLZ4F(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION),
+            "LZ4F_createDecompressionContext");
+  return dctx;
+}
+
+// Returns true at the end of the frame
+bool decompressLZ4Frame(LZ4F_decompressionContext_t dctx,
+                        ByteRange& input,
+                        MutableByteRange& output) {
+  size_t inputSize = input.size();
+  size_t outputSize = output.size();
+  size_t hint = checkLZ4F(
+      LZ4F_decompress(dctx, output.data(), &outputSize,
+                      input.data(), &inputSize, nullptr),
+      "LZ4F_decompress");
+  input.advance(inputSize);
+  output.advance(outputSize);
+  return hint == 0;
+}
+
+}  // namespace
+
+std::unique_ptr<Codec> LZ4FrameCodec::create(int level, CodecType type) {
+  return make_unique<LZ4FrameCodec>(level, type);
+}
+
+LZ4FrameCodec::LZ4FrameCodec(int level, CodecType type) : Codec(type) {
+  DCHECK(type == CodecType::LZ4_FRAME);
+  switch (level) {
+  case COMPRESSION_LEVEL_FASTEST:
+  case COMPRESSION_LEVEL_DEFAULT:
+    level = 0;
+    break;
+  case COMPRESSION_LEVEL_BEST:
+    level = 16;
+    break;
+  }
+  if (level < 0 || level > 16) {
+    throw std::invalid_argument(to<std::string>(
+        "LZ4FrameCodec: invalid level: ", level));
+  }
+  memset(&prefs_, 0, sizeof(prefs_));
+  prefs_.compressionLevel = level;
+}
+
+LZ4FrameCodec::~LZ4FrameCodec() {
+  doResetStream();
+}
+
+std::unique_ptr<IOBuf> LZ4FrameCodec::doCompress(const IOBuf* data) {
+  std::unique_ptr<IOBuf> clone;
+  if (data->isChained()) {
+    // LZ4F_compressFrame() wants a single buffer
+    clone = data->clone();
+    clone->coalesce();
+    data = clone.get();
+  }
+
+  auto out = IOBuf::create(LZ4F_compressFrameBound(data->length(), &prefs_));
+  size_t n = checkLZ4F(
+      LZ4F_compressFrame(out->writableTail(), out->tailroom(),
+                         data->data(), data->length(), &prefs_),
+      "LZ4F_compressFrame");
+  out->append(n);
+  return out;
+}
+
+std::unique_ptr<IOBuf> LZ4FrameCodec::doUncompress(
+    const IOBuf* data,
+    uint64_t uncompressedLength) {
+  auto dctx = createLZ4FDecompressionContext();
+  SCOPE_EXIT { LZ4F_freeDecompressionContext(dctx); };
+
+  return uncompressRanges(
+      "LZ4FrameCodec", data, uncompressedLength,
+      [dctx] (ByteRange& input, MutableByteRange& output) {
+        return decompressLZ4Frame(dctx, input, output);
+      });
+}
+
+bool LZ4FrameCodec::doSupportsStreaming() const {
+  return true;
+}
+
+uint64_t LZ4FrameCodec::doMinStreamOutputLength() const {
+  return LZ4F_compressBound(kLZ4FrameStep, &prefs_);
+}
+
+void LZ4FrameCodec::doResetStream() {
+  if (cctx_) {
+    LZ4F_freeCompressionContext(cctx_);
+    cctx_ = nullptr;
+  }
+  frameStarted_ = false;
+  if (dctx_) {
+    LZ4F_freeDecompressionContext(dctx_);
+    dctx_ = nullptr;
+  }
+}
+
+bool LZ4FrameCodec::doCompressStream(ByteRange& input,
+                                     MutableByteRange& output,
+                                     FlushOp flushOp) {
+  if (!cctx_) {
+    checkLZ4F(LZ4F_createCompressionContext(&cctx_, LZ4F_VERSION),
+              "LZ4F_createCompressionContext");
+  }
+  if (!frameStarted_) {
+    size_t n = checkLZ4F(
+        LZ4F_compressBegin(cctx_, output.data(), output.size(), &prefs_),
+        "LZ4F_compressBegin");
+    output.advance(n);
+    frameStarted_ = true;
+  }
+
+  while (!input.empty()) {
+    size_t step = std::min(input.size(), kLZ4FrameStep);
+    if (output.size() < LZ4F_compressBound(step, &prefs_)) {
+      return false;
+    }
+    size_t n = checkLZ4F(
+        LZ4F_compressUpdate(cctx_, output.data(), output.size(),
+                            input.data(), step, nullptr),
+        "LZ4F_compressUpdate");
+    input.advance(step);
+    output.advance(n);
+  }
+
+  if (flushOp == FlushOp::NONE) {
+    return true;
+  }
+  // Room for whatever is buffered
+  if (output.size() < LZ4F_compressBound(0, &prefs_)) {
+    return false;
+  }
+  size_t n;
+  if (flushOp == FlushOp::FLUSH) {
+    n = checkLZ4F(LZ4F_flush(cctx_, output.data(), output.size(), nullptr),
+                  "LZ4F_flush");
+  } else {
+    n = checkLZ4F(
+        LZ4F_compressEnd(cctx_, output.data(), output.size(), nullptr),
+        "LZ4F_compressEnd");
+    frameStarted_ = false;
+  }
+  output.advance(n);
+  return true;
+}
+
+bool LZ4FrameCodec::doUncompressStream(ByteRange& input,
+                                       MutableByteRange& output) {
+  if (!dctx_) {
+    dctx_ = createLZ4FDecompressionContext();
+  }
+  return decompressLZ4Frame(dctx_, input, output);
+}
+
 #endif  // FOLLY_HAVE_LIBLZ4
 
 #if FOLLY_HAVE_LIBSNAPPY
@@ -447,6 +826,7 @@ class ZlibCodec FOLLY_FINAL : public Codec {
  public:
   static std::unique_ptr<Codec> create(int level, CodecType type);
   explicit ZlibCodec(int level, CodecType type);
+  ~ZlibCodec();
 
  private:
   std::unique_ptr<IOBuf> doCompress(const IOBuf* data) FOLLY_OVERRIDE;
@@ -454,10 +834,24 @@ class ZlibCodec FOLLY_FINAL : public Codec {
       const IOBuf* data,
       uint64_t uncompressedLength) FOLLY_OVERRIDE;
 
+  bool doSupportsStreaming() const FOLLY_OVERRIDE;
+  void doResetStream() FOLLY_OVERRIDE;
+  bool doCompressStream(ByteRange& input,
+                        MutableByteRange& output,
+                        FlushOp flushOp) FOLLY_OVERRIDE;
+  bool doUncompressStream(ByteRange& input,
+                          MutableByteRange& output) FOLLY_OVERRIDE;
+
   std::unique_ptr<IOBuf> addOutputBuffer(z_stream* stream, uint32_t length);
   bool doInflate(z_stream* stream, IOBuf* head, uint32_t bufferLength);
 
   int level_;
+
+  // Streaming state, initialized on first use
+  z_stream deflateStream_;
+  z_stream inflateStream_;
+  bool deflateActive_{false};
+  bool inflateActive_{false};
 };
 
 std::unique_ptr<Codec> ZlibCodec::create(int level, CodecType type) {
@@ -484,6 +878,10 @@ ZlibCodec::ZlibCodec(int level, CodecType type) : Codec(type) {
   level_ = level;
 }
 
+ZlibCodec::~ZlibCodec() {
+  doResetStream();
+}
+
 std::unique_ptr<IOBuf> ZlibCodec::addOutputBuffer(z_stream* stream,
                                                   uint32_t length) {
   CHECK_EQ(stream->avail_out, 0);
@@ -677,6 +1075,130 @@ std::unique_ptr<IOBuf> ZlibCodec::doUncompress(const IOBuf* data,
   return out;
 }
 
+bool ZlibCodec::doSupportsStreaming() const {
+  return true;
+}
+
+void ZlibCodec::doResetStream() {
+  if (deflateActive_) {
+    deflateEnd(&deflateStream_);
+    deflateActive_ = false;
+  }
+  if (inflateActive_) {
+    inflateEnd(&inflateStream_);
+    inflateActive_ = false;
+  }
+}
+
+namespace {
+
+// z_stream lengths are 32 bits
+constexpr uint64_t kMaxZlibStep = std::numeric_limits<uInt>::max();
+
+void setZlibStream(z_stream* stream,
+                   const ByteRange& input,
+                   const MutableByteRange& output) {
+  stream->next_in = const_cast<uint8_t*>(input.data());
+  stream->avail_in = std::min(uint64_t(input.size()), kMaxZlibStep);
+  stream->next_out = output.data();
+  stream->avail_out = std::min(uint64_t(output.size()), kMaxZlibStep);
+}
+
+void advanceZlibStream(const z_stream* stream,
+                       ByteRange& input,
+                       MutableByteRange& output) {
+  input.advance(stream->next_in - input.data());
+  output.advance(stream->next_out - output.data());
+}
+
+}  // namespace
+
+bool ZlibCodec::doCompressStream(ByteRange& input,
+                                 MutableByteRange& output,
+                                 FlushOp flushOp) {
+  if (!deflateActive_) {
+    memset(&deflateStream_, 0, sizeof(deflateStream_));
+    int rc = deflateInit(&deflateStream_, level_);
+    if (rc != Z_OK) {
+      throw std::runtime_error(to<std::string>(
+          "ZlibCodec: deflateInit error: ", rc, ": ", deflateStream_.msg));
+    }
+    deflateActive_ = true;
+  }
+
+  int flush = Z_NO_FLUSH;
+  switch (flushOp) {
+  case FlushOp::NONE:
+    break;
+  case FlushOp::FLUSH:
+    flush = Z_SYNC_FLUSH;
+    break;
+  case FlushOp::END:
+    flush = Z_FINISH;
+    break;
+  }
+
+  setZlibStream(&deflateStream_, input, output);
+  int rc = deflate(&deflateStream_, flush);
+  advanceZlibStream(&deflateStream_, input, output);
+
+  switch (rc) {
+  case Z_OK:
+  case Z_BUF_ERROR:  // no progress possible, e.g. flushing twice
+    break;
+  case Z_STREAM_END:
+    deflateReset(&deflateStream_);
+    return true;
+  default:
+    CHECK(false) << rc << ": " << deflateStream_.msg;
+  }
+
+  switch (flushOp) {
+  case FlushOp::NONE:
+    return input.empty();
+  case FlushOp::FLUSH:
+    // Flushed unless deflate() ran out of output space
+    return input.empty() && deflateStream_.avail_out != 0;
+  case FlushOp::END:
+    return false;
+  }
+  return false;
+}
+
+bool ZlibCodec::doUncompressStream(ByteRange& input,
+                                   MutableByteRange& output) {
+  if (!inflateActive_) {
+    memset(&inflateStream_, 0, sizeof(inflateStream_));
+    int rc = inflateInit(&inflateStream_);
+    if (rc != Z_OK) {
+      throw std::runtime_error(to<std::string>(
+          "ZlibCodec: inflateInit error: ", rc, ": ", inflateStream_.msg));
+    }
+    inflateActive_ = true;
+  }
+
+  setZlibStream(&inflateStream_, input, output);
+  int rc = inflate(&inflateStream_, Z_NO_FLUSH);
+  advanceZlibStream(&inflateStream_, input, output);
+
+  switch (rc) {
+  case Z_OK:
+  case Z_BUF_ERROR:  // no progress possible, needs more input
+    return false;
+  case Z_STREAM_END:
+    inflateReset(&inflateStream_);
+    return true;
+  case Z_NEED_DICT:
+  case Z_DATA_ERROR:
+  case Z_MEM_ERROR:
+    throw std::runtime_error(to<std::string>(
+        "ZlibCodec: inflate error: ", rc, ": ", inflateStream_.msg));
+  default:
+    CHECK(false) << rc << ": " << inflateStream_.msg;
+  }
+  return false;
+}
+
 #endif  // FOLLY_HAVE_LIBZ
 
 #if FOLLY_HAVE_LIBLZMA
@@ -688,6 +1210,7 @@ class LZMA2Codec FOLLY_FINAL : public Codec {
  public:
   static std::unique_ptr<Codec> create(int level, CodecType type);
   explicit LZMA2Codec(int level, CodecType type);
+  ~LZMA2Codec();
 
  private:
   bool doNeedsUncompressedLength() const FOLLY_OVERRIDE;
@@ -700,10 +1223,25 @@ class LZMA2Codec FOLLY_FINAL : public Codec {
       const IOBuf* data,
       uint64_t uncompressedLength) FOLLY_OVERRIDE;
 
+  // The varint size prefix can't be streamed, so LZMA2 streams only
+  bool doSupportsStreaming() const FOLLY_OVERRIDE;
+  void doResetStream() FOLLY_OVERRIDE;
+  bool doCompressStream(ByteRange& input,
+                        MutableByteRange& output,
+                        FlushOp flushOp) FOLLY_OVERRIDE;
+  bool doUncompressStream(ByteRange& input,
+                          MutableByteRange& output) FOLLY_OVERRIDE;
+
   std::unique_ptr<IOBuf> addOutputBuffer(lzma_stream* stream, size_t length);
   bool doInflate(lzma_stream* stream, IOBuf* head, size_t bufferLength);
 
   int level_;
+
+  // Streaming state, initialized on first use
+  lzma_stream encodeStream_ = LZMA_STREAM_INIT;
+  lzma_stream decodeStream_ = LZMA_STREAM_INIT;
+  bool encodeActive_{false};
+  bool decodeActive_{false};
 };
 
 std::unique_ptr<Codec> LZMA2Codec::create(int level, CodecType type) {
@@ -730,6 +1268,10 @@ LZMA2Codec::LZMA2Codec(int level, CodecType type) : Codec(type) {
   level_ = level;
 }
 
+LZMA2Codec::~LZMA2Codec() {
+  doResetStream();
+}
+
 bool LZMA2Codec::doNeedsUncompressedLength() const {
   return !encodeSize();
 }
@@ -917,8 +1459,443 @@ std::unique_ptr<IOBuf> LZMA2Codec::doUncompress(const IOBuf* data,
   return out;
 }
 
+bool LZMA2Codec::doSupportsStreaming() const {
+  return !encodeSize();
+}
+
+void LZMA2Codec::doResetStream() {
+  if (encodeActive_) {
+    lzma_end(&encodeStream_);
+    encodeActive_ = false;
+  }
+  if (decodeActive_) {
+    lzma_end(&decodeStream_);
+    decodeActive_ = false;
+  }
+}
+
+namespace {
+
+lzma_ret codeLzmaStream(lzma_stream* stream,
+                        ByteRange& input,
+                        MutableByteRange& output,
+                        lzma_action action) {
+  stream->next_in = input.data();
+  stream->avail_in = input.size();
+  stream->next_out = output.data();
+  stream->avail_out = output.size();
+  lzma_ret rc = lzma_code(stream, action);
+  input.advance(stream->next_in - input.data());
+  output.advance(stream->next_out - output.data());
+  return rc;
+}
+
+}  // namespace
+
+bool LZMA2Codec::doCompressStream(ByteRange& input,
+                                  MutableByteRange& output,
+                                  FlushOp flushOp) {
+  if (!encodeActive_) {
+    encodeStream_ = LZMA_STREAM_INIT;
+    lzma_ret rc = lzma_easy_encoder(&encodeStream_, level_, LZMA_CHECK_NONE);
+    if (rc != LZMA_OK) {
+      throw std::runtime_error(folly::to<std::string>(
+        "LZMA2Codec: lzma_easy_encoder error: ", rc));
+    }
+    encodeActive_ = true;
+  }
+
+  lzma_action action = LZMA_RUN;
+  switch (flushOp) {
+  case FlushOp::NONE:
+    break;
+  case FlushOp::FLUSH:
+    action = LZMA_SYNC_FLUSH;
+    break;
+  case FlushOp::END:
+    action = LZMA_FINISH;
+    break;
+  }
+
+  lzma_ret rc = codeLzmaStream(&encodeStream_, input, output, action);
+
+  switch (rc) {
+  case LZMA_OK:
+  case LZMA_BUF_ERROR:  // no progress possible
+    return flushOp == FlushOp::NONE && input.empty();
+  case LZMA_STREAM_END:
+    // Returned once the flush or the end is done
+    if (flushOp == FlushOp::END) {
+      lzma_end(&encodeStream_);
+      encodeActive_ = false;
+    }
+    return true;
+  default:
+    throw std::runtime_error(folly::to<std::string>(
+      "LZMA2Codec: lzma_code error: ", rc));
+  }
+}
+
+bool LZMA2Codec::doUncompressStream(ByteRange& input,
+                                    MutableByteRange& output) {
+  if (!decodeActive_) {
+    decodeStream_ = LZMA_STREAM_INIT;
+    lzma_ret rc = lzma_auto_decoder(&decodeStream_,
+                                    std::numeric_limits<uint64_t>::max(), 0);
+    if (rc != LZMA_OK) {
+      throw std::runtime_error(folly::to<std::string>(
+        "LZMA2Codec: lzma_auto_decoder error: ", rc));
+    }
+    decodeActive_ = true;
+  }
+
+  lzma_ret rc = codeLzmaStream(&decodeStream_, input, output, LZMA_RUN);
+
+  switch (rc) {
+  case LZMA_OK:
+  case LZMA_BUF_ERROR:  // no progress possible, needs more input
+    return false;
+  case LZMA_STREAM_END:
+    lzma_end(&decodeStream_);
+    decodeActive_ = false;
+    return true;
+  default:
+    throw std::runtime_error(to<std::string>(
+        "LZMA2Codec: lzma_code error: ", rc));
+  }
+}
+
 #endif  // FOLLY_HAVE_LIBLZMA
 
+#if FOLLY_HAVE_LIBZSTD
+
+/**
+ * Zstandard compression
+ */
+class ZstdCodec FOLLY_FINAL : public Codec {
+ public:
+  static std::unique_ptr<Codec> create(int level, CodecType type);
+  explicit ZstdCodec(int level,
+                     CodecType type,
+                     ByteRange dictionary = ByteRange());
+  ~ZstdCodec();
+
+ private:
+  std::unique_ptr<IOBuf> doCompress(const IOBuf* data) FOLLY_OVERRIDE;
+  std::unique_ptr<IOBuf> doUncompress(
+      const IOBuf* data,
+      uint64_t uncompressedLength) FOLLY_OVERRIDE;
+
+  bool doSupportsStreaming() const FOLLY_OVERRIDE;
+  void doResetStream() FOLLY_OVERRIDE;
+  bool doCompressStream(ByteRange& input,
+                        MutableByteRange& output,
+                        FlushOp flushOp) FOLLY_OVERRIDE;
+  bool doUncompressStream(ByteRange& input,
+                          MutableByteRange& output) FOLLY_OVERRIDE;
+
+  struct Deleter {
+    void operator()(ZSTD_CCtx* p) const { ZSTD_freeCCtx(p); }
+    void operator()(ZSTD_DCtx* p) const { ZSTD_freeDCtx(p); }
+    void operator()(ZSTD_CDict* p) const { ZSTD_freeCDict(p); }
+    void operator()(ZSTD_DDict* p) const { ZSTD_freeDDict(p); }
+  };
+  typedef std::unique_ptr<ZSTD_CCtx, Deleter> CCtxPtr;
+  typedef std::unique_ptr<ZSTD_DCtx, Deleter> DCtxPtr;
+
+  // Contexts are created on first use, and reused across calls
+  ZSTD_CCtx* getCCtx(CCtxPtr& cctx);
+  ZSTD_DCtx* getDCtx(DCtxPtr& dctx);
+
+  // One-shot calls take the cached context, or a new one if another
+  // thread has it, and put it back if the cache is still empty
+  CCtxPtr acquireCCtx();
+  DCtxPtr acquireDCtx();
+  void releaseCCtx(CCtxPtr cctx);
+  void releaseDCtx(DCtxPtr dctx);
+
+  int level_;
+  std::unique_ptr<ZSTD_CDict, Deleter> cdict_;
+  std::unique_ptr<ZSTD_DDict, Deleter> ddict_;
+  std::atomic<ZSTD_CCtx*> cctx_{nullptr};
+  std::atomic<ZSTD_DCtx*> dctx_{nullptr};
+  // Streams have their own contexts, not to mix with one-shot calls
+  CCtxPtr cstream_;
+  DCtxPtr dstream_;
+  bool cstreamActive_{false};
+  bool dstreamActive_{false};
+};
+
+namespace {
+
+size_t checkZstd(size_t code, const char* what) {
+  if (ZSTD_isError(code)) {
+    throw std::runtime_error(to<std::string>(
+        "ZstdCodec: ", what, " error: ", ZSTD_getErrorName(code)));
+  }
+  return code;
+}
+
+// Returns the bytes left to flush, as ZSTD_compressStream2() does
+size_t compressZstdRange(ZSTD_CCtx* cctx,
+                         ByteRange& input,
+                         MutableByteRange& output,
+                         ZSTD_EndDirective op) {
+  ZSTD_inBuffer in = { input.data(), input.size(), 0 };
+  ZSTD_outBuffer out = { output.data(), output.size(), 0 };
+  size_t rc = checkZstd(ZSTD_compressStream2(cctx, &out, &in, op),
+                        "ZSTD_compressStream2");
+  input.advance(in.pos);
+  output.advance(out.pos);
+  return rc;
+}
+
+// Returns true at the end of the frame
+bool decompressZstdRange(ZSTD_DCtx* dctx,
+                         ByteRange& input,
+                         MutableByteRange& output) {
+  ZSTD_inBuffer in = { input.data(), input.size(), 0 };
+  ZSTD_outBuffer out = { output.data(), output.size(), 0 };
+  size_t rc = checkZstd(ZSTD_decompressStream(dctx, &out, &in),
+                        "ZSTD_decompressStream");
+  input.advance(in.pos);
+  output.advance(out.pos);
+  return rc == 0;
+}
+
+}  // namespace
+
+std::unique_ptr<Codec> ZstdCodec::create(int level, CodecType type) {
+  return make_unique<ZstdCodec>(level, type);
+}
+
+ZstdCodec::ZstdCodec(int level, CodecType type, ByteRange dictionary)
+  : Codec(type) {
+  DCHECK(type == CodecType::ZSTD);
+  switch (level) {
+  case COMPRESSION_LEVEL_FASTEST:
+    level = 1;
+    break;
+  case COMPRESSION_LEVEL_DEFAULT:
+    level = 3;
+    break;
+  case COMPRESSION_LEVEL_BEST:
+    level = 19;
+    break;
+  }
+  if (level < 1 || level > ZSTD_maxCLevel()) {
+    throw std::invalid_argument(to<std::string>(
+        "ZstdCodec: invalid level: ", level));
+  }
+  level_ = level;
+
+  if (!dictionary.empty()) {
+    cdict_.reset(ZSTD_createCDict(dictionary.data(), dictionary.size(),
+                                  level_));
+    ddict_.reset(ZSTD_createDDict(dictionary.data(), dictionary.size()));
+    if (!cdict_ || !ddict_) {
+      throw std::runtime_error("ZstdCodec: invalid dictionary");
+    }
+  }
+}
+
+ZstdCodec::~ZstdCodec() {
+  ZSTD_freeCCtx(cctx_.load());
+  ZSTD_freeDCtx(dctx_.load());
+}
+
+ZSTD_CCtx* ZstdCodec::getCCtx(CCtxPtr& cctx) {
+  if (!cctx) {
+    cctx.reset(ZSTD_createCCtx());
+    if (!cctx) {
+      throw std::bad_alloc();
+    }
+    checkZstd(ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_compressionLevel,
+                                     level_),
+              "ZSTD_CCtx_setParameter");
+    if (cdict_) {
+      checkZstd(ZSTD_CCtx_refCDict(cctx.get(), cdict_.get()),
+                "ZSTD_CCtx_refCDict");
+    }
+  } else {
+    // Drop whatever a failed call left, keeping the parameters
+    ZSTD_CCtx_reset(cctx.get(), ZSTD_reset_session_only);
+  }
+  return cctx.get();
+}
+
+ZSTD_DCtx* ZstdCodec::getDCtx(DCtxPtr& dctx) {
+  if (!dctx) {
+    dctx.reset(ZSTD_createDCtx());
+    if (!dctx) {
+      throw std::bad_alloc();
+    }
+    if (ddict_) {
+      checkZstd(ZSTD_DCtx_refDDict(dctx.get(), ddict_.get()),
+                "ZSTD_DCtx_refDDict");
+    }
+  } else {
+    ZSTD_DCtx_reset(dctx.get(), ZSTD_reset_session_only);
+  }
+  return dctx.get();
+}
+
+ZstdCodec::CCtxPtr ZstdCodec::acquireCCtx() {
+  CCtxPtr cctx(cctx_.exchange(nullptr));
+  getCCtx(cctx);
+  return cctx;
+}
+
+ZstdCodec::DCtxPtr ZstdCodec::acquireDCtx() {
+  DCtxPtr dctx(dctx_.exchange(nullptr));
+  getDCtx(dctx);
+  return dctx;
+}
+
+void ZstdCodec::releaseCCtx(CCtxPtr cctx) {
+  ZSTD_CCtx* expected = nullptr;
+  if (cctx_.compare_exchange_strong(expected, cctx.get())) {
+    cctx.release();
+  }
+}
+
+void ZstdCodec::releaseDCtx(DCtxPtr dctx) {
+  ZSTD_DCtx* expected = nullptr;
+  if (dctx_.compare_exchange_strong(expected, dctx.get())) {
+    dctx.release();
+  }
+}
+
+std::unique_ptr<IOBuf> ZstdCodec::doCompress(const IOBuf* data) {
+  auto cctxPtr = acquireCCtx();
+  SCOPE_EXIT { releaseCCtx(std::move(cctxPtr)); };
+  auto cctx = cctxPtr.get();
+  uint64_t length = data->computeChainDataLength();
+  auto out = IOBuf::create(ZSTD_compressBound(length));
+
+  if (!data->isChained()) {
+    size_t n = checkZstd(
+        ZSTD_compress2(cctx, out->writableTail(), out->tailroom(),
+                       data->data(), data->length()),
+        "ZSTD_compress2");
+    out->append(n);
+    return out;
+  }
+
+  // Compress the chain in place, recording the length in the frame
+  checkZstd(ZSTD_CCtx_setPledgedSrcSize(cctx, length),
+            "ZSTD_CCtx_setPledgedSrcSize");
+  MutableByteRange o(out->writableTail(), out->tailroom());
+  for (auto& range : *data) {
+    ByteRange in(range);
+    while (!in.empty()) {
+      compressZstdRange(cctx, in, o, ZSTD_e_continue);
+    }
+  }
+  ByteRange in;
+  // The output is large enough to end the frame at once
+  CHECK_EQ(compressZstdRange(cctx, in, o, ZSTD_e_end), 0);
+  out->append(out->tailroom() - o.size());
+  return out;
+}
+
+std::unique_ptr<IOBuf> ZstdCodec::doUncompress(const IOBuf* data,
+                                               uint64_t uncompressedLength) {
+  // Above this, the length recorded in a frame is not trusted to allocate
+  // the output at once: it may be forged
+  constexpr uint64_t maxFrameLength = uint64_t(64) << 20;    // 64MiB
+
+  if (uncompressedLength == UNKNOWN_UNCOMPRESSED_LENGTH) {
+    // Frames made by compress() record it
+    auto frameLength = ZSTD_getFrameContentSize(data->data(), data->length());
+    if (frameLength != ZSTD_CONTENTSIZE_UNKNOWN &&
+        frameLength != ZSTD_CONTENTSIZE_ERROR &&
+        frameLength <= maxFrameLength) {
+      uncompressedLength = frameLength;
+    }
+  }
+
+  auto dctxPtr = acquireDCtx();
+  SCOPE_EXIT { releaseDCtx(std::move(dctxPtr)); };
+  auto dctx = dctxPtr.get();
+  if (!data->isChained() &&
+      uncompressedLength != UNKNOWN_UNCOMPRESSED_LENGTH) {
+    // All in one go, saving the copies through the stream buffers
+    auto out = IOBuf::create(uncompressedLength);
+    size_t n = checkZstd(
+        ZSTD_decompressDCtx(dctx, out->writableTail(), out->tailroom(),
+                            data->data(), data->length()),
+        "ZSTD_decompressDCtx");
+    if (n != uncompressedLength) {
+      throw std::runtime_error("ZstdCodec: invalid uncompressed length");
+    }
+    out->append(n);
+    return out;
+  }
+  return uncompressRanges(
+      "ZstdCodec", data, uncompressedLength,
+      [dctx] (ByteRange& input, MutableByteRange& output) {
+        return decompressZstdRange(dctx, input, output);
+      });
+}
+
+bool ZstdCodec::doSupportsStreaming() const {
+  return true;
+}
+
+void ZstdCodec::doResetStream() {
+  cstreamActive_ = false;
+  dstreamActive_ = false;
+}
+
+bool ZstdCodec::doCompressStream(ByteRange& input,
+                                 MutableByteRange& output,
+                                 FlushOp flushOp) {
+  if (!cstreamActive_) {
+    getCCtx(cstream_);
+    cstreamActive_ = true;
+  }
+
+  ZSTD_EndDirective op = ZSTD_e_continue;
+  switch (flushOp) {
+  case FlushOp::NONE:
+    break;
+  case FlushOp::FLUSH:
+    op = ZSTD_e_flush;
+    break;
+  case FlushOp::END:
+    op = ZSTD_e_end;
+    break;
+  }
+
+  size_t pending = compressZstdRange(cstream_.get(), input, output, op);
+  if (flushOp == FlushOp::NONE) {
+    return input.empty();
+  }
+  if (!input.empty() || pending != 0) {
+    return false;
+  }
+  if (flushOp == FlushOp::END) {
+    cstreamActive_ = false;
+  }
+  return true;
+}
+
+bool ZstdCodec::doUncompressStream(ByteRange& input,
+                                   MutableByteRange& output) {
+  if (!dstreamActive_) {
+    getDCtx(dstream_);
+    dstreamActive_ = true;
+  }
+  if (decompressZstdRange(dstream_.get(), input, output)) {
+    dstreamActive_ = false;
+    return true;
+  }
+  return false;
+}
+
+#endif  // FOLLY_HAVE_LIBZSTD
+
 }  // namespace
 
 std::unique_ptr<Codec> getCodec(CodecType type, int level) {
@@ -960,6 +1937,18 @@ std::unique_ptr<Codec> getCodec(CodecType type, int level) {
     nullptr,
     nullptr,
 #endif
+
+#if FOLLY_HAVE_LIBLZ4
+    LZ4FrameCodec::create,
+#else
+    nullptr,
+#endif
+
+#if FOLLY_HAVE_LIBZSTD
+    ZstdCodec::create,
+#else
+    nullptr,
+#endif
   };
 
   size_t idx = static_cast<size_t>(type);
@@ -977,4 +1966,58 @@ std::unique_ptr<Codec> getCodec(CodecType type, int level) {
   return codec;
 }
 
+std::unique_ptr<Codec> getCodec(CodecType type,
+                                int level,
+                                ByteRange dictionary) {
+  if (dictionary.empty()) {
+    return getCodec(type, level);
+  }
+#if FOLLY_HAVE_LIBZSTD
+  if (type == CodecType::ZSTD) {
+    return make_unique<ZstdCodec>(level, type, dictionary);
+  }
+#endif
+  throw std::invalid_argument(to<std::string>(
+      "Compression type ", static_cast<size_t>(type),
+      " doesn't support dictionaries"));
+}
+
+std::unique_ptr<IOBuf> trainDictionary(
+    CodecType type,
+    const std::vector<const IOBuf*>& samples,
+    uint64_t maxLength) {
+#if FOLLY_HAVE_LIBZSTD
+  if (type == CodecType::ZSTD) {
+    // ZDICT_trainFromBuffer() wants the samples back to back
+    std::vector<size_t> lengths;
+    lengths.reserve(samples.size());
+    IOBufQueue queue(IOBufQueue::cacheChainLength());
+    for (auto sample : samples) {
+      lengths.push_back(sample->computeChainDataLength());
+      queue.append(sample->clone());
+    }
+    auto all = queue.move();
+    if (!all) {
+      throw std::runtime_error("trainDictionary: no samples");
+    }
+    all->coalesce();
+
+    auto dictionary = IOBuf::create(maxLength);
+    size_t n = ZDICT_trainFromBuffer(dictionary->writableData(), maxLength,
+                                     all->data(), lengths.data(),
+                                     lengths.size());
+    if (ZDICT_isError(n)) {
+      throw std::runtime_error(to<std::string>(
+          "trainDictionary: ZDICT_trainFromBuffer error: ",
+          ZDICT_getErrorName(n)));
+    }
+    dictionary->append(n);
+    return dictionary;
+  }
+#endif
+  throw std::invalid_argument(to<std::string>(
+      "Compression type ", static_cast<size_t>(type),
+      " doesn't support dictionaries"));
+}
+
 }}  // namespaces
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <folly/io/IOBuf.h>
 
@@ -27,7 +28,11 @@
  * Compression / decompression over IOBufs
  */
 
-namespace folly { namespace io {
+namespace folly {
+
+class IOBufQueue;
+
+namespace io {
 
 enum class CodecType {
   /**
@@ -73,9 +78,48 @@ enum class CodecType {
   LZMA2 = 6,
   LZMA2_VARINT_SIZE = 7,
 
-  NUM_CODEC_TYPES = 8,
+  /**
+   * Use the LZ4 frame format, which supports streaming.
+   * Levels supported: 0 .. 2 = fast, 3 .. 16 = high compression;
+   * default = 0
+   */
+  LZ4_FRAME = 8,
+
+  /**
+   * Use Zstandard compression, which supports streaming and dictionaries.
+   * Levels supported: 1 = fast, ..., 19 = best, up to ZSTD_maxCLevel();
+   * default = 3
+   */
+  ZSTD = 9,
+
+  NUM_CODEC_TYPES = 10,
 };
 
+/**
+ * What a streaming compression call does after consuming its input.
+ */
+enum class FlushOp {
+  /**
+   * Nothing: the codec may keep some of the input buffered.
+   */
+  NONE,
+  /**
+   * Emit all the input consumed so far, so that the output can be
+   * uncompressed up to here.  Flushing often hurts compression.
+   */
+  FLUSH,
+  /**
+   * Emit all the input and finish the stream.  The next call starts
+   * a new stream.
+   */
+  END,
+};
+
+/**
+ * compress() and uncompress() may be called concurrently on one codec.
+ * A stream (compressStream(), uncompressStream() and resetStream()) is
+ * used by one thread at a time.
+ */
 class Codec {
  public:
   virtual ~Codec() { }
@@ -127,6 +171,43 @@ class Codec {
       const IOBuf* data,
       uint64_t uncompressedLength = UNKNOWN_UNCOMPRESSED_LENGTH);
 
+  /**
+   * Does this codec support compressStream() and uncompressStream()?
+   * ZLIB, LZMA2, LZ4_FRAME and ZSTD do.
+   */
+  bool supportsStreaming() const;
+
+  /**
+   * Compress a stream incrementally: consume all of input, appending the
+   * compressed data to output, then flush or end the stream as requested
+   * by flushOp.  The memory held by the codec is bounded, whatever the
+   * length of the stream.  Throws std::invalid_argument if the codec
+   * doesn't support streaming.
+   *
+   * The stream is compatible with uncompress(), once ended.
+   */
+  void compressStream(IOBufQueue& input,
+                      IOBufQueue& output,
+                      FlushOp flushOp = FlushOp::NONE);
+
+  /**
+   * Uncompress a stream incrementally: consume input, appending the
+   * uncompressed data to output.  Returns true if the end of the stream
+   * was reached, leaving any bytes after it in input; the next call
+   * starts a new stream.  Throws std::runtime_error on decompression
+   * error, or if flushOp is FlushOp::END (input is all there is) and the
+   * stream is truncated.
+   */
+  bool uncompressStream(IOBufQueue& input,
+                        IOBufQueue& output,
+                        FlushOp flushOp = FlushOp::NONE);
+
+  /**
+   * Abandon the streams in progress, if any.  Required to reuse the codec
+   * after compressStream() or uncompressStream() threw.
+   */
+  void resetStream();
+
  protected:
   explicit Codec(CodecType type);
 
@@ -139,6 +220,20 @@ class Codec {
   virtual std::unique_ptr<IOBuf> doUncompress(const folly::IOBuf* data,
                                               uint64_t uncompressedLength) = 0;
 
+  // default: no streaming
+  virtual bool doSupportsStreaming() const;
+  // Output space the stream functions need to make progress; default: 1
+  virtual uint64_t doMinStreamOutputLength() const;
+  virtual void doResetStream();
+  // Consume input and fill output, returning true once input is consumed
+  // and flushOp is done, or false if more output space is needed.
+  virtual bool doCompressStream(ByteRange& input,
+                                MutableByteRange& output,
+                                FlushOp flushOp);
+  // Consume input and fill output, returning true at the end of stream.
+  virtual bool doUncompressStream(ByteRange& input,
+                                  MutableByteRange& output);
+
   CodecType type_;
 };
 
@@ -165,6 +260,33 @@ constexpr int COMPRESSION_LEVEL_BEST = -3;
 std::unique_ptr<Codec> getCodec(CodecType type,
                                 int level = COMPRESSION_LEVEL_DEFAULT);
 
+/**
+ * Return a codec for the given type which compresses with a dictionary,
+ * such as one made by trainDictionary().  Data compressed with it can only
+ * be uncompressed by a codec with the same dictionary.  The dictionary is
+ * copied and digested once, and the codec reuses it, as well as its
+ * compression contexts, across calls.  Only ZSTD supports dictionaries;
+ * throws std::invalid_argument for the other types.
+ */
+std::unique_ptr<Codec> getCodec(CodecType type,
+                                int level,
+                                ByteRange dictionary);
+
+constexpr uint64_t DEFAULT_DICTIONARY_LENGTH = uint64_t(110) << 10;
+
+/**
+ * Train a dictionary of at most maxLength bytes for the given codec type
+ * from samples of the data to compress.  Dictionaries pay off on small
+ * and similar pieces of data, such as RPC payloads; a few thousand samples
+ * make a good dictionary.  Only ZSTD supports dictionaries; throws
+ * std::invalid_argument for the other types, and std::runtime_error if
+ * training fails, e.g. with too few samples.
+ */
+std::unique_ptr<IOBuf> trainDictionary(
+    CodecType type,
+    const std::vector<const IOBuf*>& samples,
+    uint64_t maxLength = DEFAULT_DICTIONARY_LENGTH);
+
 }}  // namespaces
 
 #endif /* FOLLY_IO_COMPRESSION_H_ */
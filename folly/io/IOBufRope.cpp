@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/io/IOBufRope.h>
+
+namespace folly {
+
+const size_t IOBufRope::kInitialSegmentSize;
+const size_t IOBufRope::kMaxSegmentSize;
+
+IOBufRope::IOBufRope(IOBufRope&& other) noexcept
+  : head_(std::move(other.head_)),
+    tail_(other.tail_),
+    tailroom_(other.tailroom_),
+    size_(other.size_),
+    headroom_(other.headroom_),
+    nextSegmentSize_(other.nextSegmentSize_) {
+  other.clear();
+}
+
+IOBufRope& IOBufRope::operator=(IOBufRope&& other) noexcept {
+  if (this != &other) {
+    head_ = std::move(other.head_);
+    tail_ = other.tail_;
+    tailroom_ = other.tailroom_;
+    size_ = other.size_;
+    headroom_ = other.headroom_;
+    nextSegmentSize_ = other.nextSegmentSize_;
+    other.clear();
+  }
+  return *this;
+}
+
+void IOBufRope::appendSlow(const char* data, size_t n) {
+  // Fill up the current segment first, so segments stay dense
+  size_t len = std::min(n, tailroom_);
+  if (len != 0) {
+    memcpy(tail_->writableTail(), data, len);
+    tail_->append(len);
+    tailroom_ -= len;
+    size_ += len;
+    data += len;
+    n -= len;
+  }
+  allocateSegment(n);
+  memcpy(tail_->writableTail(), data, n);
+  tail_->append(n);
+  tailroom_ -= n;
+  size_ += n;
+}
+
+void IOBufRope::allocateSegment(size_t n) {
+  size_t headroom = head_ ? 0 : headroom_;
+  auto buf = IOBuf::create(headroom + std::max(n, nextSegmentSize_));
+  buf->advance(headroom);
+  nextSegmentSize_ = std::min(2 * nextSegmentSize_, kMaxSegmentSize);
+  tail_ = buf.get();
+  tailroom_ = buf->tailroom();
+  if (head_) {
+    head_->prependChain(std::move(buf));
+  } else {
+    head_ = std::move(buf);
+  }
+}
+
+void IOBufRope::append(std::unique_ptr<IOBuf>&& buf) {
+  if (!buf) {
+    return;
+  }
+  size_ += buf->computeChainDataLength();
+  if (head_) {
+    head_->prependChain(std::move(buf));
+  } else {
+    head_ = std::move(buf);
+  }
+  tail_ = head_->prev();
+  tailroom_ = tail_->isSharedOne() ? 0 : tail_->tailroom();
+}
+
+void IOBufRope::prepend(const char* data, size_t n) {
+  if (!head_) {
+    append(data, n);
+    return;
+  }
+  if (head_->headroom() >= n && !head_->isSharedOne()) {
+    head_->prepend(n);
+    memcpy(head_->writableData(), data, n);
+  } else {
+    auto buf = IOBuf::create(n);
+    memcpy(buf->writableData(), data, n);
+    buf->append(n);
+    buf->appendChain(std::move(head_));
+    head_ = std::move(buf);
+  }
+  size_ += n;
+}
+
+void IOBufRope::reserve(size_t n) {
+  if (n > capacity()) {
+    allocateSegment(std::min(n - size_, kMaxSegmentSize));
+  }
+}
+
+void IOBufRope::clear() {
+  head_.reset();
+  tail_ = nullptr;
+  tailroom_ = 0;
+  size_ = 0;
+  nextSegmentSize_ = kInitialSegmentSize;
+}
+
+std::unique_ptr<IOBuf> IOBufRope::move() {
+  auto head = std::move(head_);
+  clear();
+  return head;
+}
+
+std::string IOBufRope::toString() const {
+  std::string s;
+  s.reserve(size_);
+  appendTo(&s, size_);
+  return s;
+}
+
+} // namespace folly
@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOLLY_IO_IOBUFROPE_H_
+#define FOLLY_IO_IOBUFROPE_H_
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <folly/Conv.h>
+#include <folly/Likely.h>
+#include <folly/Range.h>
+#include <folly/io/IOBuf.h>
+
+namespace folly {
+
+/**
+ * An IOBufRope is a string builder for large text, which appends into a
+ * chain of IOBufs instead of one contiguous buffer.  Segments grow
+ * geometrically, and bytes once written are never copied again, so
+ * assembling a multi-megabyte response costs a single memcpy of each
+ * byte, and the result is handed off with move() as an IOBuf chain, ready
+ * for AsyncSocket::writeChain().
+ *
+ * IOBufRope has the append interface of std::string used by toAppend()
+ * and format(), so it can be their target:
+ *
+ *   IOBufRope rope(64);
+ *   format(&rope, "<p>{}</p>", text);
+ *   toAppend(42, ',', 43, &rope);
+ *   rope.prepend(to<std::string>("Content-Length: ", rope.size(), "\r\n"));
+ *   socket->writeChain(callback, rope.move());
+ *
+ * Bytes can be prepended cheaply into the headroom reserved in front of
+ * the first segment, or else into a new segment chained at the front.
+ */
+class IOBufRope {
+public:
+  static const size_t kInitialSegmentSize = 4096;
+  static const size_t kMaxSegmentSize = 1 << 20;
+
+  /**
+   * Create an empty rope, reserving headroom bytes in front of the first
+   * segment for prepend().
+   */
+  explicit IOBufRope(size_t headroom = 0) : headroom_(headroom) {}
+
+  IOBufRope(const IOBufRope&) = delete;
+  IOBufRope& operator=(const IOBufRope&) = delete;
+
+  IOBufRope(IOBufRope&& other) noexcept;
+  IOBufRope& operator=(IOBufRope&& other) noexcept;
+
+  /**
+   * Copy n bytes to the end of the rope.
+   */
+  void append(const char* data, size_t n) {
+    if (LIKELY(n <= tailroom_)) {
+      memcpy(tail_->writableTail(), data, n);
+      tail_->append(n);
+      tailroom_ -= n;
+      size_ += n;
+    } else {
+      appendSlow(data, n);
+    }
+  }
+
+  void append(const char* begin, const char* end) {
+    append(begin, end - begin);
+  }
+
+  void append(const char* s) {
+    append(s, strlen(s));
+  }
+
+  void append(StringPiece sp) {
+    append(sp.data(), sp.size());
+  }
+
+  void push_back(char c) {
+    if (LIKELY(tailroom_ != 0)) {
+      *tail_->writableTail() = c;
+      tail_->append(1);
+      --tailroom_;
+      ++size_;
+    } else {
+      appendSlow(&c, 1);
+    }
+  }
+
+  IOBufRope& operator+=(char c) {
+    push_back(c);
+    return *this;
+  }
+
+  IOBufRope& operator+=(StringPiece sp) {
+    append(sp);
+    return *this;
+  }
+
+  /**
+   * Chain buf (and the rest of its chain) to the end of the rope without
+   * copying it.  The rope takes ownership of buf, and doesn't write into
+   * its tailroom if it is shared.
+   */
+  void append(std::unique_ptr<IOBuf>&& buf);
+
+  /**
+   * Copy n bytes to the beginning of the rope.
+   */
+  void prepend(const char* data, size_t n);
+
+  void prepend(StringPiece sp) {
+    prepend(sp.data(), sp.size());
+  }
+
+  /**
+   * Total number of bytes in the rope.
+   */
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  /**
+   * Bytes which can be appended without allocating a new segment, plus
+   * size().
+   */
+  size_t capacity() const {
+    return size_ + tailroom_;
+  }
+
+  /**
+   * Make room to append up to n - size() contiguous bytes without further
+   * allocation.  It's only a hint: a request beyond kMaxSegmentSize
+   * allocates kMaxSegmentSize bytes, leaving the rest to later appends.
+   */
+  void reserve(size_t n);
+
+  /**
+   * Remove all the bytes, releasing the segments.
+   */
+  void clear();
+
+  /**
+   * The IOBuf chain, or nullptr if nothing was written.
+   */
+  const IOBuf* front() const {
+    return head_.get();
+  }
+
+  /**
+   * Transfer ownership of the IOBuf chain to the caller, leaving the rope
+   * empty.
+   */
+  std::unique_ptr<IOBuf> move();
+
+  /**
+   * Copy the rope contents to a std::string.
+   */
+  std::string toString() const;
+
+  /**
+   * Copy the first n bytes of the rope to the end of result.
+   */
+  template <class Tgt>
+  void appendTo(Tgt* result, size_t n) const;
+
+private:
+  void appendSlow(const char* data, size_t n);
+  void allocateSegment(size_t n);
+
+  std::unique_ptr<IOBuf> head_;
+  IOBuf* tail_{nullptr};
+  size_t tailroom_{0};
+  size_t size_{0};
+  size_t headroom_;
+  size_t nextSegmentSize_{kInitialSegmentSize};
+};
+
+template <class Tgt>
+void IOBufRope::appendTo(Tgt* result, size_t n) const {
+  if (!head_) {
+    return;
+  }
+  // Stop after n bytes, which keeps appending a rope to itself finite
+  for (auto range : *head_) {
+    size_t len = std::min(n, size_t(range.size()));
+    result->append(reinterpret_cast<const char*>(range.data()), len);
+    n -= len;
+    if (n == 0) {
+      break;
+    }
+  }
+}
+
+/**
+ * IOBufRope is a target of toAppend() and format().
+ */
+template <> struct IsSomeString<IOBufRope> {
+  enum { value = true };
+};
+
+/**
+ * A rope gets appended segment by segment.
+ */
+template <class Tgt>
+typename std::enable_if<IsSomeString<Tgt>::value>::type
+toAppend(const IOBufRope& value, Tgt* result) {
+  value.appendTo(result, value.size());
+}
+
+inline size_t estimateSpaceNeeded(const IOBufRope& value) {
+  return value.size();
+}
+
+} // namespace folly
+
+#endif /* FOLLY_IO_IOBUFROPE_H_ */
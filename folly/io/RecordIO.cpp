@@ -16,9 +16,15 @@
 
 #include <folly/io/RecordIO.h>
 
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#include <climits>
+#include <numeric>
+
 #include <folly/Exception.h>
 #include <folly/FileUtil.h>
 #include <folly/Memory.h>
@@ -69,11 +75,286 @@ void RecordIOWriter::write(std::unique_ptr<IOBuf> buf) {
   DCHECK_EQ(bytes, totalLength);
 }
 
+namespace {
+
+constexpr size_t kMaxIovecs = IOV_MAX < 1024 ? IOV_MAX : 1024;
+
+}  // namespace
+
+BatchedRecordIOWriter::BatchedRecordIOWriter(File file,
+                                             uint32_t fileId,
+                                             Options options)
+  : file_(std::move(file)),
+    fileId_(fileId),
+    options_(options),
+    writeLock_(file_, std::defer_lock),
+    filePos_(0),
+    allocatedEnd_(0) {
+  if (!writeLock_.try_lock()) {
+    throw std::runtime_error(
+        "BatchedRecordIOWriter: file locked by another process");
+  }
+
+  struct stat st;
+  checkUnixError(fstat(file_.fd(), &st), "fstat() failed");
+
+  filePos_ = st.st_size;
+  allocatedEnd_ = st.st_size;
+  thread_ = std::thread([this] { run(); });
+}
+
+BatchedRecordIOWriter::~BatchedRecordIOWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cond_.notify_one();
+  thread_.join();
+}
+
+Future<off_t> BatchedRecordIOWriter::write(std::unique_ptr<IOBuf> buf) {
+  size_t totalLength = prependHeader(buf, fileId_);
+  if (totalLength == 0) {
+    return makeFuture(off_t(-1));  // nothing to do
+  }
+
+  // A record must fit in a single pwritev() call
+  if (buf->countChainElements() > kMaxIovecs) {
+    buf->coalesce();
+  }
+
+  Record record;
+  record.buf = std::move(buf);
+  record.length = totalLength;
+  auto future = record.promise.getFuture();
+  bool wasEmpty;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (error_) {
+      record.promise.setException(error_);
+      return future;
+    }
+    record.pos = filePos_.fetch_add(totalLength);
+    wasEmpty = queue_.empty();
+    queue_.push_back(std::move(record));
+  }
+  // The background thread only waits for an empty queue
+  if (wasEmpty) {
+    cond_.notify_one();
+  }
+  return future;
+}
+
+void BatchedRecordIOWriter::run() {
+  typedef std::chrono::steady_clock Clock;
+  Clock::time_point nextSync = Clock::now();
+  std::vector<Record> batch;
+  bool stop = false;
+  while (!stop) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto ready = [this] { return stop_ || !queue_.empty(); };
+      if (unsynced_.empty()) {
+        cond_.wait(lock, ready);
+      } else {
+        cond_.wait_until(lock, nextSync, ready);
+      }
+      // Everything queued while we were writing makes the next batch
+      batch.swap(queue_);
+      stop = stop_;
+    }
+    if (!batch.empty()) {
+      writeBatch(batch);
+    }
+    // Only SyncPolicy::INTERVAL leaves records unsynced
+    if (!unsynced_.empty() && (stop || Clock::now() >= nextSync)) {
+      sync();
+      nextSync = Clock::now() + options_.syncInterval;
+    }
+  }
+}
+
+void BatchedRecordIOWriter::writeBatch(std::vector<Record>& batch) {
+  exception_wrapper ew;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ew = error_;
+  }
+  if (!ew) {
+    ew = try_and_catch<std::exception>([&] { writeRecords(batch); });
+  }
+  if (ew) {
+    fail(ew);
+    complete(batch, ew);
+    return;
+  }
+
+  for (auto& record : batch) {
+    unsynced_.push_back(std::move(record));
+  }
+  batch.clear();
+  switch (options_.syncPolicy) {
+  case SyncPolicy::NONE:
+    complete(unsynced_, exception_wrapper());
+    break;
+  case SyncPolicy::BATCH:
+    sync();
+    break;
+  case SyncPolicy::INTERVAL:
+    break;
+  }
+}
+
+void BatchedRecordIOWriter::writeRecords(std::vector<Record>& records) {
+  fbvector<struct iovec> iov;
+  size_t i = 0;
+  while (i < records.size()) {
+    // Positions are contiguous, as records are queued in order
+    size_t first = i;
+    size_t length = 0;
+    iov.clear();
+    do {
+      records[i].buf->appendToIov(&iov);
+      length += records[i].length;
+      ++i;
+    } while (i < records.size() &&
+             iov.size() + records[i].buf->countChainElements() <= kMaxIovecs);
+
+    off_t pos = records[first].pos;
+    preallocate(pos + length);
+
+#if FOLLY_HAVE_PWRITEV
+    ssize_t bytes = pwritevFull(file_.fd(), iov.data(), iov.size(), pos);
+#else
+    ssize_t bytes = 0;
+    for (auto& v : iov) {
+      ssize_t n = pwriteFull(file_.fd(), v.iov_base, v.iov_len, pos + bytes);
+      if (n == -1) {
+        bytes = n;
+        break;
+      }
+      bytes += n;
+    }
+#endif
+
+    checkUnixError(bytes, "pwrite() failed");
+    DCHECK_EQ(bytes, length);
+    for (; first < i; ++first) {
+      records[first].buf.reset();
+    }
+  }
+}
+
+void BatchedRecordIOWriter::preallocate(off_t end) {
+  if (options_.preallocateSize <= 0 || end <= allocatedEnd_) {
+    return;
+  }
+#ifdef FALLOC_FL_KEEP_SIZE
+  off_t length = end - allocatedEnd_ + options_.preallocateSize;
+  int r = fallocate(file_.fd(), FALLOC_FL_KEEP_SIZE, allocatedEnd_, length);
+  if (r == -1 && errno == EOPNOTSUPP) {
+    options_.preallocateSize = 0;  // not supported by the file system
+    return;
+  }
+  checkUnixError(r, "fallocate() failed");
+  allocatedEnd_ += length;
+#endif
+}
+
+void BatchedRecordIOWriter::sync() {
+  auto ew = try_and_catch<std::exception>([&] {
+    checkUnixError(fdatasyncNoInt(file_.fd()), "fdatasync() failed");
+  });
+  if (ew) {
+    fail(ew);
+  } else {
+    complete(unsynced_, ew);
+  }
+}
+
+void BatchedRecordIOWriter::fail(const exception_wrapper& ew) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!error_) {
+      error_ = ew;
+    }
+  }
+  complete(unsynced_, ew);
+}
+
+void BatchedRecordIOWriter::complete(std::vector<Record>& records,
+                                     const exception_wrapper& ew) {
+  for (auto& record : records) {
+    if (ew) {
+      record.promise.setException(ew);
+    } else {
+      record.promise.setValue(record.pos);
+    }
+  }
+  records.clear();
+}
+
 RecordIOReader::RecordIOReader(File file, uint32_t fileId)
   : map_(std::move(file)),
     fileId_(fileId) {
 }
 
+constexpr size_t RecordIOReader::kDefaultScanRangeSize;
+
+Future<size_t> RecordIOReader::scan(Executor* executor,
+                                    ScanCallback callback,
+                                    size_t rangeSize,
+                                    bool prefetch) const {
+  if (rangeSize == 0) {
+    throw std::invalid_argument("RecordIOReader: invalid scan range size");
+  }
+  // Share one callback between the ranges, it may hold state
+  auto sharedCallback = std::make_shared<ScanCallback>(std::move(callback));
+  size_t fileSize = map_.range().size();
+  std::vector<Future<size_t>> ranges;
+  ranges.reserve(fileSize / rangeSize + 1);
+  for (size_t begin = 0; begin < fileSize; begin += rangeSize) {
+    size_t length = std::min(rangeSize, fileSize - begin);
+    ranges.push_back(via(executor,
+        [this, sharedCallback, begin, length, prefetch] {
+      return scanRange(*sharedCallback, begin, length, prefetch);
+    }));
+    if (length < rangeSize) {
+      break;  // don't overflow begin
+    }
+  }
+  return collect(ranges).then([] (std::vector<size_t>&& counts) {
+    return std::accumulate(counts.begin(), counts.end(), size_t(0));
+  });
+}
+
+size_t RecordIOReader::scanRange(const ScanCallback& callback,
+                                 size_t begin,
+                                 size_t length,
+                                 bool prefetch) const {
+  if (prefetch) {
+    map_.advise(MADV_WILLNEED, begin, length);
+  }
+  // Records beginning in the range may end past it
+  ByteRange wholeRange = map_.range();
+  ByteRange searchRange(wholeRange.begin() + begin, length);
+  size_t count = 0;
+  for (;;) {
+    ByteRange record = findRecord(searchRange, wholeRange, fileId_).record;
+    if (record.empty()) {
+      break;
+    }
+    const uint8_t* start = record.begin() - headerSize();
+    callback(record, start - wholeRange.begin());
+    ++count;
+    if (record.end() >= searchRange.end()) {
+      break;
+    }
+    searchRange.assign(record.end(), searchRange.end());
+  }
+  return count;
+}
+
 RecordIOReader::Iterator::Iterator(ByteRange range, uint32_t fileId, off_t pos)
   : range_(range),
     fileId_(fileId),
@@ -211,7 +492,8 @@ RecordInfo findRecord(ByteRange searchRange,
                                 wholeRange.end() - sizeof(Header));
   // end-1: the last place where a Header could start
   while (start < end) {
-    auto p = ByteRange(start, end + sizeof(magic)).find(magicRange);
+    // Only match a magic beginning before end
+    auto p = ByteRange(start, end + sizeof(magic) - 1).find(magicRange);
     if (p == ByteRange::npos) {
       break;
     }
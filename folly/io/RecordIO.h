@@ -26,12 +26,20 @@
 #define FOLLY_IO_RECORDIO_H_
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
+#include <folly/ExceptionWrapper.h>
+#include <folly/Executor.h>
 #include <folly/File.h>
 #include <folly/Range.h>
 #include <folly/MemoryMapping.h>
+#include <folly/futures/Future.h>
 #include <folly/io/IOBuf.h>
 
 namespace folly {
@@ -77,6 +85,113 @@ class RecordIOWriter {
   std::atomic<off_t> filePos_;
 };
 
+/**
+ * Class to write a stream of RecordIO records to a file from many threads
+ * with group commit, as needed by a write-ahead log.
+ *
+ * write() queues records for a background thread, which writes all the
+ * records queued since its previous write with a single pwritev() call,
+ * and syncs the file to disk (fdatasync()) as told by the sync policy.  The
+ * future returned by write() completes with the position of the record in
+ * the file once the record is durable according to that policy, or with
+ * an exception if it couldn't be written or synced, after which all writes
+ * fail.  Callbacks attached to the future run in the background thread
+ * unless they are given an executor with via().
+ *
+ * The records are the same as RecordIOWriter's; the file is locked the
+ * same way.  Records queued when the writer is destroyed are written (and
+ * synced, unless the sync policy is SyncPolicy::NONE) before the
+ * destructor returns.
+ *
+ * BatchedRecordIOWriter is thread-safe.
+ */
+class BatchedRecordIOWriter {
+ public:
+  enum class SyncPolicy {
+    NONE,      // never sync, futures complete once records are written
+    BATCH,     // sync after each batch
+    INTERVAL,  // sync at most once every syncInterval
+  };
+
+  struct Options {
+    Options() {}
+
+    // Convenience methods; return *this for chaining.
+    Options& setSyncPolicy(SyncPolicy v) { syncPolicy = v; return *this; }
+    Options& setSyncInterval(std::chrono::milliseconds v) {
+      syncInterval = v;
+      return *this;
+    }
+    Options& setPreallocateSize(off_t v) { preallocateSize = v; return *this; }
+
+    SyncPolicy syncPolicy = SyncPolicy::BATCH;
+
+    // With SyncPolicy::INTERVAL, the longest time written records wait to
+    // be synced.
+    std::chrono::milliseconds syncInterval{10};
+
+    // If non-zero, allocate disk space past the end of file in chunks of
+    // this size (fallocate(FALLOC_FL_KEEP_SIZE), where supported), so that
+    // syncs don't have to update the block allocation.  The file size
+    // isn't changed.
+    off_t preallocateSize = 0;
+  };
+
+  /**
+   * Create a BatchedRecordIOWriter around a file; will append to the end of
+   * file if it exists.  See RecordIOWriter for fileId.
+   */
+  explicit BatchedRecordIOWriter(File file,
+                                 uint32_t fileId = 1,
+                                 Options options = Options());
+
+  ~BatchedRecordIOWriter();
+
+  /**
+   * Queue a record for writing.  We will use at most headerSize() bytes of
+   * headroom.  Empty records aren't written, and complete with off_t(-1).
+   */
+  Future<off_t> write(std::unique_ptr<IOBuf> buf);
+
+  /**
+   * Return the position in the file where the next record will be written.
+   */
+  off_t filePos() const { return filePos_; }
+
+ private:
+  struct Record {
+    std::unique_ptr<IOBuf> buf;
+    size_t length;
+    off_t pos;
+    Promise<off_t> promise;
+  };
+
+  void run();
+  void writeBatch(std::vector<Record>& batch);
+  void writeRecords(std::vector<Record>& records);
+  void preallocate(off_t end);
+  void sync();
+  void fail(const exception_wrapper& ew);
+  void complete(std::vector<Record>& records, const exception_wrapper& ew);
+
+  File file_;
+  uint32_t fileId_;
+  Options options_;
+  std::unique_lock<File> writeLock_;
+  std::atomic<off_t> filePos_;
+
+  // owned by the background thread
+  off_t allocatedEnd_;
+  std::vector<Record> unsynced_;
+
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::vector<Record> queue_;  // guarded by mutex_
+  exception_wrapper error_;    // guarded by mutex_
+  bool stop_{false};           // guarded by mutex_
+  std::thread thread_;
+};
+
 /**
  * Class to read from a RecordIO file.  Will skip invalid records.
  */
@@ -113,7 +228,37 @@ class RecordIOReader {
    */
   Iterator seek(off_t pos) const;
 
+  /**
+   * Callback for scan(), called with the record content and the position in
+   * file where the record (including header) begins, like value_type.
+   */
+  typedef std::function<void(ByteRange, off_t)> ScanCallback;
+
+  static constexpr size_t kDefaultScanRangeSize = 64 << 20;
+
+  /**
+   * Scan the file in parallel: split it into ranges of rangeSize bytes,
+   * each of which is scanned on executor from its beginning, as if with
+   * seek(), calling callback with the valid records which begin in it,
+   * in order.  The records point into the mapped file, they aren't copied.
+   * With prefetch, the pages of each range are requested from the kernel
+   * (madvise(MADV_WILLNEED)) before it is scanned.
+   *
+   * Ranges are scanned concurrently, so callback must be thread-safe.  The
+   * future completes with the number of records scanned, or with the first
+   * exception thrown by callback.  The reader must outlive the future.
+   */
+  Future<size_t> scan(Executor* executor,
+                      ScanCallback callback,
+                      size_t rangeSize = kDefaultScanRangeSize,
+                      bool prefetch = true) const;
+
  private:
+  size_t scanRange(const ScanCallback& callback,
+                   size_t begin,
+                   size_t length,
+                   bool prefetch) const;
+
   MemoryMapping map_;
   uint32_t fileId_;
 };
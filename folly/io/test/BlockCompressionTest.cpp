@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/io/BlockCompression.h>
+
+#include <random>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+#include <folly/Benchmark.h>
+#include <folly/Conv.h>
+#include <folly/futures/InlineExecutor.h>
+#include <folly/futures/ManualExecutor.h>
+#include <folly/futures/ThreadedExecutor.h>
+
+namespace folly { namespace io { namespace test {
+
+namespace {
+
+// Compressible text, not too repetitive
+std::string makeData(size_t length) {
+  static const char* const words[] = {
+    "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf",
+    "hotel", "india", "juliett", "kilo", "lima", "mike", "november",
+  };
+  std::mt19937 rng(length);
+  std::string data;
+  data.reserve(length + 16);
+  while (data.size() < length) {
+    toAppend(words[rng() % 14], ' ', rng() % 1000, '\n', &data);
+  }
+  data.resize(length);
+  return data;
+}
+
+// Chain data into buffers of uneven lengths, to cross block boundaries
+std::unique_ptr<IOBuf> makeChain(const std::string& data) {
+  auto chain = IOBuf::create(0);
+  size_t pos = 0;
+  for (size_t n = 1; pos < data.size(); n = n * 3 + 7) {
+    n = std::min(n, data.size() - pos);
+    chain->prependChain(IOBuf::copyBuffer(data.data() + pos, n));
+    pos += n;
+  }
+  return chain;
+}
+
+ByteRange bytesOf(const std::string& s) {
+  return ByteRange(StringPiece(s));
+}
+
+std::string toString(std::unique_ptr<IOBuf> buf) {
+  return buf->moveToFbString().toStdString();
+}
+
+}  // namespace
+
+class BlockCompressionTest : public testing::TestWithParam<CodecType> {
+ protected:
+  void SetUp() override {
+    type_ = GetParam();
+  }
+
+  CodecType type_;
+};
+
+TEST_P(BlockCompressionTest, RoundTrip) {
+  futures::ThreadedExecutor executor;
+  for (size_t length : {size_t(0), size_t(1), size_t(65536), size_t(200000)}) {
+    auto data = makeData(length);
+    auto container =
+      compressBlocks(*makeChain(data), &executor, type_,
+                     COMPRESSION_LEVEL_DEFAULT, 65536).get();
+
+    BlockCompressedReader reader(container->coalesce());
+    EXPECT_EQ(type_, reader.type());
+    EXPECT_EQ(65536, reader.blockSize());
+    EXPECT_EQ(length, reader.uncompressedLength());
+    EXPECT_EQ((length + 65535) / 65536, reader.blockCount());
+    EXPECT_EQ(data, toString(reader.uncompress(&executor).get()));
+  }
+}
+
+TEST_P(BlockCompressionTest, RandomAccess) {
+  InlineExecutor executor;
+  auto data = makeData(1000000);
+  auto container =
+    compressBlocks(*IOBuf::wrapBuffer(data.data(), data.size()),
+                   &executor, type_, COMPRESSION_LEVEL_FASTEST, 30000).get();
+  BlockCompressedReader reader(container->coalesce());
+  ASSERT_EQ(34, reader.blockCount());
+
+  for (size_t offset : {0, 29999, 30000, 512345, 999999}) {
+    size_t i = reader.blockFor(offset);
+    EXPECT_EQ(offset / 30000, i);
+    EXPECT_EQ(data.substr(i * 30000, 30000),
+              toString(reader.uncompressBlock(i)));
+  }
+  EXPECT_THROW(reader.uncompressBlock(34), std::out_of_range);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    BlockCompressionTest,
+    BlockCompressionTest,
+    testing::Values(CodecType::NO_COMPRESSION,
+                    CodecType::LZ4,
+                    CodecType::ZLIB,
+                    CodecType::LZMA2,
+                    CodecType::LZ4_FRAME,
+                    CodecType::ZSTD));
+
+TEST(BlockCompressionTest, ManualExecutor) {
+  ManualExecutor executor;
+  auto data = makeData(100000);
+  auto future = compressBlocks(*makeChain(data), &executor, CodecType::ZLIB,
+                               COMPRESSION_LEVEL_DEFAULT, 10000);
+  // nothing is done until the executor runs
+  EXPECT_FALSE(future.isReady());
+  auto container = future.getVia(&executor);
+
+  BlockCompressedReader reader(container->coalesce());
+  EXPECT_EQ(data, toString(reader.uncompress(&executor).getVia(&executor)));
+}
+
+TEST(BlockCompressionTest, Corruption) {
+  InlineExecutor executor;
+  auto data = makeData(100000);
+  auto container =
+    compressBlocks(*makeChain(data), &executor, CodecType::LZ4,
+                   COMPRESSION_LEVEL_DEFAULT, 10000).get();
+  container->coalesce();
+  std::string bytes = toString(std::move(container));
+
+  {
+    // a corrupted block doesn't affect the others
+    std::string corrupted = bytes;
+    corrupted[10] ^= 1;
+    BlockCompressedReader reader(bytesOf(corrupted));
+    EXPECT_THROW(reader.uncompressBlock(0), std::runtime_error);
+    EXPECT_EQ(data.substr(10000, 10000), toString(reader.uncompressBlock(1)));
+    EXPECT_THROW(reader.uncompress(&executor).get(), std::runtime_error);
+  }
+  for (size_t pos : {bytes.size() - 1, bytes.size() - 30, bytes.size() - 50}) {
+    // footer or index
+    std::string corrupted = bytes;
+    corrupted[pos] ^= 1;
+    EXPECT_THROW(BlockCompressedReader{bytesOf(corrupted)},
+                 std::runtime_error);
+  }
+  EXPECT_THROW(BlockCompressedReader{bytesOf(bytes).subpiece(1)},
+               std::runtime_error);
+  EXPECT_THROW(BlockCompressedReader{bytesOf("short")}, std::runtime_error);
+}
+
+TEST(BlockCompressionTest, Errors) {
+  InlineExecutor executor;
+  auto buf = IOBuf::copyBuffer("data");
+  EXPECT_THROW(compressBlocks(*buf, &executor, CodecType::ZLIB,
+                              COMPRESSION_LEVEL_DEFAULT, 0),
+               std::invalid_argument);
+  EXPECT_THROW(compressBlocks(*buf, &executor, CodecType::USER_DEFINED),
+               std::invalid_argument);
+  EXPECT_THROW(compressBlocks(*buf, &executor, CodecType::LZ4,
+                              COMPRESSION_LEVEL_DEFAULT, size_t(1) << 31),
+               std::invalid_argument);
+}
+
+namespace {
+
+constexpr size_t kBenchmarkLength = 64 << 20;
+const std::string& benchmarkData() {
+  static std::string data = makeData(kBenchmarkLength);
+  return data;
+}
+
+}  // namespace
+
+BENCHMARK(compress_zstd_single, iters) {
+  auto& data = benchmarkData();
+  auto buf = IOBuf::wrapBuffer(data.data(), data.size());
+  while (iters--) {
+    auto compressed = getCodec(CodecType::ZSTD)->compress(buf.get());
+    doNotOptimizeAway(compressed->computeChainDataLength());
+  }
+}
+
+BENCHMARK_RELATIVE(compress_zstd_blocks, iters) {
+  auto& data = benchmarkData();
+  auto buf = IOBuf::wrapBuffer(data.data(), data.size());
+  futures::ThreadedExecutor executor;
+  while (iters--) {
+    auto compressed = compressBlocks(*buf, &executor, CodecType::ZSTD).get();
+    doNotOptimizeAway(compressed->computeChainDataLength());
+  }
+}
+
+}}}  // namespaces
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  if (FLAGS_benchmark) {
+    folly::runBenchmarks();
+  }
+  return RUN_ALL_TESTS();
+}
@@ -16,6 +16,7 @@
 
 #include <folly/io/Compression.h>
 
+#include <atomic>
 #include <random>
 #include <thread>
 #include <unordered_map>
@@ -25,6 +26,7 @@
 #include <gtest/gtest.h>
 
 #include <folly/Benchmark.h>
+#include <folly/Conv.h>
 #include <folly/Hash.h>
 #include <folly/Random.h>
 #include <folly/Varint.h>
@@ -128,6 +130,8 @@ TEST(CompressionTestNeedsUncompressedLength, Simple) {
   EXPECT_TRUE(getCodec(CodecType::LZMA2)->needsUncompressedLength());
   EXPECT_FALSE(getCodec(CodecType::LZMA2_VARINT_SIZE)
     ->needsUncompressedLength());
+  EXPECT_FALSE(getCodec(CodecType::LZ4_FRAME)->needsUncompressedLength());
+  EXPECT_FALSE(getCodec(CodecType::ZSTD)->needsUncompressedLength());
 }
 
 class CompressionTest
@@ -180,7 +184,9 @@ INSTANTIATE_TEST_CASE_P(
                                      CodecType::ZLIB,
                                      CodecType::LZ4_VARINT_SIZE,
                                      CodecType::LZMA2,
-                                     CodecType::LZMA2_VARINT_SIZE)));
+                                     CodecType::LZMA2_VARINT_SIZE,
+                                     CodecType::LZ4_FRAME,
+                                     CodecType::ZSTD)));
 
 class CompressionVarintTest
     : public testing::TestWithParam<std::tr1::tuple<int, CodecType>> {
@@ -291,7 +297,324 @@ INSTANTIATE_TEST_CASE_P(
         // NO_COMPRESSION can't detect corruption
         // LZ4 can't detect corruption reliably (sigh)
         CodecType::SNAPPY,
-        CodecType::ZLIB));
+        CodecType::ZLIB,
+        CodecType::LZ4_FRAME,
+        CodecType::ZSTD));
+
+TEST(StreamingCompressionTest, Unsupported) {
+  EXPECT_FALSE(getCodec(CodecType::NO_COMPRESSION)->supportsStreaming());
+  EXPECT_FALSE(getCodec(CodecType::LZ4)->supportsStreaming());
+  EXPECT_FALSE(getCodec(CodecType::LZMA2_VARINT_SIZE)->supportsStreaming());
+  EXPECT_TRUE(getCodec(CodecType::ZLIB)->supportsStreaming());
+  EXPECT_TRUE(getCodec(CodecType::LZMA2)->supportsStreaming());
+  EXPECT_TRUE(getCodec(CodecType::LZ4_FRAME)->supportsStreaming());
+  EXPECT_TRUE(getCodec(CodecType::ZSTD)->supportsStreaming());
+
+  IOBufQueue input;
+  IOBufQueue output;
+  input.append("hello", 5);
+  auto codec = getCodec(CodecType::LZ4);
+  EXPECT_THROW(codec->compressStream(input, output), std::invalid_argument);
+  EXPECT_THROW(codec->uncompressStream(input, output), std::invalid_argument);
+}
+
+class StreamingCompressionTest : public testing::TestWithParam<CodecType> {
+ protected:
+  void SetUp() override { codec_ = getCodec(GetParam()); }
+
+  void runSimpleTest(const DataHolder& dh);
+
+  std::unique_ptr<Codec> codec_;
+};
+
+void StreamingCompressionTest::runSimpleTest(const DataHolder& dh) {
+  constexpr uint64_t uncompressedLength = uint64_t(1) << 22;  // 4MiB
+  constexpr uint64_t chunkLength = uint64_t(1) << 16;
+  auto data = dh.data(uncompressedLength);
+
+  // Compress in chunks, flushing half way
+  IOBufQueue compressed(IOBufQueue::cacheChainLength());
+  for (uint64_t pos = 0; pos < uncompressedLength; pos += chunkLength) {
+    IOBufQueue input;
+    input.wrapBuffer(data.data() + pos, chunkLength);
+    bool half = pos + chunkLength == uncompressedLength / 2;
+    codec_->compressStream(input, compressed,
+                           half ? FlushOp::FLUSH : FlushOp::NONE);
+    EXPECT_TRUE(input.empty());
+
+    if (half) {
+      // What was flushed can be uncompressed
+      IOBufQueue input(IOBufQueue::cacheChainLength());
+      input.append(compressed.front()->clone());
+      IOBufQueue output(IOBufQueue::cacheChainLength());
+      EXPECT_FALSE(getCodec(GetParam())->uncompressStream(input, output));
+      EXPECT_EQ(uncompressedLength / 2, output.chainLength());
+      EXPECT_EQ(dh.hash(uncompressedLength / 2), hashIOBuf(output.front()));
+    }
+  }
+  IOBufQueue empty;
+  codec_->compressStream(empty, compressed, FlushOp::END);
+
+  // A stream is compatible with uncompress()
+  auto uncompressed = codec_->uncompress(compressed.front(),
+                                         uncompressedLength);
+  EXPECT_EQ(uncompressedLength, uncompressed->computeChainDataLength());
+  EXPECT_EQ(dh.hash(uncompressedLength), hashIOBuf(uncompressed.get()));
+
+  // Uncompress in growing pieces
+  IOBufQueue output(IOBufQueue::cacheChainLength());
+  bool streamEnd = false;
+  for (size_t step = 1; !compressed.empty(); step *= 2) {
+    EXPECT_FALSE(streamEnd);
+    IOBufQueue input;
+    input.append(compressed.split(std::min(step, compressed.chainLength())));
+    streamEnd = codec_->uncompressStream(input, output);
+    EXPECT_TRUE(input.empty());
+  }
+  EXPECT_TRUE(streamEnd);
+  EXPECT_EQ(uncompressedLength, output.chainLength());
+  EXPECT_EQ(dh.hash(uncompressedLength), hashIOBuf(output.front()));
+}
+
+TEST_P(StreamingCompressionTest, RandomData) {
+  runSimpleTest(randomDataHolder);
+}
+
+TEST_P(StreamingCompressionTest, ConstantData) {
+  runSimpleTest(constantDataHolder);
+}
+
+TEST_P(StreamingCompressionTest, Concatenated) {
+  IOBufQueue compressed(IOBufQueue::cacheChainLength());
+  for (auto s : {"hello ", "world"}) {
+    IOBufQueue input;
+    input.append(s, strlen(s));
+    codec_->compressStream(input, compressed, FlushOp::END);
+  }
+
+  IOBufQueue output(IOBufQueue::cacheChainLength());
+  auto length = compressed.chainLength();
+  EXPECT_TRUE(codec_->uncompressStream(compressed, output));
+  EXPECT_FALSE(compressed.empty());
+  EXPECT_LT(compressed.chainLength(), length);
+  EXPECT_EQ("hello ", output.move()->moveToFbString());
+  EXPECT_TRUE(codec_->uncompressStream(compressed, output, FlushOp::END));
+  EXPECT_TRUE(compressed.empty());
+  EXPECT_EQ("world", output.move()->moveToFbString());
+}
+
+TEST_P(StreamingCompressionTest, Truncated) {
+  IOBufQueue compressed(IOBufQueue::cacheChainLength());
+  IOBufQueue input;
+  input.wrapBuffer(randomDataHolder.data(1000).data(), 1000);
+  codec_->compressStream(input, compressed, FlushOp::END);
+  compressed.trimEnd(1);
+
+  IOBufQueue output;
+  EXPECT_THROW(codec_->uncompressStream(compressed, output, FlushOp::END),
+               std::runtime_error);
+  codec_->resetStream();
+
+  IOBufQueue garbage;
+  garbage.append("garbage, not compressed data", 28);
+  EXPECT_THROW(codec_->uncompressStream(garbage, output),
+               std::runtime_error);
+  codec_->resetStream();
+}
+
+INSTANTIATE_TEST_CASE_P(
+    StreamingCompressionTest,
+    StreamingCompressionTest,
+    testing::Values(CodecType::ZLIB,
+                    CodecType::LZMA2,
+                    CodecType::LZ4_FRAME,
+                    CodecType::ZSTD));
+
+namespace {
+
+// Small and similar pieces of data, as RPC payloads are
+std::unique_ptr<IOBuf> rpcPayload(size_t i) {
+  return IOBuf::copyBuffer(to<std::string>(
+      "{\"request_id\": ", i * 7919,
+      ", \"method\": \"getUserProfile\", \"user\": {\"name\": \"user",
+      i % 1000, "\", \"locale\": \"en_US\", \"flags\": [\"beta\", ",
+      "\"verified\"]}, \"deadline_ms\": ", 100 + i % 50, "}"));
+}
+
+std::vector<std::unique_ptr<IOBuf>> rpcPayloads(size_t begin, size_t end) {
+  std::vector<std::unique_ptr<IOBuf>> payloads;
+  for (size_t i = begin; i < end; ++i) {
+    payloads.push_back(rpcPayload(i));
+  }
+  return payloads;
+}
+
+std::unique_ptr<IOBuf> trainRpcDictionary() {
+  auto samples = rpcPayloads(0, 2000);
+  std::vector<const IOBuf*> pointers;
+  for (auto& sample : samples) {
+    pointers.push_back(sample.get());
+  }
+  return trainDictionary(CodecType::ZSTD, pointers, 4096);
+}
+
+std::unique_ptr<Codec> zstdDictionaryCodec() {
+  return getCodec(CodecType::ZSTD, COMPRESSION_LEVEL_DEFAULT,
+                  trainRpcDictionary()->coalesce());
+}
+
+}  // namespace
+
+TEST(CompressionDictionaryTest, Zstd) {
+  auto dictionary = trainRpcDictionary();
+  EXPECT_GT(dictionary->length(), 0);
+  EXPECT_LE(dictionary->length(), 4096);
+
+  auto plain = getCodec(CodecType::ZSTD);
+  auto codec = getCodec(CodecType::ZSTD, COMPRESSION_LEVEL_DEFAULT,
+                        dictionary->coalesce());
+  uint64_t plainLength = 0;
+  uint64_t dictionaryLength = 0;
+  // The contexts are reused across calls
+  for (auto& payload : rpcPayloads(5000, 5100)) {
+    auto compressed = codec->compress(payload.get());
+    dictionaryLength += compressed->computeChainDataLength();
+    plainLength += plain->compress(payload.get())->computeChainDataLength();
+
+    auto uncompressed = codec->uncompress(compressed.get());
+    EXPECT_EQ(payload->moveToFbString(), uncompressed->moveToFbString());
+    EXPECT_THROW(plain->uncompress(compressed.get()), std::runtime_error);
+  }
+  EXPECT_LT(dictionaryLength * 2, plainLength);
+
+  // Streams use the dictionary too
+  IOBufQueue input;
+  input.append(rpcPayload(42));
+  IOBufQueue compressed;
+  codec->compressStream(input, compressed, FlushOp::END);
+  IOBufQueue output;
+  EXPECT_TRUE(codec->uncompressStream(compressed, output));
+  EXPECT_EQ(rpcPayload(42)->moveToFbString(), output.move()->moveToFbString());
+}
+
+TEST(CompressionDictionaryTest, Errors) {
+  auto payload = rpcPayload(1);
+  EXPECT_THROW(trainDictionary(CodecType::ZLIB, {payload.get()}),
+               std::invalid_argument);
+  EXPECT_THROW(trainDictionary(CodecType::ZSTD, {payload.get()}),
+               std::runtime_error);
+  EXPECT_THROW(trainDictionary(CodecType::ZSTD, {}), std::runtime_error);
+  EXPECT_THROW(getCodec(CodecType::ZLIB, COMPRESSION_LEVEL_DEFAULT,
+                        payload->coalesce()),
+               std::invalid_argument);
+  EXPECT_EQ(CodecType::ZLIB,
+            getCodec(CodecType::ZLIB, COMPRESSION_LEVEL_DEFAULT,
+                     ByteRange())->type());
+}
+
+TEST(CompressionZstdTest, SharedCodec) {
+  // The one-shot calls of a codec may run in several threads at once
+  std::shared_ptr<Codec> codec(zstdDictionaryCodec());
+  std::vector<std::thread> threads;
+  std::atomic<size_t> errors(0);
+  for (size_t t = 0; t < 8; ++t) {
+    threads.emplace_back([codec, t, &errors] {
+      for (auto& payload : rpcPayloads(t * 200, t * 200 + 200)) {
+        auto compressed = codec->compress(payload.get());
+        auto uncompressed = codec->uncompress(compressed.get());
+        if (payload->moveToFbString() != uncompressed->moveToFbString()) {
+          ++errors;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(0, errors.load());
+}
+
+TEST(CompressionZstdTest, ForgedContentSize) {
+  // A frame of one byte, claiming 1TiB: the output isn't allocated from
+  // the claim
+  const uint8_t frame[] = {
+    0x28, 0xb5, 0x2f, 0xfd,                           // magic
+    0xe0,                                             // 8-byte size
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,   // 1 << 40
+    0x09, 0x00, 0x00, 'a',                            // last raw block
+  };
+  auto data = IOBuf::wrapBuffer(frame, sizeof(frame));
+  EXPECT_THROW(getCodec(CodecType::ZSTD)->uncompress(data.get()),
+               std::runtime_error);
+}
+
+namespace {
+
+void compressPayloads(Codec& codec, size_t iters) {
+  std::vector<std::unique_ptr<IOBuf>> payloads;
+  BENCHMARK_SUSPEND { payloads = rpcPayloads(5000, 6000); }
+  for (size_t i = 0; i < iters; ++i) {
+    auto compressed = codec.compress(payloads[i % payloads.size()].get());
+    doNotOptimizeAway(compressed->length());
+  }
+}
+
+void uncompressPayloads(Codec& codec, size_t iters) {
+  std::vector<std::unique_ptr<IOBuf>> compressed;
+  std::vector<uint64_t> lengths;
+  BENCHMARK_SUSPEND {
+    for (auto& payload : rpcPayloads(5000, 6000)) {
+      compressed.push_back(codec.compress(payload.get()));
+      lengths.push_back(payload->length());
+    }
+  }
+  for (size_t i = 0; i < iters; ++i) {
+    size_t j = i % compressed.size();
+    auto uncompressed = codec.uncompress(compressed[j].get(), lengths[j]);
+    doNotOptimizeAway(uncompressed->length());
+  }
+}
+
+}  // namespace
+
+#define PAYLOAD_BENCHMARK(bench, run, name, codec)      \
+  bench(run##_##name, iters) {                           \
+    std::unique_ptr<Codec> c;                            \
+    BENCHMARK_SUSPEND { c = codec; }                     \
+    run(*c, iters);                                      \
+  }
+
+PAYLOAD_BENCHMARK(BENCHMARK, compressPayloads, zlib,
+                  getCodec(CodecType::ZLIB))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, compressPayloads, lz4,
+                  getCodec(CodecType::LZ4))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, compressPayloads, lz4Frame,
+                  getCodec(CodecType::LZ4_FRAME))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, compressPayloads, snappy,
+                  getCodec(CodecType::SNAPPY))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, compressPayloads, lzma2,
+                  getCodec(CodecType::LZMA2))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, compressPayloads, zstd,
+                  getCodec(CodecType::ZSTD))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, compressPayloads, zstdDictionary,
+                  zstdDictionaryCodec())
+
+BENCHMARK_DRAW_LINE();
+
+PAYLOAD_BENCHMARK(BENCHMARK, uncompressPayloads, zlib,
+                  getCodec(CodecType::ZLIB))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, uncompressPayloads, lz4,
+                  getCodec(CodecType::LZ4))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, uncompressPayloads, lz4Frame,
+                  getCodec(CodecType::LZ4_FRAME))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, uncompressPayloads, snappy,
+                  getCodec(CodecType::SNAPPY))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, uncompressPayloads, lzma2,
+                  getCodec(CodecType::LZMA2))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, uncompressPayloads, zstd,
+                  getCodec(CodecType::ZSTD))
+PAYLOAD_BENCHMARK(BENCHMARK_RELATIVE, uncompressPayloads, zstdDictionary,
+                  zstdDictionaryCodec())
 
 }}}  // namespaces
 
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/io/IOBufRope.h>
+
+#include <folly/Benchmark.h>
+#include <folly/FBString.h>
+#include <folly/Format.h>
+#include <folly/String.h>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+using folly::IOBuf;
+using folly::IOBufRope;
+using folly::StringPiece;
+
+namespace {
+
+void checkConsistency(const IOBufRope& rope) {
+  size_t len = rope.front() ? rope.front()->computeChainDataLength() : 0;
+  EXPECT_EQ(len, rope.size());
+  EXPECT_LE(rope.size(), rope.capacity());
+}
+
+} // namespace
+
+TEST(IOBufRope, Append) {
+  IOBufRope rope;
+  EXPECT_TRUE(rope.empty());
+  EXPECT_EQ(nullptr, rope.front());
+  EXPECT_EQ("", rope.toString());
+
+  rope.append("hello", 5);
+  rope.push_back(' ');
+  rope += StringPiece("world");
+  rope += '!';
+  rope.append("");
+  checkConsistency(rope);
+  EXPECT_EQ(12, rope.size());
+  EXPECT_EQ("hello world!", rope.toString());
+  EXPECT_FALSE(rope.front()->isChained());
+}
+
+TEST(IOBufRope, Segments) {
+  IOBufRope rope;
+  std::string expected;
+  std::string chunk(1000, 'x');
+  for (int i = 0; i < 5000; ++i) {
+    chunk[i % chunk.size()] = 'a' + i % 26;
+    rope.append(chunk);
+    expected.append(chunk);
+  }
+  checkConsistency(rope);
+  EXPECT_EQ(expected, rope.toString());
+
+  // segments grow geometrically, so there are few of them
+  size_t segments = rope.front()->countChainElements();
+  EXPECT_LT(segments, 20);
+  for (auto& buf : *rope.front()) {
+    EXPECT_LE(buf.size(), IOBufRope::kMaxSegmentSize + chunk.size());
+  }
+
+  std::string big(3 * IOBufRope::kMaxSegmentSize, 'y');
+  rope.append(big);
+  expected.append(big);
+  checkConsistency(rope);
+  EXPECT_EQ(expected, rope.toString());
+}
+
+TEST(IOBufRope, NoCopy) {
+  IOBufRope rope;
+  rope.append("first segment");
+  const uint8_t* data = rope.front()->data();
+  std::string filler(IOBufRope::kInitialSegmentSize * 4, 'z');
+  rope.append(filler);
+  rope.reserve(rope.size() + 100);
+  rope.append(filler);
+  // bytes once written stay in place
+  EXPECT_EQ(data, rope.front()->data());
+  checkConsistency(rope);
+}
+
+TEST(IOBufRope, Prepend) {
+  IOBufRope rope(16);
+  rope.prepend("body");
+  rope.prepend("hdr:");
+  EXPECT_EQ("hdr:body", rope.toString());
+  EXPECT_FALSE(rope.front()->isChained());
+
+  // no more headroom, prepended as a new segment
+  rope.prepend("a longer header line: ");
+  EXPECT_EQ("a longer header line: hdr:body", rope.toString());
+  EXPECT_TRUE(rope.front()->isChained());
+  rope.append(", more body");
+  EXPECT_EQ("a longer header line: hdr:body, more body", rope.toString());
+  checkConsistency(rope);
+
+  IOBufRope noHeadroom;
+  noHeadroom.append("b");
+  noHeadroom.prepend("a");
+  EXPECT_EQ("ab", noHeadroom.toString());
+  checkConsistency(noHeadroom);
+}
+
+TEST(IOBufRope, AppendIOBuf) {
+  const char* text = "wrapped";
+  IOBufRope rope;
+  rope.append("head ");
+  rope.append(IOBuf::wrapBuffer(text, strlen(text)));
+  rope.append(std::unique_ptr<IOBuf>());
+  // the wrapped buffer is not written into
+  rope.append(" tail");
+  EXPECT_EQ("head wrapped tail", rope.toString());
+  EXPECT_EQ(3, rope.front()->countChainElements());
+  EXPECT_STREQ("wrapped", text);
+  checkConsistency(rope);
+}
+
+TEST(IOBufRope, Move) {
+  IOBufRope rope;
+  rope.append("hello world");
+  const uint8_t* data = rope.front()->data();
+
+  IOBufRope other(std::move(rope));
+  EXPECT_TRUE(rope.empty());
+  EXPECT_EQ(nullptr, rope.front());
+  EXPECT_EQ("hello world", other.toString());
+
+  rope = std::move(other);
+  rope.append("!");
+  auto buf = rope.move();
+  EXPECT_TRUE(rope.empty());
+  EXPECT_EQ(data, buf->data());
+  EXPECT_EQ("hello world!", buf->moveToFbString());
+
+  rope.append("again");
+  rope.clear();
+  EXPECT_TRUE(rope.empty());
+  checkConsistency(rope);
+}
+
+TEST(IOBufRope, ToAppend) {
+  IOBufRope rope;
+  folly::toAppend("a", 1, ',', -2, std::string("b"), 2.5, &rope);
+  folly::toAppendDelim(":", 3, StringPiece("c"), &rope);
+  folly::toAppendFit("d", 4, &rope);
+  EXPECT_EQ("a1,-2b2.53:cd4", rope.toString());
+  checkConsistency(rope);
+
+  EXPECT_EQ("x a1,-2b2.53:cd4",
+            folly::to<std::string>("x ", rope));
+  EXPECT_EQ("12", folly::to<IOBufRope>(1, 2).toString());
+
+  std::vector<int> v {1, 2, 3};
+  IOBufRope joined;
+  folly::join(", ", v, joined);
+  EXPECT_EQ("1, 2, 3", joined.toString());
+
+  // appending a rope to itself copies what it holds
+  folly::toAppend(joined, &joined);
+  EXPECT_EQ("1, 2, 31, 2, 3", joined.toString());
+}
+
+TEST(IOBufRope, Format) {
+  IOBufRope rope;
+  folly::format(&rope, "{} {:>5}|", 42, "x");
+  folly::format(&rope, "{}", std::string(10000, 'f'));
+  EXPECT_EQ("42     x|" + std::string(10000, 'f'), rope.toString());
+  checkConsistency(rope);
+}
+
+namespace {
+
+const size_t kRows = 100000;
+
+template <class String>
+size_t buildResponse() {
+  String out;
+  for (size_t i = 0; i < kRows; ++i) {
+    folly::toAppend("<tr><td>", i, "</td><td>row ", i * 7, "</td></tr>\n",
+                    &out);
+  }
+  return out.size();
+}
+
+} // namespace
+
+BENCHMARK(buildResponse_string, iters) {
+  while (iters--) {
+    folly::doNotOptimizeAway(buildResponse<std::string>());
+  }
+}
+
+BENCHMARK_RELATIVE(buildResponse_fbstring, iters) {
+  while (iters--) {
+    folly::doNotOptimizeAway(buildResponse<folly::fbstring>());
+  }
+}
+
+BENCHMARK_RELATIVE(buildResponse_rope, iters) {
+  while (iters--) {
+    folly::doNotOptimizeAway(buildResponse<IOBufRope>());
+  }
+}
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  if (FLAGS_benchmark) {
+    folly::runBenchmarks();
+  }
+  return RUN_ALL_TESTS();
+}
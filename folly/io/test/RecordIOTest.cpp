@@ -16,10 +16,15 @@
 
 #include <folly/io/RecordIO.h>
 
+#include <fcntl.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <mutex>
 #include <random>
+#include <thread>
 
 #include <gflags/gflags.h>
 #include <glog/logging.h>
@@ -29,6 +34,8 @@
 #include <folly/FBString.h>
 #include <folly/Random.h>
 #include <folly/experimental/TestUtil.h>
+#include <folly/futures/InlineExecutor.h>
+#include <folly/futures/ThreadedExecutor.h>
 #include <folly/io/IOBufQueue.h>
 
 DEFINE_int32(random_seed, folly::randomNumberSeed(), "random seed");
@@ -182,6 +189,160 @@ TEST(RecordIOTest, ExtraMagic) {
   }
 }
 
+TEST(RecordIOTest, Batched) {
+  typedef BatchedRecordIOWriter::SyncPolicy SyncPolicy;
+  for (auto policy : {SyncPolicy::NONE, SyncPolicy::BATCH,
+                      SyncPolicy::INTERVAL}) {
+    TemporaryFile file;
+    const size_t threadCount = 8;
+    const size_t recordCount = 500;
+    std::vector<std::vector<Future<off_t>>> futures(threadCount);
+    {
+      BatchedRecordIOWriter writer(
+          File(file.fd()), 1,
+          BatchedRecordIOWriter::Options()
+            .setSyncPolicy(policy)
+            .setSyncInterval(std::chrono::milliseconds(1))
+            .setPreallocateSize(1 << 16));
+      std::vector<std::thread> threads;
+      for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t] {
+          for (size_t i = 0; i < recordCount; ++i) {
+            // written later, so not wrapping temporaries
+            auto buf = IOBuf::copyBuffer(to<std::string>("thread ", t, " "));
+            buf->prependChain(IOBuf::copyBuffer(to<std::string>(i)));
+            futures[t].push_back(writer.write(std::move(buf)));
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+      for (auto& f : futures[0]) {
+        f.wait();
+      }
+      EXPECT_EQ(-1, writer.write(IOBuf::create(0)).get());
+    }
+
+    struct stat st;
+    ASSERT_EQ(0, fstat(file.fd(), &st));
+    RecordIOReader reader(File(file.fd()));
+    size_t count = 0;
+    for (auto& r : reader) {
+      (void)r;
+      ++count;
+    }
+    EXPECT_EQ(threadCount * recordCount, count);
+    off_t end = 0;
+    for (size_t t = 0; t < threadCount; ++t) {
+      for (size_t i = 0; i < recordCount; ++i) {
+        ASSERT_TRUE(futures[t][i].isReady());
+        off_t pos = futures[t][i].value();
+        auto it = reader.seek(pos);
+        ASSERT_FALSE(it == reader.end());
+        EXPECT_EQ(pos, it->second);
+        EXPECT_EQ(to<std::string>("thread ", t, " ", i), sp(it->first));
+        end = std::max(end, off_t(pos + recordio_helpers::headerSize() +
+                                  it->first.size()));
+      }
+    }
+    // preallocation doesn't change the file size
+    EXPECT_EQ(end, st.st_size);
+  }
+}
+
+TEST(RecordIOTest, BatchedSyncInterval) {
+  TemporaryFile file;
+  Future<off_t> future = makeFuture(off_t(0));
+  {
+    BatchedRecordIOWriter writer(
+        File(file.fd()), 1,
+        BatchedRecordIOWriter::Options()
+          .setSyncPolicy(BatchedRecordIOWriter::SyncPolicy::INTERVAL)
+          .setSyncInterval(std::chrono::hours(1)));
+    // the first sync is immediate, the next one is an hour later
+    EXPECT_EQ(0, writer.write(iobufs({"hello"})).get());
+    future = writer.write(iobufs({"world"}));
+    /* sleep override */ std::this_thread::sleep_for(
+        std::chrono::milliseconds(10));
+    EXPECT_FALSE(future.isReady());
+  }
+  // synced when the writer is destroyed
+  ASSERT_TRUE(future.isReady());
+  EXPECT_EQ(recordio_helpers::headerSize() + 5, future.value());
+}
+
+TEST(RecordIOTest, BatchedError) {
+  TemporaryFile file;
+  BatchedRecordIOWriter writer(File(file.path().c_str(), O_RDONLY));
+  EXPECT_THROW(writer.write(iobufs({"hello"})).get(), std::system_error);
+  // writing stops at the first error
+  EXPECT_THROW(writer.write(iobufs({"world"})).get(), std::system_error);
+}
+
+namespace {
+typedef std::vector<std::pair<std::string, off_t>> ScannedRecords;
+
+// Scan in parallel, returning the records sorted by position
+ScannedRecords scanRecords(const RecordIOReader& reader,
+                           Executor* executor,
+                           size_t rangeSize,
+                           bool prefetch = true) {
+  std::mutex mutex;
+  ScannedRecords records;
+  size_t count = reader.scan(executor, [&] (ByteRange record, off_t pos) {
+    std::lock_guard<std::mutex> lock(mutex);
+    records.emplace_back(sp(record).str(), pos);
+  }, rangeSize, prefetch).get();
+  EXPECT_EQ(records.size(), count);
+  std::sort(records.begin(), records.end(),
+            [] (const std::pair<std::string, off_t>& a,
+                const std::pair<std::string, off_t>& b) {
+    return a.second < b.second;
+  });
+  return records;
+}
+}  // namespace
+
+TEST(RecordIOTest, Scan) {
+  TemporaryFile file;
+  {
+    RecordIOWriter writer(File(file.fd()));
+    for (int i = 0; i < 100; ++i) {
+      writer.write(IOBuf::copyBuffer(to<std::string>("record ", i)));
+    }
+  }
+  RecordIOReader reader(File(file.fd()));
+  ScannedRecords expected;
+  for (auto& r : reader) {
+    expected.emplace_back(sp(r.first).str(), r.second);
+  }
+  ASSERT_EQ(100, expected.size());
+
+  InlineExecutor inlineExecutor;
+  futures::ThreadedExecutor threadedExecutor;
+  for (size_t rangeSize : {1, 7, 40, 1000, 1 << 30}) {
+    SCOPED_TRACE(rangeSize);
+    EXPECT_EQ(expected, scanRecords(reader, &inlineExecutor, rangeSize));
+    EXPECT_EQ(expected,
+              scanRecords(reader, &threadedExecutor, rangeSize + 1000, false));
+  }
+
+  EXPECT_THROW(reader.scan(&inlineExecutor, [] (ByteRange, off_t) {}, 0),
+               std::invalid_argument);
+  auto future = reader.scan(&threadedExecutor, [] (ByteRange, off_t pos) {
+    if (pos > 1000) {
+      throw std::runtime_error("stop");
+    }
+  }, 500);
+  EXPECT_THROW(future.get(), std::runtime_error);
+
+  TemporaryFile empty;
+  RecordIOReader emptyReader(File(empty.fd()));
+  EXPECT_EQ(0, emptyReader.scan(&inlineExecutor,
+                                [] (ByteRange, off_t) {}).get());
+}
+
 namespace {
 void corrupt(int fd, off_t pos) {
   uint8_t val = 0;
@@ -260,6 +421,15 @@ TEST(RecordIOTest, Randomized) {
       ++i;
     }
     EXPECT_EQ(records.size(), i);
+
+    // Range boundaries fall in records and corrupted bytes
+    ScannedRecords expected;
+    for (auto& r : records) {
+      expected.emplace_back(r.first.toStdString(), r.second);
+    }
+    InlineExecutor executor;
+    EXPECT_EQ(expected, scanRecords(reader, &executor, 1 << 16));
+    EXPECT_EQ(expected, scanRecords(reader, &executor, 12345));
   }
 }
 
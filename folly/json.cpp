@@ -23,6 +23,12 @@
 #include <folly/Range.h>
 #include <folly/String.h>
 #include <folly/Unicode.h>
+#include <folly/detail/JsonParser.h>
+#include <folly/io/IOBufQueue.h>
+
+#if FOLLY_X64 && FOLLY_HAVE_EMMINTRIN_H
+#include <emmintrin.h>
+#endif
 
 namespace folly {
 
@@ -115,8 +121,263 @@ char32_t decodeUtf8(
   throw std::runtime_error("folly::decodeUtf8 encoding length maxed out");
 }
 
+#if FOLLY_X64 && FOLLY_HAVE_EMMINTRIN_H
+#define FOLLY_JSON_SSE2 1
+#endif
+
+/*
+ * The first character from p to escape: '"', '\\' or a control
+ * character, or any non-ASCII one with nonAscii. e if there is none.
+ */
+const unsigned char* findEscape(const unsigned char* p,
+                                const unsigned char* e,
+                                bool nonAscii) {
+#if FOLLY_JSON_SSE2
+  const __m128i quote = _mm_set1_epi8('\"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i control = _mm_set1_epi8(0x1f);
+  int asciiMask = nonAscii ? 0xffff : 0;
+  for (; e - p >= 16; p += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i special = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+        _mm_cmpeq_epi8(_mm_min_epu8(v, control), v));
+    int mask = _mm_movemask_epi8(special) | (_mm_movemask_epi8(v) & asciiMask);
+    if (mask) {
+      return p + __builtin_ctz(mask);
+    }
+  }
+#endif
+  for (; p != e; ++p) {
+    if (*p == '\"' || *p == '\\' || *p <= 0x1f || (nonAscii && *p >= 0x80)) {
+      break;
+    }
+  }
+  return p;
+}
+
+/*
+ * Escape input into out, by runs of characters which need not be (see
+ * escapeString()).
+ */
+template <class Out>
+void escapeStringTo(StringPiece input,
+                    Out& out,
+                    const serialization_opts& opts) {
+  auto hexDigit = [] (int c) -> char {
+    return c < 10 ? c + '0' : c - 10 + 'a';
+  };
+
+  // Since non-ascii encoding inherently does utf8 validation
+  // we explicitly validate utf8 only if non-ascii encoding is disabled.
+  bool validate = (opts.validate_utf8 || opts.skip_invalid_utf8) &&
+    !opts.encode_non_ascii;
+  bool nonAscii = validate || opts.encode_non_ascii;
+
+  out.push_back('\"');
+
+  auto* p = reinterpret_cast<const unsigned char*>(input.begin());
+  auto* e = reinterpret_cast<const unsigned char*>(input.end());
+
+  for (;;) {
+    auto* q = findEscape(p, e, nonAscii);
+    out.append(reinterpret_cast<const char*>(p), q - p);
+    p = q;
+    if (p == e) {
+      break;
+    }
+    if (*p & 0x80) {
+      if (opts.encode_non_ascii) {
+        // note that this if condition captures utf8 chars
+        // with value > 127, so size > 1 byte
+        char32_t v = decodeUtf8(p, e, opts.skip_invalid_utf8);
+        char buf[6] = {
+          '\\', 'u', hexDigit(v >> 12), hexDigit((v >> 8) & 0x0f),
+          hexDigit((v >> 4) & 0x0f), hexDigit(v & 0x0f)
+        };
+        out.append(buf, sizeof(buf));
+      } else {
+        // calling utf8_decode has the side effect of
+        // checking that utf8 encodings are valid
+        char32_t v = decodeUtf8(q, e, opts.skip_invalid_utf8);
+        if (opts.skip_invalid_utf8 && v == U'\ufffd') {
+          out.append("\ufffd", sizeof("\ufffd") - 1);
+        } else {
+          out.append(reinterpret_cast<const char*>(p), q - p);
+        }
+        p = q;
+      }
+    } else if (*p == '\\' || *p == '\"') {
+      char buf[2] = { '\\', char(*p++) };
+      out.append(buf, sizeof(buf));
+    } else {
+      switch (*p) {
+        case '\b': out.append("\\b", 2); break;
+        case '\f': out.append("\\f", 2); break;
+        case '\n': out.append("\\n", 2); break;
+        case '\r': out.append("\\r", 2); break;
+        case '\t': out.append("\\t", 2); break;
+        default: {
+          // note that this if condition captures non readable chars
+          // with value < 32, so size = 1 byte (e.g control chars).
+          char buf[6] = {
+            '\\', 'u', '0', '0', hexDigit((*p & 0xf0) >> 4), hexDigit(*p & 0xf)
+          };
+          out.append(buf, sizeof(buf));
+        }
+      }
+      p++;
+    }
+  }
+
+  out.push_back('\"');
+}
+
+/*
+ * Upper bound of the size of the JSON text of v, but for the escapes
+ * of strings, to reserve the output buffer once.
+ */
+size_t estimateSize(dynamic const& v,
+                    serialization_opts const& opts,
+                    unsigned depth = 0) {
+  // the separator and newline before each element when pretty
+  size_t sep = opts.pretty_formatting ? 2 + depth * 2 : 1;
+  size_t size = 0;
+  switch (v.type()) {
+    case dynamic::DOUBLE:
+      return 24;
+    case dynamic::INT64:
+      return 20;
+    case dynamic::BOOL:
+    case dynamic::NULLT:
+      return 5;
+    case dynamic::STRING:
+      return v.size() + 2;
+    case dynamic::OBJECT:
+      for (auto& item : v.items()) {
+        size += sep + 4 + estimateSize(item.first, opts, depth + 1) +
+          estimateSize(item.second, opts, depth + 1);
+      }
+      return size + sep + 2;
+    case dynamic::ARRAY:
+      for (auto& element : v) {
+        size += sep + 2 + estimateSize(element, opts, depth + 1);
+      }
+      return size + sep + 2;
+    default:
+      return 0;
+  }
+}
+
+/*
+ * Output of Printer to a string, written in place: the string is grown
+ * (with garbage) as needed and cut to the output by finish(), at the
+ * latest when destroyed.
+ */
+class StringOut {
+public:
+  explicit StringOut(fbstring& out) : out_(out), size_(out.size()) {}
+  ~StringOut() { finish(); }
+
+  void reserve(size_t n) { ensure(n); }
+
+  void push_back(char c) {
+    ensure(1);
+    *p_++ = c;
+  }
+
+  void append(const char* p, size_t n) {
+    ensure(n);
+    memcpy(p_, p, n);
+    p_ += n;
+  }
+
+  void append(size_t n, char c) {
+    ensure(n);
+    memset(p_, c, n);
+    p_ += n;
+  }
+
+  void finish() {
+    out_.resize(size());
+  }
+
+private:
+  size_t size() const { return size_ + (p_ - begin_); }
+
+  void ensure(size_t n) {
+    if (UNLIKELY(size_t(end_ - p_) < n)) {
+      size_ = size();
+      out_.resize(std::max(size_ + n, out_.size() * 2));
+      begin_ = p_ = &out_[0] + size_;
+      end_ = &out_[0] + out_.size();
+    }
+  }
+
+  fbstring& out_;
+  size_t size_;   // before begin_
+  char* begin_{nullptr};
+  char* p_{nullptr};
+  char* end_{nullptr};
+};
+
+/*
+ * Output of Printer to the tail of an IOBufQueue, committed (by
+ * postallocate()) when another buffer is needed and by finish().
+ */
+class QueueOut {
+public:
+  explicit QueueOut(IOBufQueue& queue) : queue_(queue) {}
+
+  void reserve(size_t n) { ensure(n); }
+
+  void push_back(char c) {
+    ensure(1);
+    *p_++ = c;
+  }
+
+  void append(const char* p, size_t n) {
+    ensure(n);
+    memcpy(p_, p, n);
+    p_ += n;
+  }
+
+  void append(size_t n, char c) {
+    ensure(n);
+    memset(p_, c, n);
+    p_ += n;
+  }
+
+  void finish() {
+    if (p_ != begin_) {
+      queue_.postallocate(p_ - begin_);
+      begin_ = p_;
+    }
+  }
+
+private:
+  static constexpr size_t kGrowth = 4096;
+
+  void ensure(size_t n) {
+    if (UNLIKELY(size_t(end_ - p_) < n)) {
+      finish();
+      auto buf = queue_.preallocate(n, std::max(n, kGrowth));
+      begin_ = p_ = static_cast<char*>(buf.first);
+      end_ = p_ + buf.second;
+    }
+  }
+
+  IOBufQueue& queue_;
+  char* begin_{nullptr};
+  char* p_{nullptr};
+  char* end_{nullptr};
+};
+
+constexpr size_t QueueOut::kGrowth;
+
+template <class Out>
 struct Printer {
-  explicit Printer(fbstring& out,
+  explicit Printer(Out& out,
                    unsigned* indentLevel,
                    serialization_opts const* opts)
     : out_(out)
@@ -132,7 +393,7 @@ struct Printer {
         throw std::runtime_error("folly::toJson: JSON object value was a "
           "NaN or INF");
       }
-      toAppend(v.asDouble(), &out_, opts_.double_mode, opts_.double_num_digits);
+      printDouble(v.asDouble());
       break;
     case dynamic::INT64: {
       auto intval = v.asInt();
@@ -141,17 +402,21 @@ struct Printer {
         // as a double without loss of precision.
         intval = int64_t(to<double>(intval));
       }
-      toAppend(intval, &out_);
+      printInt(intval);
       break;
     }
     case dynamic::BOOL:
-      out_ += v.asBool() ? "true" : "false";
+      if (v.asBool()) {
+        out_.append("true", 4);
+      } else {
+        out_.append("false", 5);
+      }
       break;
     case dynamic::NULLT:
-      out_ += "null";
+      out_.append("null", 4);
       break;
     case dynamic::STRING:
-      escapeString(v.asString(), out_, opts_);
+      escapeStringTo(v.stringPiece(), out_, opts_);
       break;
     case dynamic::OBJECT:
       printObject(v);
@@ -165,7 +430,48 @@ struct Printer {
   }
 
 private:
-  void printKV(const std::pair<const dynamic, dynamic>& p) const {
+  typedef std::pair<const dynamic, dynamic> Item;
+
+  void printInt(int64_t value) const {
+    char buffer[20];
+    if (value < 0) {
+      out_.push_back('-');
+      out_.append(buffer, uint64ToBufferUnsafe(-uint64_t(value), buffer));
+    } else {
+      out_.append(buffer, uint64ToBufferUnsafe(value, buffer));
+    }
+  }
+
+  // As toAppend(double, ...)
+  void printDouble(double value) const {
+    using namespace double_conversion;
+    if (opts_.double_mode == DoubleToStringConverter::SHORTEST) {
+      char buffer[kMaxDoubleToBufferLength];
+      out_.append(buffer, doubleToBufferUnsafe(value, buffer));
+      return;
+    }
+    DoubleToStringConverter
+      conv(DoubleToStringConverter::NO_FLAGS,
+           "Infinity", "NaN", 'E',
+           detail::kConvMaxDecimalInShortestLow,
+           detail::kConvMaxDecimalInShortestHigh,
+           6,   // max leading padding zeros
+           1);  // max trailing padding zeros
+    char buffer[256];
+    StringBuilder builder(buffer, sizeof(buffer));
+    switch (opts_.double_mode) {
+      case DoubleToStringConverter::FIXED:
+        conv.ToFixed(value, opts_.double_num_digits, &builder);
+        break;
+      default:
+        CHECK(opts_.double_mode == DoubleToStringConverter::PRECISION);
+        conv.ToPrecision(value, opts_.double_num_digits, &builder);
+        break;
+    }
+    out_.append(buffer, builder.position());
+  }
+
+  void printKV(const Item& p) const {
     if (!opts_.allow_non_string_keys && !p.first.isString()) {
       throw std::runtime_error("folly::toJson: JSON object key was not a "
         "string");
@@ -175,56 +481,66 @@ private:
     (*this)(p.second);
   }
 
-  template <typename Iterator>
-  void printKVPairs(Iterator begin, Iterator end) const {
-    printKV(*begin);
-    for (++begin; begin != end; ++begin) {
-      out_ += ',';
-      newline();
-      printKV(*begin);
-    }
-  }
-
   void printObject(dynamic const& o) const {
     if (o.empty()) {
-      out_ += "{}";
+      out_.append("{}", 2);
       return;
     }
 
-    out_ += '{';
+    out_.push_back('{');
     indent();
     newline();
+    bool first = true;
+    auto print = [&](const Item& item) {
+      if (!first) {
+        out_.push_back(',');
+        newline();
+      }
+      first = false;
+      printKV(item);
+    };
     if (opts_.sort_keys) {
-      std::vector<std::pair<dynamic, dynamic>> items(
-        o.items().begin(), o.items().end());
-      std::sort(items.begin(), items.end());
-      printKVPairs(items.begin(), items.end());
+      // sort pointers to the items, not copies of them
+      std::vector<const Item*> items;
+      items.reserve(o.size());
+      for (auto& item : o.items()) {
+        items.push_back(&item);
+      }
+      std::sort(items.begin(), items.end(),
+                [](const Item* a, const Item* b) {
+                  return a->first < b->first;
+                });
+      for (auto item : items) {
+        print(*item);
+      }
     } else {
-      printKVPairs(o.items().begin(), o.items().end());
+      for (auto& item : o.items()) {
+        print(item);
+      }
     }
     outdent();
     newline();
-    out_ += '}';
+    out_.push_back('}');
   }
 
   void printArray(dynamic const& a) const {
     if (a.empty()) {
-      out_ += "[]";
+      out_.append("[]", 2);
       return;
     }
 
-    out_ += '[';
+    out_.push_back('[');
     indent();
     newline();
     (*this)(a[0]);
     for (auto& val : range(boost::next(a.begin()), a.end())) {
-      out_ += ',';
+      out_.push_back(',');
       newline();
       (*this)(val);
     }
     outdent();
     newline();
-    out_ += ']';
+    out_.push_back(']');
   }
 
 private:
@@ -242,20 +558,35 @@ private:
 
   void newline() const {
     if (indentLevel_) {
-      out_ += to<fbstring>('\n', fbstring(*indentLevel_ * 2, ' '));
+      out_.push_back('\n');
+      out_.append(*indentLevel_ * 2, ' ');
     }
   }
 
   void mapColon() const {
-    out_ += indentLevel_ ? " : " : ":";
+    if (indentLevel_) {
+      out_.append(" : ", 3);
+    } else {
+      out_.push_back(':');
+    }
   }
 
 private:
-  fbstring& out_;
+  Out& out_;
   unsigned* const indentLevel_;
   serialization_opts const& opts_;
 };
 
+template <class Out>
+void serializeTo(dynamic const& dyn, serialization_opts const& opts,
+                 Out& out) {
+  out.reserve(estimateSize(dyn, opts));
+  unsigned indentLevel = 0;
+  Printer<Out> p(out, opts.pretty_formatting ? &indentLevel : nullptr, &opts);
+  p(dyn);
+  out.finish();
+}
+
   //////////////////////////////////////////////////////////////////////
 
   struct ParseError : std::runtime_error {
@@ -624,84 +955,29 @@ dynamic parseValue(Input& in) {
 
 fbstring serialize(dynamic const& dyn, serialization_opts const& opts) {
   fbstring ret;
-  unsigned indentLevel = 0;
-  Printer p(ret, opts.pretty_formatting ? &indentLevel : nullptr, &opts);
-  p(dyn);
+  serialize(dyn, opts, ret);
   return ret;
 }
 
+void serialize(dynamic const& dyn, serialization_opts const& opts,
+               fbstring& out) {
+  StringOut o(out);
+  serializeTo(dyn, opts, o);
+}
+
+void serialize(dynamic const& dyn, serialization_opts const& opts,
+               IOBufQueue& out) {
+  QueueOut o(out);
+  serializeTo(dyn, opts, o);
+}
+
 // Escape a string so that it is legal to print it in JSON text.
 void escapeString(StringPiece input,
                   fbstring& out,
                   const serialization_opts& opts) {
-  auto hexDigit = [] (int c) -> char {
-    return c < 10 ? c + '0' : c - 10 + 'a';
-  };
-
-  out.reserve(out.size() + input.size() + 2);
-  out.push_back('\"');
-
-  auto* p = reinterpret_cast<const unsigned char*>(input.begin());
-  auto* q = reinterpret_cast<const unsigned char*>(input.begin());
-  auto* e = reinterpret_cast<const unsigned char*>(input.end());
-
-  while (p < e) {
-    // Since non-ascii encoding inherently does utf8 validation
-    // we explicitly validate utf8 only if non-ascii encoding is disabled.
-    if ((opts.validate_utf8 || opts.skip_invalid_utf8)
-        && !opts.encode_non_ascii) {
-      // to achieve better spatial and temporal coherence
-      // we do utf8 validation progressively along with the
-      // string-escaping instead of two separate passes
-
-      // as the encoding progresses, q will stay at or ahead of p
-      CHECK(q >= p);
-
-      // as p catches up with q, move q forward
-      if (q == p) {
-        // calling utf8_decode has the side effect of
-        // checking that utf8 encodings are valid
-        char32_t v = decodeUtf8(q, e, opts.skip_invalid_utf8);
-        if (opts.skip_invalid_utf8 && v == U'\ufffd') {
-          out.append("\ufffd");
-          p = q;
-          continue;
-        }
-      }
-    }
-    if (opts.encode_non_ascii && (*p & 0x80)) {
-      // note that this if condition captures utf8 chars
-      // with value > 127, so size > 1 byte
-      char32_t v = decodeUtf8(p, e, opts.skip_invalid_utf8);
-      out.append("\\u");
-      out.push_back(hexDigit(v >> 12));
-      out.push_back(hexDigit((v >> 8) & 0x0f));
-      out.push_back(hexDigit((v >> 4) & 0x0f));
-      out.push_back(hexDigit(v & 0x0f));
-    } else if (*p == '\\' || *p == '\"') {
-      out.push_back('\\');
-      out.push_back(*p++);
-    } else if (*p <= 0x1f) {
-      switch (*p) {
-        case '\b': out.append("\\b"); p++; break;
-        case '\f': out.append("\\f"); p++; break;
-        case '\n': out.append("\\n"); p++; break;
-        case '\r': out.append("\\r"); p++; break;
-        case '\t': out.append("\\t"); p++; break;
-        default:
-          // note that this if condition captures non readable chars
-          // with value < 32, so size = 1 byte (e.g control chars).
-          out.append("\\u00");
-          out.push_back(hexDigit((*p & 0xf0) >> 4));
-          out.push_back(hexDigit(*p & 0xf));
-          p++;
-      }
-    } else {
-      out.push_back(*p++);
-    }
-  }
-
-  out.push_back('\"');
+  StringOut o(out);
+  o.reserve(input.size() + 2);
+  escapeStringTo(input, o, opts);
 }
 
 fbstring stripComments(StringPiece jsonC) {
@@ -775,6 +1051,17 @@ dynamic parseJson(
     StringPiece range,
     json::serialization_opts const& opts) {
 
+  dynamic ret = nullptr;
+  if (detail::parseJsonStructural(range, ret)) {
+    return ret;
+  }
+  return detail::parseJsonRecursive(range, opts);
+}
+
+dynamic detail::parseJsonRecursive(
+    StringPiece range,
+    json::serialization_opts const& opts) {
+
   json::Input in(range, &opts);
 
   auto ret = parseValue(in);
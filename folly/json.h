@@ -47,6 +47,8 @@
 
 namespace folly {
 
+class IOBufQueue;
+
 //////////////////////////////////////////////////////////////////////
 
 namespace json {
@@ -113,6 +115,14 @@ namespace json {
    */
   fbstring serialize(dynamic const&, serialization_opts const&);
 
+  /*
+   * As above, appending to out: a buffer reused between calls, or the
+   * tail of a queue (in buffers reserved for the estimated size of the
+   * output, so that a response is mostly in one of them).
+   */
+  void serialize(dynamic const&, serialization_opts const&, fbstring& out);
+  void serialize(dynamic const&, serialization_opts const&, IOBufQueue& out);
+
   /*
    * Escape a string so that it is legal to print it in JSON text and
    * append the result to out.
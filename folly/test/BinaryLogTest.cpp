@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/ext/BinaryLog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+#include <folly/FileUtil.h>
+#include <folly/Range.h>
+#include <folly/String.h>
+#include <folly/experimental/TestUtil.h>
+
+#if !(FOLLY_HAVE_LIBGLOG && FOLLY_USE_GLOG)
+
+using namespace folly;
+using namespace folly::logging;
+using namespace folly::logging::detail;
+
+namespace {
+
+template <class T>
+std::string raw(T value) {
+  return std::string(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::string record(uint32_t id, const std::string& body) {
+  return raw(uint32_t(kRecordHeaderSize + body.size())) + raw(id) + body;
+}
+
+std::string sessionRecord() {
+  return record(kSessionId, raw(kBinaryLogMagic) + raw(kBinaryLogVersion));
+}
+
+std::string formatRecord(uint32_t id, uint32_t level, const char* format) {
+  std::string body = raw(level) + raw(uint32_t(42));
+  body.append("test.cpp", sizeof("test.cpp"));
+  body.append(format, strlen(format) + 1);
+  return record(id | kFormatBit, body);
+}
+
+std::string messageRecord(uint32_t id, const std::string& args) {
+  return record(id, raw(uint64_t(0)) + args);
+}
+
+std::string decodeAll(const std::string& data) {
+  BinaryLogDecoder decoder;
+  std::string out;
+  EXPECT_EQ(data.size(), decoder.decode(data.data(), data.size(), out));
+  return out;
+}
+
+// The messages of the decoded lines, without level, time and location
+std::vector<std::string> messagesOf(const std::string& text) {
+  std::vector<StringPiece> lines;
+  split('\n', text, lines);
+  std::vector<std::string> messages;
+  for (auto line : lines) {
+    if (!line.empty()) {
+      messages.push_back(line.subpiece(line.find("] ") + 2).str());
+    }
+  }
+  return messages;
+}
+
+// Run fn in a child process, with the binary LogWriter singleton writing
+// to path, and return its wait status.
+int runWithBinaryLogger(const std::string& path,
+                        bool async,
+                        std::function<void()> fn,
+                        size_t capacity = DEFAULT_ASYNC_CAPACITY) {
+  pid_t pid = fork();
+  if (pid == 0) {
+    initializeBinary(Level::INFO, path.c_str(), async, capacity);
+    fn();
+    getBinary()->flush();
+    _exit(0);
+  }
+  int status = -1;
+  if (pid > 0) {
+    waitpid(pid, &status, 0);
+  }
+  return status;
+}
+
+} // namespace
+
+TEST(BinaryLog, RoundTrip) {
+  test::TemporaryFile file;
+  int status = runWithBinaryLogger(file.path().c_str(), false, [] {
+    std::string str("string");
+    for (int i = 0; i < 2; ++i) {
+      BLOG(INFO, "int %d, unsigned %05u, hex %#lx, char %c",
+           -i, 42u, 255ul, 'x');
+      BLOG(WARN, "double %.2f %g, %s %s %s|%-4s|",
+           1.5, 1e10, str, StringPiece("piece"), "chars", "ab");
+      BLOG(DEBUG, "filtered");
+      BLOG(ERROR, "100%% %p missing %d", (void*)0x1234);
+    }
+    BLOG(INFO, "no arguments");
+    BLOG(INFO, "star |%*d|%-*s|%.*f|%.*f|%*.*s|",
+         5, 42, 4, "ab", 2, 3.14159, -1, 0.5, 4, 2, "abc");
+  });
+  EXPECT_TRUE(WIFEXITED(status));
+
+  std::string data;
+  ASSERT_TRUE(readFile(file.path().c_str(), data));
+  std::string text = decodeAll(data);
+  EXPECT_EQ(0, text.find("[I "));
+  EXPECT_NE(std::string::npos, text.find("BinaryLogTest.cpp:"));
+
+  std::vector<std::string> expected = {
+    "int 0, unsigned 00042, hex 0xff, char x",
+    "double 1.50 1e+10, string piece chars|ab  |",
+    "100% 0x1234 missing <missing>",
+    "int -1, unsigned 00042, hex 0xff, char x",
+    "double 1.50 1e+10, string piece chars|ab  |",
+    "100% 0x1234 missing <missing>",
+    "no arguments",
+    "star |   42|ab  |3.14|0.500000|  ab|",
+  };
+  EXPECT_EQ(expected, messagesOf(text));
+
+  // records split at any point are decoded once complete
+  for (size_t split = 0; split <= data.size(); split += 7) {
+    BinaryLogDecoder decoder;
+    std::string out;
+    size_t n = decoder.decode(data.data(), split, out);
+    EXPECT_GE(split, n);
+    std::string rest = data.substr(n);
+    EXPECT_EQ(rest.size(), decoder.decode(rest.data(), rest.size(), out));
+    EXPECT_EQ(text, out);
+  }
+}
+
+TEST(BinaryLog, Levels) {
+  std::string data = sessionRecord();
+  const char* names = "FACEWNIDTN";
+  for (uint32_t level = 0; level <= uint32_t(Level::NOTSET); ++level) {
+    data += formatRecord(level + 1, level, "message");
+    data += messageRecord(level + 1, "");
+  }
+  std::vector<StringPiece> lines;
+  std::string text = decodeAll(data);
+  split('\n', text, lines);
+  ASSERT_EQ(11, lines.size());
+  for (size_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(names[i], lines[i][1]);
+  }
+}
+
+TEST(BinaryLog, Truncated) {
+  std::string header = sessionRecord() + formatRecord(1, 6, "%d %s");
+  std::string args = std::string(1, kArgInt) + raw(int64_t(7)) +
+                     std::string(1, kArgString) + raw(uint16_t(3)) + "abc";
+  EXPECT_EQ(std::vector<std::string>{"7 abc"},
+            messagesOf(decodeAll(header + messageRecord(1, args))));
+
+  // the record size covers only part of an argument
+  for (size_t n = 1; n < args.size(); ++n) {
+    if (n == 9) {
+      continue;   // the string argument is missing entirely
+    }
+    std::string data = header + messageRecord(1, args.substr(0, n));
+    BinaryLogDecoder decoder;
+    std::string out;
+    EXPECT_THROW(decoder.decode(data.data(), data.size(), out),
+                 std::runtime_error);
+  }
+
+  // truncated formats
+  std::string format = formatRecord(1, 6, "%d");
+  for (size_t n = kRecordHeaderSize; n < format.size(); ++n) {
+    std::string data = sessionRecord() +
+                       record(1 | kFormatBit,
+                              format.substr(kRecordHeaderSize,
+                                            n - kRecordHeaderSize));
+    BinaryLogDecoder decoder;
+    std::string out;
+    EXPECT_THROW(decoder.decode(data.data(), data.size(), out),
+                 std::runtime_error);
+  }
+}
+
+TEST(BinaryLog, Invalid) {
+  std::string header = sessionRecord() + formatRecord(1, 6, "%d");
+  std::vector<std::string> invalid = {
+    // bad argument tags
+    header + messageRecord(1, "x" + raw(int64_t(1))),
+    header + messageRecord(1, std::string(1, '\0')),
+    // bad levels
+    sessionRecord() + formatRecord(1, uint32_t(Level::NOTSET) + 1, "%d"),
+    sessionRecord() + formatRecord(1, uint32_t(-1), "%d"),
+    // not an int for '*'
+    sessionRecord() + formatRecord(1, 6, "%*d") +
+      messageRecord(1, std::string(1, kArgDouble) + raw(1.0)),
+    // bad magic
+    record(kSessionId, raw(uint32_t(0)) + raw(kBinaryLogVersion)),
+    // bad record sizes
+    raw(uint32_t(4)) + raw(kSessionId),
+    raw(uint32_t(BUF_SIZE + 1)) + raw(kSessionId),
+  };
+  for (auto& data : invalid) {
+    BinaryLogDecoder decoder;
+    std::string out;
+    EXPECT_THROW(decoder.decode(data.data(), data.size(), out),
+                 std::runtime_error);
+  }
+
+}
+
+TEST(BinaryLog, UnknownFormat) {
+  // messages whose format is lost are placeholders, the others decoded
+  std::string header = sessionRecord() + formatRecord(1, 6, "%d");
+  std::string arg = std::string(1, kArgInt) + raw(int64_t(7));
+  std::string data = header + messageRecord(2, arg) + messageRecord(1, arg) +
+                     sessionRecord() + messageRecord(1, arg);
+  std::string text = decodeAll(data);
+  EXPECT_EQ(0, text.find("[? "));
+  std::vector<std::string> expected = {
+    "<unknown format id 2>", "7", "<unknown format id 1>",
+  };
+  EXPECT_EQ(expected, messagesOf(text));
+}
+
+TEST(BinaryLog, FormatWhenFull) {
+  // The flusher is stalled by a slow reopen callback, so that the ring of
+  // 2 slots stays full while a call site registers: its format record is
+  // written anyway
+  test::TemporaryFile file;
+  int status = runWithBinaryLogger(file.path().c_str(), true, [] {
+    getBinary()->setReopenCallback([] {
+      /* sleep override */ usleep(50000);
+    });
+    std::thread([] {
+      while (true) {
+        BLOG(INFO, "busy");
+      }
+    }).detach();
+    std::thread([] { getBinary()->reopen(); }).detach();
+    /* sleep override */ usleep(10000);
+    auto end = std::chrono::steady_clock::now() +
+               std::chrono::milliseconds(100);
+    while (std::chrono::steady_clock::now() < end) {
+      BLOG(INFO, "late");
+    }
+  }, 2);
+  EXPECT_TRUE(WIFEXITED(status));
+
+  std::string data;
+  ASSERT_TRUE(readFile(file.path().c_str(), data));
+  auto messages = messagesOf(decodeAll(data));
+  EXPECT_LT(0, std::count(messages.begin(), messages.end(), "late"));
+  EXPECT_EQ(messages.end(),
+            std::find_if(messages.begin(), messages.end(),
+                         [] (const std::string& m) {
+                           return m != "busy" && m != "late";
+                         }));
+}
+
+#endif
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return RUN_ALL_TESTS();
+}
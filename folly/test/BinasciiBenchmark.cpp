@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/ext/Binascii.h>
+
+#include <random>
+#include <string>
+
+using namespace std;
+using namespace folly;
+
+namespace {
+
+string makeData(size_t n) {
+  std::mt19937 rng(42);
+  string s(n, '\0');
+  for (auto& c : s) {
+    c = rng();
+  }
+  return s;
+}
+
+const string data = makeData(64 * 1024);
+const string encoded = base64Encode<string>(data);
+const string encodedMime = base64Encode<string>(data, BASE64_MIME);
+
+// one character at a time, as the lenient decoder did
+string scalarDecode(StringPiece str) {
+  string out;
+  uint32_t value = 0;
+  int bits = 0;
+  for (uint8_t c : str) {
+    if (c > 0x7f || detail::b64DecodeTable[c] == -1) {
+      continue;
+    }
+    value = (value << 6) | detail::b64DecodeTable[c];
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      out.push_back((value >> bits) & 0xff);
+    }
+  }
+  return out;
+}
+
+} // namespace
+
+BENCHMARK(base64Decode_scalar, iters) {
+  for (size_t i = 0; i < iters; ++i) {
+    auto r = scalarDecode(encoded);
+    doNotOptimizeAway(r);
+  }
+}
+
+BENCHMARK_RELATIVE(base64Decode, iters) {
+  for (size_t i = 0; i < iters; ++i) {
+    auto r = base64Decode<string>(encoded);
+    doNotOptimizeAway(r);
+  }
+}
+
+BENCHMARK_RELATIVE(base64DecodeStrict, iters) {
+  for (size_t i = 0; i < iters; ++i) {
+    auto r = base64DecodeStrict<string>(encoded);
+    doNotOptimizeAway(r);
+  }
+}
+
+BENCHMARK_RELATIVE(base64Decode_mime, iters) {
+  for (size_t i = 0; i < iters; ++i) {
+    auto r = base64Decode<string>(encodedMime);
+    doNotOptimizeAway(r);
+  }
+}
+
+BENCHMARK_DRAW_LINE()
+
+BENCHMARK(base64Encode, iters) {
+  for (size_t i = 0; i < iters; ++i) {
+    auto r = base64Encode<string>(data);
+    doNotOptimizeAway(r);
+  }
+}
+
+BENCHMARK_RELATIVE(base64Encode_mime, iters) {
+  for (size_t i = 0; i < iters; ++i) {
+    auto r = base64Encode<string>(data, BASE64_MIME);
+    doNotOptimizeAway(r);
+  }
+}
+
+BENCHMARK_RELATIVE(base32Encode, iters) {
+  for (size_t i = 0; i < iters; ++i) {
+    auto r = base32Encode<string>(data);
+    doNotOptimizeAway(r);
+  }
+}
+
+int main(int argc, char** argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
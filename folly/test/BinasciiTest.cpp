@@ -0,0 +1,325 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/ext/Binascii.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+#include <folly/FBString.h>
+
+using namespace folly;
+using folly::detail::Base64Kernels;
+using folly::detail::SimdLevel;
+
+namespace {
+
+std::string makeData(size_t n, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::string s(n, '\0');
+  for (auto& c : s) {
+    c = rng();
+  }
+  return s;
+}
+
+std::string toString(const IOBufQueue& queue) {
+  if (queue.empty()) {
+    return "";
+  }
+  return queue.front()->clone()->moveToFbString().toStdString();
+}
+
+const int kBase64Flags[] = {
+  BASE64_DEFAULT,
+  BASE64_URL,
+  BASE64_NO_PADDING,
+  BASE64_URL | BASE64_NO_PADDING,
+  BASE64_MIME,
+  BASE64_MIME | BASE64_URL | BASE64_NO_PADDING,
+};
+
+class Base64KernelTest : public testing::TestWithParam<SimdLevel> {
+ protected:
+  void SetUp() override {
+    supported_ = folly::detail::simdLevelSupported(GetParam());
+    scalar_ = folly::detail::base64Kernels(SimdLevel::NONE);
+    kernels_ = folly::detail::base64Kernels(GetParam());
+  }
+
+  // Compare the decoding of s, which stops at the first invalid quantum
+  void checkDecode(const std::string& s, bool url) {
+    std::string expected(s.size() / 4 * 3, '\0');
+    std::string out(s.size() / 4 * 3, '\0');
+    size_t n = scalar_.decode(s.data(), s.size(), &expected[0], url);
+    ASSERT_EQ(n, kernels_.decode(s.data(), s.size(), &out[0], url)) << s;
+    ASSERT_EQ(0, n % 4);
+    ASSERT_EQ(expected.substr(0, n / 4 * 3), out.substr(0, n / 4 * 3));
+  }
+
+  bool supported_;
+  Base64Kernels scalar_;
+  Base64Kernels kernels_;
+};
+
+} // namespace
+
+TEST_P(Base64KernelTest, Encode) {
+  if (!supported_) {
+    return;
+  }
+  for (bool url : {false, true}) {
+    for (size_t n = 0; n <= 200; ++n) {
+      auto data = makeData(n, n);
+      auto in = reinterpret_cast<const uint8_t*>(data.data());
+      std::string expected(n / 3 * 4, '\0');
+      std::string out(n / 3 * 4, '\0');
+      size_t m = scalar_.encode(in, n, &expected[0], url);
+      ASSERT_EQ(n / 3 * 3, m);
+      ASSERT_EQ(m, kernels_.encode(in, n, &out[0], url));
+      ASSERT_EQ(expected, out);
+    }
+  }
+}
+
+TEST_P(Base64KernelTest, Decode) {
+  if (!supported_) {
+    return;
+  }
+  for (bool url : {false, true}) {
+    int flags = url ? BASE64_URL : BASE64_DEFAULT;
+    for (size_t n = 0; n <= 200; ++n) {
+      auto data = makeData(n, n);
+      auto encoded = base64Encode<std::string>(data, flags);
+      checkDecode(encoded, url);
+      // truncated, and with an invalid character at every position
+      checkDecode(encoded.substr(0, encoded.size() / 2), url);
+      for (size_t i = 0; i < encoded.size(); ++i) {
+        for (char c : {'\0', '\n', '*', '=', url ? '+' : '-', '\x80'}) {
+          std::string s = encoded;
+          s[i] = c;
+          checkDecode(s, url);
+        }
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Base64KernelTest,
+    Base64KernelTest,
+    testing::Values(SimdLevel::NONE, SimdLevel::SSSE3, SimdLevel::AVX2));
+
+TEST(Base64, Vectors) {
+  // RFC 4648
+  std::vector<std::pair<std::string, std::string>> vectors = {
+    {"", ""}, {"f", "Zg=="}, {"fo", "Zm8="}, {"foo", "Zm9v"},
+    {"foob", "Zm9vYg=="}, {"fooba", "Zm9vYmE="}, {"foobar", "Zm9vYmFy"},
+  };
+  for (auto& v : vectors) {
+    EXPECT_EQ(v.second, base64Encode<std::string>(v.first));
+    EXPECT_EQ(v.first, base64Decode<std::string>(v.second));
+    EXPECT_EQ(v.first, base64DecodeStrict<std::string>(v.second));
+    std::string unpadded = v.second.substr(0, v.second.find('='));
+    EXPECT_EQ(unpadded,
+              base64Encode<std::string>(v.first, BASE64_NO_PADDING));
+    EXPECT_EQ(v.first,
+              base64DecodeStrict<std::string>(unpadded, BASE64_NO_PADDING));
+  }
+  EXPECT_EQ("-_-_", base64Encode<std::string>("\xfb\xff\xbf", BASE64_URL));
+  EXPECT_EQ("+/+/", base64Encode<std::string>("\xfb\xff\xbf"));
+}
+
+TEST(Base64, RoundTrip) {
+  for (int flags : kBase64Flags) {
+    for (size_t n : {0, 1, 2, 3, 4, 5, 56, 57, 58, 100, 1000, 100000}) {
+      auto data = makeData(n, n);
+      auto encoded = base64Encode<std::string>(data, flags);
+      EXPECT_EQ(base64EncodedSize(n, flags), encoded.size());
+      EXPECT_EQ(data, base64DecodeStrict<std::string>(encoded, flags));
+      EXPECT_EQ(data, base64DecodeStrict<fbstring>(encoded, flags));
+      if (!(flags & BASE64_URL)) {
+        EXPECT_EQ(data, base64Decode<std::string>(encoded));
+      }
+      // appended to what out holds
+      std::string out = "prefix";
+      base64DecodeStrict(encoded, out, flags);
+      EXPECT_EQ("prefix" + data, out);
+    }
+  }
+}
+
+TEST(Base64, Mime) {
+  auto data = makeData(1000, 1);
+  auto encoded = base64Encode<std::string>(data, BASE64_MIME);
+  size_t pos = 0;
+  for (size_t i = encoded.find("\r\n"); i != std::string::npos;
+       i = encoded.find("\r\n", pos)) {
+    EXPECT_EQ(76, i - pos);
+    pos = i + 2;
+  }
+  EXPECT_GE(76, encoded.size() - pos);
+  EXPECT_EQ(data, base64Decode<std::string>(encoded));
+  EXPECT_EQ(data, base64DecodeStrict<std::string>(encoded, BASE64_MIME));
+  EXPECT_THROW(base64DecodeStrict<std::string>(encoded), BinasciiError);
+}
+
+TEST(Base64, Lenient) {
+  // characters out of the alphabet are skipped wherever they are
+  auto data = makeData(300, 2);
+  auto encoded = base64Encode<std::string>(data);
+  std::mt19937 rng(3);
+  for (int i = 0; i < 100; ++i) {
+    std::string noisy;
+    for (char c : encoded) {
+      while (rng() % 8 == 0) {
+        noisy += " \r\n\t*\x80"[rng() % 6];
+      }
+      noisy += c;
+    }
+    EXPECT_EQ(data, base64Decode<std::string>(noisy));
+  }
+  EXPECT_EQ("foob", base64Decode<std::string>("Zm9vYg"));
+  EXPECT_EQ("", base64Decode<std::string>("=\n*"));
+}
+
+TEST(Base64, Invalid) {
+  std::vector<std::pair<std::string, size_t>> invalid = {
+    {"Zm9v*mFy", 4},        // not in the alphabet
+    {"Zm9vYmF", 7},         // truncated
+    {"Zm9vY===", 5},        // too much padding
+    {"Zm9vYg=", 7},
+    {"Zm9vYh==", 5},        // unused bits
+    {"Zm9vYg==Zm9v", 8},    // after the padding
+    {"Zm9v\nYmFy", 4},      // not MIME
+    {"Zm9v-mFy", 4},        // URL alphabet
+    {std::string(100, 'A') + "*", 100},
+  };
+  for (auto& v : invalid) {
+    try {
+      base64DecodeStrict<std::string>(v.first);
+      ADD_FAILURE() << v.first;
+    } catch (const BinasciiError& e) {
+      EXPECT_EQ(v.second, e.position()) << v.first;
+    }
+    // out is left as it was
+    std::string out = "prefix";
+    EXPECT_THROW(base64DecodeStrict(v.first, out), BinasciiError);
+    EXPECT_EQ("prefix", out);
+  }
+  EXPECT_THROW(base64DecodeStrict<std::string>("Zm9vYg==", BASE64_NO_PADDING),
+               BinasciiError);
+  EXPECT_THROW(base64DecodeStrict<std::string>("Zm9v+mFy", BASE64_URL),
+               BinasciiError);
+}
+
+TEST(Base64, Incremental) {
+  for (int flags : kBase64Flags) {
+    auto data = makeData(1000, flags);
+    auto encoded = base64Encode<std::string>(data, flags);
+    for (size_t split : {0, 1, 2, 3, 77, 78, 500, 999, 1000}) {
+      Base64Encoder encoder(flags);
+      IOBufQueue out;
+      encoder.encode(ByteRange(StringPiece(data).subpiece(0, split)), out);
+      encoder.encode(ByteRange(StringPiece(data).subpiece(split)), out);
+      encoder.finish(out);
+      EXPECT_EQ(encoded, toString(out));
+
+      split = std::min(split, encoded.size());
+      Base64Decoder decoder(flags);
+      IOBufQueue decoded;
+      auto chain = IOBuf::copyBuffer(encoded.data(), split);
+      chain->prependChain(IOBuf::copyBuffer(encoded.data() + split,
+                                            encoded.size() - split));
+      decoder.decode(*chain, decoded);
+      decoder.finish(decoded);
+      EXPECT_EQ(data, toString(decoded));
+    }
+  }
+
+  // errors are at offsets of the stream
+  Base64Decoder decoder;
+  IOBufQueue out;
+  decoder.decode(StringPiece("Zm9v"), out);
+  try {
+    decoder.decode(StringPiece("Ym*y"), out);
+    ADD_FAILURE();
+  } catch (const BinasciiError& e) {
+    EXPECT_EQ(6, e.position());
+  }
+}
+
+TEST(Base32, RoundTrip) {
+  // RFC 4648
+  std::vector<std::pair<std::string, std::string>> vectors = {
+    {"", ""}, {"f", "MY======"}, {"fo", "MZXQ===="}, {"foo", "MZXW6==="},
+    {"foob", "MZXW6YQ="}, {"fooba", "MZXW6YTB"},
+    {"foobar", "MZXW6YTBOI======"},
+  };
+  for (auto& v : vectors) {
+    EXPECT_EQ(v.second, base32Encode<std::string>(v.first));
+    EXPECT_EQ(v.first, base32Decode<std::string>(v.second));
+    EXPECT_EQ(v.first, base32DecodeStrict<std::string>(v.second));
+    std::string unpadded = v.second.substr(0, v.second.find('='));
+    EXPECT_EQ(unpadded, base32Encode<std::string>(v.first, false));
+    EXPECT_EQ(v.first, base32DecodeStrict<std::string>(unpadded, false));
+  }
+  for (size_t n = 0; n < 100; ++n) {
+    auto data = makeData(n, n);
+    auto encoded = base32Encode<std::string>(data);
+    EXPECT_EQ(data, base32DecodeStrict<std::string>(encoded));
+    EXPECT_EQ(data, base32Decode<std::string>(encoded));
+  }
+}
+
+TEST(Base32, Invalid) {
+  std::vector<std::pair<std::string, size_t>> invalid = {
+    {"MZXW6YT1", 7},        // not in the alphabet
+    {"mzxw6ytb", 0},        // lower case
+    {"MZXW6", 5},           // truncated
+    {"MZX=====", 3},        // 3 characters
+    {"MZ======MZ======", 8},
+    {"MZ=", 3},
+    {"MZ======", 1},        // unused bits
+  };
+  for (auto& v : invalid) {
+    try {
+      base32DecodeStrict<std::string>(v.first);
+      ADD_FAILURE() << v.first;
+    } catch (const BinasciiError& e) {
+      EXPECT_EQ(v.second, e.position()) << v.first;
+    }
+    std::string out = "prefix";
+    EXPECT_THROW(base32DecodeStrict(v.first, out), BinasciiError);
+    EXPECT_EQ("prefix", out);
+  }
+}
+
+TEST(Rot13, RoundTrip) {
+  EXPECT_EQ("Uryyb, Jbeyq! 123", rot13Decode<std::string>("Hello, World! 123"));
+  auto data = makeData(256, 5);
+  EXPECT_EQ(data, rot13Decode<std::string>(rot13Decode<std::string>(data)));
+}
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/CompiledFormat.h>
+
+#include <limits>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+using namespace folly;
+
+TEST(CompiledFormat, Simple) {
+  EXPECT_EQ("hello", sformat(FOLLY_FMT("hello")));
+  EXPECT_EQ("", sformat(FOLLY_FMT("")));
+  EXPECT_EQ("42", sformat(FOLLY_FMT("{}"), 42));
+  EXPECT_EQ("42 42", sformat(FOLLY_FMT("{0} {0}"), 42));
+  EXPECT_EQ("hello world hello 42",
+            sformat(FOLLY_FMT("{0} {1} {0} {2}"), "hello", "world", 42));
+  EXPECT_EQ("{42}", sformat(FOLLY_FMT("{{{}}}"), 42));
+  EXPECT_EQ("a}b{c", sformat(FOLLY_FMT("a}}b{{c")));
+
+  std::string s("str");
+  const fbstring fbs("fbstr");
+  const char* null = nullptr;
+  EXPECT_EQ("str fbstr sp (null) true *",
+            sformat(FOLLY_FMT("{} {} {} {} {} {}"),
+                    s, fbs, StringPiece("sp"), null, true, '*'));
+
+  EXPECT_EQ("-128 255 -9223372036854775808 18446744073709551615",
+            sformat(FOLLY_FMT("{} {} {} {}"),
+                    std::numeric_limits<int8_t>::min(),
+                    std::numeric_limits<uint8_t>::max(),
+                    std::numeric_limits<int64_t>::min(),
+                    std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(CompiledFormat, Specs) {
+  EXPECT_EQ("00042  23   42", sformat(FOLLY_FMT("{0:05} {1:3} {0:4}"), 42, 23));
+  EXPECT_EQ("XXhelloXX", sformat(FOLLY_FMT("{:X^9}"), "hello"));
+  EXPECT_EQ("-0xYYYY2a", sformat(FOLLY_FMT("{:Y=#9x}"), -42));
+  EXPECT_EQ("1.5 2.50", sformat(FOLLY_FMT("{} {:.2f}"), 1.5, 2.5));
+
+  std::vector<int> v {10, 20, 30};
+  std::map<std::string, int> m {{"hello", 0}, {"world", 1}};
+  EXPECT_EQ("0020 1", sformat(FOLLY_FMT("{0[1]:04} {1[world]}"), v, m));
+  EXPECT_THROW(sformat(FOLLY_FMT("{[3]}"), v), std::out_of_range);
+  EXPECT_THROW(sformat(FOLLY_FMT("{:d}"), "hello"), BadFormatArg);
+  EXPECT_THROW(sformat(FOLLY_FMT("{:*}"), 3), BadFormatArg);
+}
+
+TEST(CompiledFormat, SameAsFormat) {
+  for (int i = -1000; i < 1000; i += 7) {
+    EXPECT_EQ(sformat("{} {:x} {:>8} {:+}", i, i, "x", i),
+              sformat(FOLLY_FMT("{} {:x} {:>8} {:+}"), i, i, "x", i));
+  }
+}
+
+TEST(CompiledFormat, Output) {
+  std::string out("> ");
+  format(&out, FOLLY_FMT("{} {}"), 1, "2");
+  format(&out, FOLLY_FMT(" {}"), 3);
+  EXPECT_EQ("> 1 2 3", out);
+
+  fbstring fbout;
+  format(&fbout, FOLLY_FMT("{}-{}"), 1, 2);
+  EXPECT_EQ("1-2", fbout);
+  EXPECT_EQ("1-2", format(FOLLY_FMT("{}-{}"), 1, 2).fbstr());
+
+  std::ostringstream os;
+  os << format(FOLLY_FMT("[{}]"), 42);
+  EXPECT_EQ("[42]", os.str());
+
+  EXPECT_EQ("x1 2", to<std::string>("x", format(FOLLY_FMT("{} {}"), 1, 2)));
+}
+
+TEST(CompiledFormat, Nested) {
+  EXPECT_EQ("1 2 3 4",
+            sformat(FOLLY_FMT("{} {} {}"),
+                    1, 2, format(FOLLY_FMT("{} {}"), 3, 4)));
+  EXPECT_EQ("1 [3 4   ]",
+            sformat("{} [{:6}]", 1, format(FOLLY_FMT("{} {}"), 3, 4)));
+}
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return RUN_ALL_TESTS();
+}
@@ -17,9 +17,11 @@
 #include <folly/Benchmark.h>
 #include <folly/Conv.h>
 #include <folly/Foreach.h>
+#include <folly/String.h>
 #include <boost/lexical_cast.hpp>
 #include <gtest/gtest.h>
 #include <limits>
+#include <random>
 #include <stdexcept>
 
 using namespace std;
@@ -556,6 +558,112 @@ TEST(Conv, DoubleToString) {
   testDoubleToString<fbstring>();
 }
 
+TEST(Conv, DoubleToStringShortest) {
+  // laid out as DoubleToStringConverter::ToShortest()
+  EXPECT_EQ("-0", to<string>(-0.0));
+  EXPECT_EQ("0.1", to<string>(0.1));
+  EXPECT_EQ("0.3333333333333333", to<string>(1.0 / 3));
+  EXPECT_EQ("0.10000000149011612", to<string>(0.1f));
+  EXPECT_EQ("100000000000000000000", to<string>(1e20));
+  EXPECT_EQ("123456789012345680000", to<string>(123456789012345678901.0));
+  EXPECT_EQ("1E21", to<string>(1e21));
+  EXPECT_EQ("1.5E22", to<string>(1.5e22));
+  EXPECT_EQ("0.000001", to<string>(1e-6));
+  EXPECT_EQ("0.000001234", to<string>(1.234e-6));
+  EXPECT_EQ("1E-7", to<string>(1e-7));
+  EXPECT_EQ("-1.5E-7", to<string>(-1.5e-7));
+  EXPECT_EQ("9007199254740992", to<string>(9007199254740992.0));
+  EXPECT_EQ("5E-324", to<string>(numeric_limits<double>::denorm_min()));
+  EXPECT_EQ("2.2250738585072014E-308",
+            to<string>(numeric_limits<double>::min()));
+  EXPECT_EQ("1.7976931348623157E308",
+            to<string>(numeric_limits<double>::max()));
+  EXPECT_EQ("Infinity", to<string>(numeric_limits<double>::infinity()));
+  EXPECT_EQ("-Infinity", to<string>(-numeric_limits<double>::infinity()));
+  EXPECT_EQ("NaN", to<string>(numeric_limits<double>::quiet_NaN()));
+
+  char buffer[kMaxDoubleToBufferLength];
+  EXPECT_EQ(kMaxDoubleToBufferLength,
+            doubleToBufferUnsafe(-1.2345678901234567e-6, buffer));
+  EXPECT_GE(estimateSpaceNeeded(-1.2345678901234567e-6),
+            kMaxDoubleToBufferLength);
+}
+
+TEST(Conv, DoubleToStringRoundTrip) {
+  std::mt19937_64 rng(12345);
+  char buffer[kMaxDoubleToBufferLength];
+  for (int i = 0; i < 1000000; ++i) {
+    uint64_t bits = rng();
+    if (i % 2) {
+      // fewer random bits, for trailing zeros and powers of 2
+      bits &= 0xfff0000000000fffULL;
+    }
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    StringPiece sp(buffer, doubleToBufferUnsafe(value, buffer));
+    // the same text as DoubleToStringConverter::ToShortest
+    std::string expected;
+    toAppend(value, &expected,
+             double_conversion::DoubleToStringConverter::SHORTEST, 0);
+    ASSERT_EQ(expected, sp) << bits;
+    if (std::isnan(value)) {
+      continue;
+    }
+    double back = to<double>(sp);
+    ASSERT_EQ(0, memcmp(&value, &back, sizeof(value))) << sp;
+    // shortest: the closest number with one digit less doesn't round trip
+    std::string digits;
+    for (char c : sp.subpiece(0, sp.find('E'))) {
+      if (isdigit(c) && (c != '0' || !digits.empty())) {
+        digits.push_back(c);
+      }
+    }
+    digits.erase(digits.find_last_not_of('0') + 1);
+    if (digits.size() > 1) {
+      std::string shorter = stringPrintf("%.*e", int(digits.size()) - 2, value);
+      EXPECT_NE(value, strtod(shorter.c_str(), nullptr)) << sp;
+    }
+  }
+}
+
+TEST(Conv, StringToDoubleFastPath) {
+  double value;
+  auto fast = [&](StringPiece sp) {
+    return detail::fastStringToDouble(&sp, &value) && sp.empty();
+  };
+  EXPECT_TRUE(fast("0"));
+  EXPECT_TRUE(fast("-12.5e3"));
+  EXPECT_EQ(-12500, value);
+  EXPECT_TRUE(fast("123456789012345e-22"));
+  EXPECT_EQ(123456789012345e-22, value);
+  EXPECT_TRUE(fast("0.1"));
+  EXPECT_EQ(0.1, value);
+  // left to double-conversion
+  EXPECT_FALSE(fast("+1"));
+  EXPECT_FALSE(fast(".5"));
+  EXPECT_FALSE(fast("5."));
+  EXPECT_FALSE(fast("1e"));
+  EXPECT_FALSE(fast("1e23"));
+  EXPECT_FALSE(fast("12345678901234567890"));
+  EXPECT_FALSE(fast(" 1"));
+  EXPECT_FALSE(fast("9007199254740993"));
+
+  StringPiece sp("1.5e2x");
+  EXPECT_EQ(150, to<double>(&sp));
+  EXPECT_EQ("x", sp);
+  EXPECT_EQ(1e23, to<double>("1e23"));
+  EXPECT_EQ(0.5, to<double>(".5"));
+  EXPECT_EQ(1.0, to<double>(" 1"));
+  EXPECT_EQ(9007199254740992.0, to<double>("9007199254740993"));
+
+  std::mt19937_64 rng(12345);
+  for (int i = 0; i < 100000; ++i) {
+    std::string s = to<string>(int64_t(rng()) >> (rng() % 64), '.',
+                               rng() % 100000, 'e', int(rng() % 40) - 20);
+    EXPECT_EQ(strtod(s.c_str(), nullptr), to<double>(s)) << s;
+  }
+}
+
 TEST(Conv, FBStringToString) {
   fbstring foo("foo");
   string ret = to<string>(foo);
@@ -848,6 +956,102 @@ TEST(Conv, allocate_size) {
   EXPECT_EQ(res3, str1 + "," + str2);
 }
 
+template <class Int>
+void testIntegersRoundTrip() {
+  std::mt19937_64 rng(12345);
+  std::vector<Int> values;
+  std::string expected;
+  for (int i = 0; i < 1000; ++i) {
+    // all lengths of digits
+    Int v = Int(rng() >> (rng() % 64));
+    values.push_back(v);
+    toAppend(i ? "," : "", v, &expected);
+  }
+  values.push_back(std::numeric_limits<Int>::min());
+  values.push_back(std::numeric_limits<Int>::max());
+  toAppend(",", std::numeric_limits<Int>::min(), &expected);
+  toAppend(",", std::numeric_limits<Int>::max(), &expected);
+
+  std::string str("x");
+  toAppendIntegers(',', range(values), &str);
+  EXPECT_EQ("x" + expected, str);
+
+  std::vector<Int> parsed(1);
+  EXPECT_EQ(values.size(), toIntegers(expected, ',', &parsed));
+  parsed.erase(parsed.begin());
+  EXPECT_EQ(values, parsed);
+}
+
+TEST(Conv, IntegersRoundTrip) {
+  testIntegersRoundTrip<int8_t>();
+  testIntegersRoundTrip<uint8_t>();
+  testIntegersRoundTrip<int16_t>();
+  testIntegersRoundTrip<uint16_t>();
+  testIntegersRoundTrip<int32_t>();
+  testIntegersRoundTrip<uint32_t>();
+  testIntegersRoundTrip<int64_t>();
+  testIntegersRoundTrip<uint64_t>();
+}
+
+TEST(Conv, IntegersToString) {
+  std::string str;
+  std::vector<int> none;
+  toAppendIntegers('\t', range(none), &str);
+  EXPECT_EQ("", str);
+  const int values[] = {0, -1, 10, -2147483647 - 1};
+  toAppendIntegers('\t', range(values), &str);
+  EXPECT_EQ("0\t-1\t10\t-2147483648", str);
+
+  fbstring fbstr;
+  const uint64_t big[] = {18446744073709551615UL, 7};
+  toAppendIntegers('\n', range(big), &fbstr);
+  EXPECT_EQ("18446744073709551615\n7", fbstr);
+}
+
+TEST(Conv, StringToIntegers) {
+  std::vector<int> v;
+  EXPECT_EQ(0, toIntegers("", ',', &v));
+  EXPECT_EQ(3, toIntegers("1\n-20\n300\n", '\n', &v));
+  EXPECT_EQ(2, toIntegers("0000000000004,-0", ',', &v));
+  EXPECT_EQ((std::vector<int>{1, -20, 300, 4, 0}), v);
+
+  // a long batch, with an error in the SIMD blocks or at the end
+  std::string str;
+  for (int i = 0; i < 100; ++i) {
+    toAppend(i, ',', &str);
+  }
+  std::vector<uint16_t> u;
+  EXPECT_EQ(100, toIntegers(str, ',', &u));
+  EXPECT_EQ(99, u.back());
+
+  auto expectError = [](StringPiece src, const char* what) {
+    std::vector<int8_t> result(1, 5);
+    try {
+      toIntegers(src, ',', &result);
+      ADD_FAILURE() << "no error converting " << src;
+    } catch (const std::range_error& ex) {
+      EXPECT_TRUE(strstr(ex.what(), what) != nullptr)
+        << ex.what() << " instead of " << what;
+    }
+    EXPECT_EQ(std::vector<int8_t>(1, 5), result);
+  };
+  expectError("1,2,x,4", "value 2: \"x\"");
+  expectError("1,2, 3", "value 2: \" 3\"");
+  expectError("1,+2", "value 1: \"+2\"");
+  expectError("1,,3", "value 1: \"\"");
+  expectError(",", "value 0: \"\"");
+  expectError("1,-", "value 1: \"-\"");
+  expectError("1,2-3", "value 1: \"2-3\"");
+  expectError("1,128", "value 1: \"128\"");
+  expectError("-129,1", "value 0: \"-129\"");
+  expectError(str + "1a", "value 100: \"1a\"");
+  expectError(str + "-1000", "value 100: \"-1000\"");
+
+  std::vector<unsigned> unsignedResult;
+  EXPECT_THROW(toIntegers("1,-1", ',', &unsignedResult), std::range_error);
+  EXPECT_TRUE(unsignedResult.empty());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Benchmarks for ASCII to int conversion
 ////////////////////////////////////////////////////////////////////////////////
@@ -1069,6 +1273,137 @@ static std::string stdString = "std::strings are very nice";
 static float fValue = 1.2355;
 static double dValue = 345345345.435;
 
+static const std::vector<double>& benchDoubles() {
+  static const std::vector<double> values = [] {
+    std::vector<double> v;
+    std::mt19937_64 rng(12345);
+    for (int i = 0; i < 1000; ++i) {
+      // metrics-like values, and arbitrary ones
+      v.push_back(i % 2 ? double(rng() % 1000000) / 1000 :
+                  std::ldexp(double(rng() >> 11), int(rng() % 128) - 64));
+    }
+    return v;
+  }();
+  return values;
+}
+
+static const std::vector<std::string>& benchDoubleStrings() {
+  static const std::vector<std::string> strings = [] {
+    std::vector<std::string> v;
+    for (double d : benchDoubles()) {
+      v.push_back(to<std::string>(d));
+    }
+    return v;
+  }();
+  return strings;
+}
+
+BENCHMARK(doubleToStringConverterShortest, n) {
+  using namespace double_conversion;
+  for (size_t i = 0; i < n; ++i) {
+    DoubleToStringConverter conv(DoubleToStringConverter::NO_FLAGS,
+                                 "Infinity", "NaN", 'E', -6, 21, 6, 1);
+    char buffer[256];
+    StringBuilder builder(buffer, sizeof(buffer));
+    conv.ToShortest(benchDoubles()[i % 1000], &builder);
+    doNotOptimizeAway(builder.position());
+  }
+}
+
+BENCHMARK_RELATIVE(doubleToBufferUnsafeShortest, n) {
+  char buffer[kMaxDoubleToBufferLength];
+  for (size_t i = 0; i < n; ++i) {
+    doNotOptimizeAway(doubleToBufferUnsafe(benchDoubles()[i % 1000], buffer));
+  }
+}
+
+BENCHMARK(stringToDoubleConverter, n) {
+  using namespace double_conversion;
+  StringToDoubleConverter conv(
+      StringToDoubleConverter::ALLOW_TRAILING_JUNK |
+      StringToDoubleConverter::ALLOW_LEADING_SPACES,
+      0.0, std::numeric_limits<double>::quiet_NaN(), nullptr, nullptr);
+  for (size_t i = 0; i < n; ++i) {
+    auto& s = benchDoubleStrings()[i % 1000];
+    int length;
+    doNotOptimizeAway(conv.StringToDouble(s.data(), s.size(), &length));
+  }
+}
+
+BENCHMARK_RELATIVE(stringToDoubleFolly, n) {
+  for (size_t i = 0; i < n; ++i) {
+    doNotOptimizeAway(to<double>(benchDoubleStrings()[i % 1000]));
+  }
+}
+
+BENCHMARK_DRAW_LINE();
+
+static const std::vector<int64_t>& benchIntegers() {
+  static const std::vector<int64_t> values = [] {
+    std::vector<int64_t> v;
+    std::mt19937_64 rng(12345);
+    for (int i = 0; i < 1000; ++i) {
+      // column-like values, of a few digits mostly
+      v.push_back(int64_t(rng() >> (40 + rng() % 24)) - 1000);
+    }
+    return v;
+  }();
+  return values;
+}
+
+static const std::string& benchIntegersString() {
+  static const std::string str = [] {
+    std::string s;
+    toAppendIntegers(',', range(benchIntegers()), &s);
+    return s;
+  }();
+  return str;
+}
+
+BENCHMARK(integersToStringToAppend, n) {
+  std::string str;
+  for (size_t i = 0; i < n; ++i) {
+    str.clear();
+    for (auto v : benchIntegers()) {
+      toAppend(v, ',', &str);
+    }
+    doNotOptimizeAway(str.size());
+  }
+}
+
+BENCHMARK_RELATIVE(integersToStringBatch, n) {
+  std::string str;
+  for (size_t i = 0; i < n; ++i) {
+    str.clear();
+    toAppendIntegers(',', range(benchIntegers()), &str);
+    doNotOptimizeAway(str.size());
+  }
+}
+
+BENCHMARK(stringToIntegersSplit, n) {
+  std::vector<StringPiece> pieces;
+  std::vector<int64_t> values;
+  for (size_t i = 0; i < n; ++i) {
+    pieces.clear();
+    values.clear();
+    split(',', benchIntegersString(), pieces);
+    for (auto piece : pieces) {
+      values.push_back(to<int64_t>(piece));
+    }
+    doNotOptimizeAway(values.size());
+  }
+}
+
+BENCHMARK_RELATIVE(stringToIntegersBatch, n) {
+  std::vector<int64_t> values;
+  for (size_t i = 0; i < n; ++i) {
+    values.clear();
+    doNotOptimizeAway(toIntegers(benchIntegersString(), ',', &values));
+  }
+}
+
+BENCHMARK_DRAW_LINE();
+
 BENCHMARK(preallocateTestNoFloat, n) {
   for (size_t i = 0; i < n; ++i) {
     auto val1 = to<std::string>(bigInt, someString, stdString, otherString);
@@ -0,0 +1,467 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <csignal>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+#include <folly/Conv.h>
+#include <folly/FileUtil.h>
+#include <folly/String.h>
+#include <folly/experimental/TestUtil.h>
+
+// Last, so that its macros take precedence over those of glog
+#include <folly/ext/Logging.h>
+
+#if !(FOLLY_HAVE_LIBGLOG && FOLLY_USE_GLOG)
+
+using namespace folly;
+using namespace folly::logging;
+
+namespace {
+
+std::vector<std::string> readLines(const std::string& path) {
+  std::string data;
+  std::vector<std::string> lines;
+  if (readFile(path.c_str(), data)) {
+    split('\n', data, lines);
+    if (!lines.empty() && lines.back().empty()) {
+      lines.pop_back();
+    }
+  }
+  return lines;
+}
+
+// The message of a log line, without the level, timestamp and location
+StringPiece messageOf(StringPiece line) {
+  size_t pos = line.find("] ");
+  return pos == StringPiece::npos ? line : line.subpiece(pos + 2);
+}
+
+std::vector<std::string> readMessages(const std::string& path) {
+  std::vector<std::string> messages;
+  for (auto& line : readLines(path)) {
+    messages.push_back(messageOf(line).str());
+  }
+  return messages;
+}
+
+off_t fileSize(const std::string& path) {
+  struct stat st;
+  return stat(path.c_str(), &st) == 0 ? st.st_size : -1;
+}
+
+// Run fn in a child process, with the LogWriter singleton writing to
+// path, and return its wait status.
+int runWithLogger(const std::string& path,
+                  bool async,
+                  std::function<void()> fn,
+                  size_t capacity = 1 << 16) {
+  pid_t pid = fork();
+  if (pid == 0) {
+    if (async) {
+      initializeAsync(Level::INFO, path.c_str(), capacity);
+    } else {
+      initialize(Level::INFO, path.c_str());
+    }
+    fn();
+    exit(0);
+  }
+  int status = -1;
+  if (pid > 0) {
+    waitpid(pid, &status, 0);
+  }
+  return status;
+}
+
+// Log `count` messages "<thread> <i>" from each of `threads` threads
+void logFromThreads(LogWriter& writer, int threads, int count) {
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&writer, t, count] {
+      for (int i = 0; i < count; ++i) {
+        writer.log(Level::INFO, "test", 0, "%d %d", t, i);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+// Messages of each thread must be in order, even if some were discarded
+void checkOrder(const std::vector<std::string>& lines, int threads) {
+  std::vector<int> last(threads, -1);
+  for (auto& line : lines) {
+    ASSERT_EQ('I', line[1]);
+    StringPiece message = messageOf(line);
+    int t = to<int>(message.split_step(' '));
+    int i = to<int>(message);
+    ASSERT_LT(last[t], i);
+    last[t] = i;
+  }
+}
+
+} // namespace
+
+TEST(LogWriter, Sync) {
+  test::TemporaryFile file;
+  {
+    LogWriter writer(Level::INFO, file.path().c_str());
+    EXPECT_FALSE(writer.isAsync());
+    writer.log(Level::INFO, "test", 0, "%d %d", 0, 0);
+    writer.log(Level::DEBUG, "test", 0, "filtered by the caller");
+    EXPECT_FALSE(writer.isEnabled(Level::DEBUG));
+  }
+  auto lines = readLines(file.path().c_str());
+  ASSERT_EQ(2, lines.size());
+  EXPECT_EQ("0 0", messageOf(lines[0]));
+}
+
+TEST(LogWriter, AsyncBlock) {
+  test::TemporaryFile file;
+  LogWriter writer(Level::INFO, file.path().c_str());
+  writer.startAsync(16, Overflow::BLOCK);
+  EXPECT_TRUE(writer.isAsync());
+  logFromThreads(writer, 4, 5000);
+  writer.flush();
+
+  auto lines = readLines(file.path().c_str());
+  EXPECT_EQ(20000, lines.size());
+  EXPECT_EQ(0, writer.discarded());
+  checkOrder(lines, 4);
+}
+
+TEST(LogWriter, AsyncDiscard) {
+  test::TemporaryFile file;
+  LogWriter writer(Level::INFO, file.path().c_str());
+  writer.startAsync(2, Overflow::DISCARD);
+  logFromThreads(writer, 4, 5000);
+  writer.flush();
+
+  // every message is either written or counted
+  auto lines = readLines(file.path().c_str());
+  EXPECT_EQ(20000, lines.size() + writer.discarded());
+  checkOrder(lines, 4);
+}
+
+TEST(LogWriter, AsyncLargeMessage) {
+  test::TemporaryFile file;
+  LogWriter writer(Level::INFO, file.path().c_str());
+  writer.startAsync();
+  std::string data(512, 'x');
+  writer.log(Level::INFO, "test", 0, "before");
+  // too large for a slot, written directly
+  writer.logHexdump("test", 0, &data[0], data.size(), "dump");
+  writer.log(Level::INFO, "test", 0, "after");
+  writer.flush();
+
+  auto lines = readLines(file.path().c_str());
+  ASSERT_EQ(3 + 512 / 16, lines.size());
+  EXPECT_EQ("before", messageOf(lines.front()));
+  EXPECT_EQ("dump", messageOf(lines[1]));
+  EXPECT_EQ("after", messageOf(lines.back()));
+}
+
+TEST(LogWriter, AsyncDestroy) {
+  test::TemporaryFile file;
+  {
+    LogWriter writer(Level::INFO, file.path().c_str());
+    writer.startAsync();
+    logFromThreads(writer, 1, 1000);
+  }
+  EXPECT_EQ(1000, readLines(file.path().c_str()).size());
+}
+
+TEST(LogWriter, AsyncFlushAtExit) {
+  test::TemporaryFile file;
+  int status = runWithLogger(file.path().c_str(), true, [] {
+    for (int i = 0; i < 1000; ++i) {
+      LOG_INFO("%d", i);
+    }
+  });
+  EXPECT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(1000, readLines(file.path().c_str()).size());
+}
+
+TEST(LogWriter, RotateBySize) {
+  for (bool async : {false, true}) {
+    test::TemporaryDirectory dir;
+    std::string path = dir.path().string() + "/log";
+    {
+      LogWriter writer(Level::INFO, path.c_str());
+      RotationPolicy policy;
+      policy.maxSize = 1000;
+      policy.maxFiles = 2;
+      writer.setRotation(policy);
+      if (async) {
+        writer.startAsync();
+      }
+      for (int i = 0; i < 200; ++i) {
+        writer.log(Level::INFO, "test", 0, "%d", i);
+        if (async) {
+          writer.flush();
+        }
+      }
+    }
+    // a file is rotated as soon as it reaches maxSize
+    off_t lineSize = readLines(path + ".1").front().size() + 1;
+    for (auto name : {path + ".1", path + ".2"}) {
+      EXPECT_LE(1000, fileSize(name));
+      EXPECT_GT(1000 + lineSize, fileSize(name));
+    }
+    EXPECT_GT(1000, fileSize(path));
+    EXPECT_EQ(-1, fileSize(path + ".3"));
+
+    // no message is lost or reordered between the files
+    auto older = readMessages(path + ".2");
+    auto old = readMessages(path + ".1");
+    auto current = readMessages(path);
+    EXPECT_EQ(to<int>(older.back()) + 1, to<int>(old.front()));
+    EXPECT_EQ(to<int>(old.back()) + 1, to<int>(current.front()));
+    EXPECT_EQ("199", current.back());
+  }
+}
+
+TEST(LogWriter, RotateAndReopen) {
+  test::TemporaryDirectory dir;
+  std::string path = dir.path().string() + "/log";
+  LogWriter writer(Level::INFO, path.c_str());
+  int reopened = 0;
+  writer.setReopenCallback([&] {
+    writer.writeDirect("header\n", 7);
+    ++reopened;
+  });
+
+  writer.log(Level::INFO, "test", 0, "first");
+  writer.rotate();
+  writer.log(Level::INFO, "test", 0, "second");
+  writer.flush();
+  EXPECT_EQ(1, reopened);
+  EXPECT_EQ(std::vector<std::string>{"first"}, readMessages(path + ".1"));
+  EXPECT_EQ((std::vector<std::string>{"header", "second"}),
+            readMessages(path));
+
+  // moved away by an external tool
+  ASSERT_EQ(0, rename(path.c_str(), (path + ".old").c_str()));
+  writer.log(Level::INFO, "test", 0, "third");
+  writer.reopen();
+  writer.log(Level::INFO, "test", 0, "fourth");
+  writer.flush();
+  EXPECT_EQ(2, reopened);
+  EXPECT_EQ((std::vector<std::string>{"header", "second", "third"}),
+            readMessages(path + ".old"));
+  EXPECT_EQ((std::vector<std::string>{"header", "fourth"}),
+            readMessages(path));
+
+  // on signal, the file is reopened after the next message
+  writer.reopenOnSignal(SIGUSR1);
+  ASSERT_EQ(0, rename(path.c_str(), (path + ".old").c_str()));
+  raise(SIGUSR1);
+  writer.log(Level::INFO, "test", 0, "fifth");
+  writer.log(Level::INFO, "test", 0, "sixth");
+  writer.flush();
+  EXPECT_EQ(3, reopened);
+  EXPECT_EQ((std::vector<std::string>{"header", "fourth", "fifth"}),
+            readMessages(path + ".old"));
+  EXPECT_EQ((std::vector<std::string>{"header", "sixth"}),
+            readMessages(path));
+}
+
+TEST(LogCategory, Level) {
+  LogCategory category("test", Level::WARN);
+  EXPECT_EQ("test", category.name());
+  EXPECT_TRUE(category.isEnabled(Level::ERROR));
+  EXPECT_TRUE(category.isEnabled(Level::WARN));
+  EXPECT_FALSE(category.isEnabled(Level::INFO));
+  category.setLevel(Level::DEBUG);
+  EXPECT_EQ(Level::DEBUG, category.getLevel());
+  EXPECT_TRUE(category.isEnabled(Level::DEBUG));
+}
+
+TEST(LogCategory, Macros) {
+  test::TemporaryFile file;
+  int status = runWithLogger(file.path().c_str(), false, [] {
+    auto* net = getCategory("net");
+    auto* db = getCategory("db");
+    auto* other = getCategory("other");
+    // created with the level of the singleton
+    CLOG(net, INFO) << "net info";
+    CLOG(net, DEBUG) << "net debug";
+    setCategoryLevels("net=DEBUG,db=E,bad,=W,other=");
+    CLOG(getCategory("net"), DEBUG) << "net debug";
+    CLOG(db, WARN) << "db warn";
+    CLOG(db, ERROR) << "db error";
+    CLOG(other, INFO) << "other info";
+    setCategoryLevel("other", Level::EMERG);
+    CLOG(other, ALERT) << "other alert";
+    // EMERG has the same value as FATAL, but doesn't abort
+    CLOG(other, EMERG) << "other emerg";
+  });
+  EXPECT_TRUE(WIFEXITED(status));
+  std::vector<std::string> expected = {
+    "net info", "net debug", "db error", "other info", "other emerg",
+  };
+  EXPECT_EQ(expected, readMessages(file.path().c_str()));
+}
+
+TEST(LogCategory, Fatal) {
+  test::TemporaryFile file;
+  int status = runWithLogger(file.path().c_str(), true, [] {
+    CLOG(getCategory("net"), FATAL) << "fatal";
+  });
+  EXPECT_TRUE(WIFSIGNALED(status));
+  EXPECT_EQ(SIGABRT, WTERMSIG(status));
+  EXPECT_EQ(std::vector<std::string>{"fatal"},
+            readMessages(file.path().c_str()));
+}
+
+TEST(Logging, FatalWhenFull) {
+  // The log is a FIFO filled up before the child starts, so its flusher
+  // blocks and the ring of 2 slots stays full: the fatal message is not
+  // dropped
+  for (bool stream : {false, true}) {
+    test::TemporaryDirectory dir;
+    std::string path = dir.path().string() + "/fifo";
+    ASSERT_EQ(0, mkfifo(path.c_str(), 0600));
+    int fd = open(path.c_str(), O_RDONLY | O_NONBLOCK);
+    int wfd = open(path.c_str(), O_WRONLY | O_NONBLOCK);
+    ASSERT_LE(0, fd);
+    ASSERT_LE(0, wfd);
+    while (write(wfd, "filler\n", 7) == 7) {}
+    close(wfd);
+
+    std::string data;
+    std::thread reader([fd, &data] {
+      /* sleep override */ usleep(50000);
+      fcntl(fd, F_SETFL, 0);
+      char buf[4096];
+      ssize_t n;
+      while ((n = readNoInt(fd, buf, sizeof(buf))) > 0) {
+        data.append(buf, n);
+      }
+    });
+    int status = runWithLogger(path, true, [stream] {
+      std::vector<std::thread> threads;
+      for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+          while (true) {
+            LOG_INFO("busy");
+          }
+        });
+      }
+      /* sleep override */ usleep(10000);
+      if (stream) {
+        LOG(FATAL) << "fatal";
+      } else {
+        LOG_FATAL("fatal");
+      }
+    }, 2);
+    reader.join();
+    close(fd);
+    EXPECT_TRUE(WIFSIGNALED(status));
+    EXPECT_EQ(SIGABRT, WTERMSIG(status));
+    std::vector<StringPiece> lines;
+    split('\n', data, lines);
+    EXPECT_EQ(1, std::count_if(lines.begin(), lines.end(),
+                               [] (StringPiece line) {
+                                 return messageOf(line) == "fatal";
+                               }));
+  }
+}
+
+TEST(Logging, RateLimited) {
+  test::TemporaryFile file;
+  int status = runWithLogger(file.path().c_str(), false, [] {
+    for (int i = 0; i < 10; ++i) {
+      LOG_FIRST_N(INFO, 3) << "first " << i;
+    }
+    for (int i = 0; i < 10; ++i) {
+      LOG_EVERY_N(INFO, 4) << "every " << i;
+    }
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([] {
+        for (int i = 0; i < 1000; ++i) {
+          LOG_FIRST_N(INFO, 10) << "threads";
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    auto end = std::chrono::steady_clock::now() +
+               std::chrono::milliseconds(100);
+    while (std::chrono::steady_clock::now() < end) {
+      LOG_EVERY_MS(INFO, 40) << "ms";
+    }
+  });
+  EXPECT_TRUE(WIFEXITED(status));
+
+  auto messages = readMessages(file.path().c_str());
+  std::vector<std::string> expected = {
+    "first 0", "first 1", "first 2", "every 0", "every 4", "every 8",
+  };
+  expected.insert(expected.end(), 10, "threads");
+  ASSERT_LE(expected.size() + 1, messages.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                         messages.begin()));
+  // at 0, 40 and 80 ms at most
+  size_t ms = messages.size() - expected.size();
+  EXPECT_GE(3, ms);
+  EXPECT_TRUE(std::all_of(messages.begin() + expected.size(),
+                          messages.end(),
+                          [] (const std::string& m) { return m == "ms"; }));
+}
+
+TEST(Logging, RateLimitedStatement) {
+  test::TemporaryFile file;
+  int status = runWithLogger(file.path().c_str(), false, [] {
+    for (int i = 0; i < 6; ++i)
+      if (i % 2 == 0)
+        LOG_FIRST_N(INFO, 2) << "even " << i;
+      else
+        LOG_EVERY_N(INFO, 2) << "odd " << i;
+    if (false)
+      LOG_EVERY_MS(INFO, 1000) << "never";
+    else
+      LOG(INFO) << "else";
+  });
+  EXPECT_TRUE(WIFEXITED(status));
+
+  std::vector<std::string> expected = {
+    "even 0", "odd 1", "even 2", "odd 5", "else",
+  };
+  EXPECT_EQ(expected, readMessages(file.path().c_str()));
+}
+
+#endif
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/ext/Time.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+using namespace folly;
+
+namespace {
+
+// 2015-10-21 07:28:05 UTC
+const time_t kTime = 1445412485;
+
+std::string strftimeGmt(const char* format, time_t t) {
+  struct tm tm;
+  gmtime_r(&t, &tm);
+  char buf[128];
+  return std::string(buf, strftime(buf, sizeof(buf), format, &tm));
+}
+
+std::string strftimeLocal(const char* format, time_t t) {
+  struct tm tm;
+  localtime_r(&t, &tm);
+  char buf[128];
+  return std::string(buf, strftime(buf, sizeof(buf), format, &tm));
+}
+
+std::string formatted(TimeFormatter& formatter, time_t sec, long nsec = 0) {
+  const char* s = formatter.format(sec, nsec);
+  EXPECT_EQ(strlen(s), formatter.size());
+  return std::string(s, formatter.size());
+}
+
+} // namespace
+
+TEST(TimeFormatter, Fraction) {
+  const char* format = "%F %T.%f GMT";
+  struct {
+    int digits;
+    long nsec;
+    const char* fraction;
+  } cases[] = {
+    {1, 123456789, "1"},
+    {3, 123456789, "123"},
+    {3, 5000000, "005"},
+    {3, 999999999, "999"},
+    {6, 123456789, "123456"},
+    {6, 7000, "000007"},
+    {9, 123456789, "123456789"},
+    {9, 0, "000000000"},
+    {0, 123456789, "1"},            // at least 1 digit
+    {12, 123456789, "123456789"},   // at most 9 digits
+  };
+  for (auto& c : cases) {
+    TimeFormatter formatter(format, c.digits);
+    EXPECT_EQ(std::string("2015-10-21 07:28:05.") + c.fraction + " GMT",
+              formatted(formatter, kTime, c.nsec))
+      << c.digits << " digits of " << c.nsec;
+  }
+
+  TimeFormatter formatter("%T.%f", 3);
+  EXPECT_EQ(strftimeLocal("%T", kTime) + ".042",
+            formatted(formatter, kTime, 42000000));
+  // no %f, no fraction
+  TimeFormatter plain("%T GMT", 6);
+  EXPECT_EQ("07:28:05 GMT", formatted(plain, kTime, 123456789));
+}
+
+TEST(TimeFormatter, Zone) {
+  struct {
+    const char* format;
+    const char* expected;
+  } cases[] = {
+    {"%F %T +0000", "2015-10-21 07:28:05 +0000"},
+    {"%F %T +0800", "2015-10-21 15:28:05 +0800"},
+    {"%F %T -0130", "2015-10-21 05:58:05 -0130"},
+    {"%F %T +1200", "2015-10-21 19:28:05 +1200"},
+    {"%a %d %T -1000", "Tue 20 21:28:05 -1000"},
+    {"%T GMT", "07:28:05 GMT"},
+    {"%T UTC", "07:28:05 UTC"},
+    {"%T gmt", "07:28:05 gmt"},
+  };
+  for (auto& c : cases) {
+    TimeFormatter formatter(c.format);
+    EXPECT_EQ(c.expected, formatted(formatter, kTime)) << c.format;
+  }
+
+  // no zone suffix: local time
+  for (auto format : {"%F %T", "%T +080", "%T GMT+1", "%T 0800"}) {
+    TimeFormatter formatter(format);
+    EXPECT_EQ(strftimeLocal(format, kTime), formatted(formatter, kTime))
+      << format;
+  }
+}
+
+TEST(TimeFormatter, Cache) {
+  TimeFormatter formatter("%F %T.%f GMT", 3);
+  EXPECT_EQ("2015-10-21 07:28:05.100 GMT",
+            formatted(formatter, kTime, 100000000));
+  // same second, only the fraction changes
+  EXPECT_EQ("2015-10-21 07:28:05.200 GMT",
+            formatted(formatter, kTime, 200000000));
+  // next second
+  EXPECT_EQ("2015-10-21 07:28:06.000 GMT",
+            formatted(formatter, kTime + 1, 0));
+  // across a day, backwards in time
+  EXPECT_EQ("2015-10-21 00:00:00.999 GMT",
+            formatted(formatter, kTime - 26885, 999000000));
+  EXPECT_EQ("2015-10-20 23:59:59.999 GMT",
+            formatted(formatter, kTime - 26886, 999000000));
+  EXPECT_EQ("2015-10-21 07:28:05.300 GMT",
+            formatted(formatter, kTime, 300000000));
+
+  struct timespec ts = {kTime + 60, 7000000};
+  EXPECT_STREQ("2015-10-21 07:29:05.007 GMT", formatter.format(ts));
+}
+
+TEST(TimeFormatter, Formats) {
+  for (auto format : {LOG_TIME_FORMAT, ISO8601_TIME_FORMAT,
+                      SYSLOG_TIME_FORMAT}) {
+    TimeFormatter formatter(format);
+    for (time_t t : {kTime, kTime + 86400 * 40 + 3, time_t(0)}) {
+      EXPECT_EQ(strftimeLocal(format, t), formatted(formatter, t)) << format;
+    }
+  }
+  for (auto format : {RFC1123_TIME_FORMAT, EMAIL_TIME_FORMAT}) {
+    TimeFormatter formatter(format);
+    EXPECT_EQ("Wed, 21 Oct 2015 07:28:05 GMT", formatted(formatter, kTime));
+  }
+  TimeFormatter apple(APPLE_TIME_FORMAT);
+  EXPECT_EQ("2015-10-21 07:28:05 +0000", formatted(apple, kTime));
+
+  // timePrintf agrees on the zone suffix
+  struct tm tm;
+  localtime_r(&kTime, &tm);
+  EXPECT_EQ("Wed, 21 Oct 2015 07:28:05 GMT",
+            timePrintf(RFC1123_TIME_FORMAT, &tm));
+  EXPECT_EQ(strftimeLocal(LOG_TIME_FORMAT, kTime),
+            timePrintf(LOG_TIME_FORMAT, &tm));
+}
+
+TEST(TimeFormatter, Now) {
+  struct {
+    TimeFormat format;
+    const char* strftimeFormat;
+    bool gmt;
+  } cases[] = {
+    {TimeFormat::LOG, LOG_TIME_FORMAT, false},
+    {TimeFormat::ISO8601, ISO8601_TIME_FORMAT, false},
+    {TimeFormat::SYSLOG, SYSLOG_TIME_FORMAT, false},
+    {TimeFormat::RFC1123, RFC1123_TIME_FORMAT, true},
+  };
+  for (auto& c : cases) {
+    // the second may change while formatting
+    time_t before = std::time(nullptr);
+    std::string s = timeNowFormat(c.format);
+    time_t after = std::time(nullptr);
+    auto expected = [&] (time_t t) {
+      return c.gmt ? strftimeGmt(c.strftimeFormat, t)
+                   : strftimeLocal(c.strftimeFormat, t);
+    };
+    EXPECT_TRUE(s == expected(before) || s == expected(after)) << s;
+  }
+
+  // "%FT%T.%f%z": the ISO8601 text with ".ddd" before the zone
+  time_t before = std::time(nullptr);
+  std::string s = timeNowFormat(TimeFormat::ISO8601_MS);
+  time_t after = std::time(nullptr);
+  ASSERT_LE(24, s.size());
+  EXPECT_EQ('.', s[19]);
+  for (int i = 20; i < 23; ++i) {
+    EXPECT_TRUE(isdigit(s[i])) << s;
+  }
+  std::string iso = s.substr(0, 19) + s.substr(23);
+  EXPECT_TRUE(iso == strftimeLocal(ISO8601_TIME_FORMAT, before) ||
+              iso == strftimeLocal(ISO8601_TIME_FORMAT, after)) << s;
+
+  // same pointer per format and thread, reused
+  const char* p = timeNowFormat(TimeFormat::LOG);
+  EXPECT_EQ(p, timeNowFormat(TimeFormat::LOG));
+  EXPECT_NE(p, timeNowFormat(TimeFormat::SYSLOG));
+}
+
+int main(int argc, char** argv) {
+  // A zone east of UTC without DST, so that local and GMT formats differ
+  setenv("TZ", "CST-8", 1);
+  tzset();
+  testing::InitGoogleTest(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,372 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/ext/Unicode.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+#include <folly/FBString.h>
+#include <folly/Unicode.h>
+
+using namespace folly;
+using folly::detail::SimdLevel;
+using folly::detail::Utf8Kernels;
+
+namespace {
+
+std::string encode(char32_t cp) {
+  return codePointToUtf8(cp).toStdString();
+}
+
+// Random code point of 1 to 4 bytes in UTF-8, not a surrogate
+char32_t randomCodePoint(std::mt19937& rng) {
+  static const char32_t limits[][2] = {
+    {0, 0x7f}, {0x80, 0x7ff}, {0x800, 0xd7ff}, {0xe000, 0xffff},
+    {0x10000, 0x10ffff},
+  };
+  auto& range = limits[rng() % 5];
+  return range[0] + rng() % (range[1] - range[0] + 1);
+}
+
+// Random valid UTF-8, with its number of code points and UTF-16 units
+std::string randomUtf8(std::mt19937& rng,
+                       size_t length,
+                       size_t& count,
+                       size_t& utf16) {
+  std::string s;
+  count = utf16 = 0;
+  // mostly ASCII sometimes, to run through the fast paths
+  bool ascii = rng() % 2;
+  while (s.size() < length) {
+    char32_t cp = ascii && rng() % 8 ? rng() % 0x80 : randomCodePoint(rng);
+    s += encode(cp);
+    ++count;
+    utf16 += cp >= 0x10000 ? 2 : 1;
+  }
+  return s;
+}
+
+class Utf8KernelTest : public testing::TestWithParam<SimdLevel> {
+ protected:
+  void SetUp() override {
+    supported_ = folly::detail::simdLevelSupported(GetParam());
+    scalar_ = folly::detail::utf8Kernels(SimdLevel::NONE);
+    kernels_ = folly::detail::utf8Kernels(GetParam());
+  }
+
+  // Compare the results on s, including the counts if s is valid
+  void check(const std::string& s) {
+    const char* b = s.data();
+    const char* e = b + s.size();
+    bool valid = scalar_.isValid(b, e);
+    ASSERT_EQ(valid, kernels_.isValid(b, e)) << hexlify(s);
+    ASSERT_EQ(scalar_.isAscii(b, e), kernels_.isAscii(b, e)) << hexlify(s);
+    if (valid) {
+      ASSERT_EQ(scalar_.count(b, e, false), kernels_.count(b, e, false));
+      ASSERT_EQ(scalar_.count(b, e, true), kernels_.count(b, e, true));
+    }
+  }
+
+  static std::string hexlify(const std::string& s) {
+    std::string out;
+    for (unsigned char c : s) {
+      out += "0123456789abcdef"[c >> 4];
+      out += "0123456789abcdef"[c & 0xf];
+    }
+    return out;
+  }
+
+  bool supported_;
+  Utf8Kernels scalar_;
+  Utf8Kernels kernels_;
+};
+
+} // namespace
+
+TEST_P(Utf8KernelTest, RandomValid) {
+  if (!supported_) {
+    return;
+  }
+  std::mt19937 rng(1234);
+  for (int i = 0; i < 2000; ++i) {
+    size_t count;
+    size_t utf16;
+    auto s = randomUtf8(rng, rng() % 300, count, utf16);
+    const char* b = s.data();
+    const char* e = b + s.size();
+    ASSERT_TRUE(kernels_.isValid(b, e));
+    ASSERT_EQ(count, kernels_.count(b, e, false));
+    ASSERT_EQ(utf16, kernels_.count(b, e, true));
+    check(s);
+  }
+}
+
+TEST_P(Utf8KernelTest, RandomInvalid) {
+  if (!supported_) {
+    return;
+  }
+  std::mt19937 rng(5678);
+  for (int i = 0; i < 2000; ++i) {
+    size_t count;
+    size_t utf16;
+    auto s = randomUtf8(rng, 1 + rng() % 300, count, utf16);
+    // overwrite a few bytes with anything
+    for (size_t n = 1 + rng() % 3; n > 0; --n) {
+      s[rng() % s.size()] = rng();
+    }
+    check(s);
+  }
+  for (int i = 0; i < 1000; ++i) {
+    std::string s(rng() % 100, '\0');
+    for (auto& c : s) {
+      c = rng();
+    }
+    check(s);
+  }
+}
+
+TEST_P(Utf8KernelTest, Truncated) {
+  if (!supported_) {
+    return;
+  }
+  std::mt19937 rng(42);
+  for (int i = 0; i < 100; ++i) {
+    size_t count;
+    size_t utf16;
+    auto s = randomUtf8(rng, 100, count, utf16);
+    for (size_t n = 0; n <= s.size(); ++n) {
+      check(s.substr(0, n));
+      check(s.substr(n));
+    }
+  }
+}
+
+TEST_P(Utf8KernelTest, TailLengths) {
+  if (!supported_) {
+    return;
+  }
+  // complete, truncated and malformed sequences, put at every position
+  // relative to the block boundaries of the kernels
+  std::vector<std::string> tails = {
+    "", "a", "\x7f", "\xc3\xa9", "\xe4\xb8\xad", "\xf0\x9f\x98\x80",
+    "\xc3", "\xe4", "\xe4\xb8", "\xf0", "\xf0\x9f", "\xf0\x9f\x98",
+    "\x80", "\xbf\xbf", "\xc3\x41", "\xe4\x41\xad", "\xf0\x9f\x41\x80",
+    "\xf8\x88\x80\x80\x80", "\xfc\x84\x80\x80\x80\x80", "\xfe", "\xff",
+  };
+  for (auto& prefix : {std::string("x"), std::string("\xce\xb1")}) {
+    for (size_t n = 0; n <= 130; ++n) {
+      std::string head;
+      while (head.size() < n) {
+        head += prefix;
+      }
+      head.resize(n - n % prefix.size());
+      for (auto& tail : tails) {
+        check(head + tail);
+        check(head + tail + "\xce\xb1" + head);
+      }
+    }
+  }
+}
+
+TEST_P(Utf8KernelTest, AsciiCaseMap) {
+  if (!supported_) {
+    return;
+  }
+  std::mt19937 rng(7);
+  for (int i = 0; i < 1000; ++i) {
+    std::string s(rng() % 100, '\0');
+    for (auto& c : s) {
+      // ASCII, with a non-ASCII byte now and then
+      c = rng() % 16 ? rng() % 0x80 : 0x80 + rng() % 0x80;
+    }
+    for (bool upper : {false, true}) {
+      std::string expected(s.size(), '\0');
+      std::string out(s.size(), '\0');
+      size_t n = scalar_.asciiCaseMap(s.data(), &expected[0], s.size(), upper);
+      ASSERT_EQ(n, kernels_.asciiCaseMap(s.data(), &out[0], s.size(), upper));
+      ASSERT_EQ(expected.substr(0, n), out.substr(0, n));
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Utf8KernelTest,
+    Utf8KernelTest,
+    testing::Values(SimdLevel::NONE, SimdLevel::SSE42, SimdLevel::AVX2));
+
+TEST(Utf8, Dispatch) {
+  struct {
+    std::string s;
+    size_t count;
+    size_t utf16;
+  } valid[] = {
+    {"", 0, 0},
+    {"ascii only", 10, 10},
+    {"caf\xc3\xa9", 4, 4},
+    {"\xe4\xb8\xad\xf0\x9f\x98\x80", 2, 3},
+  };
+  for (auto& t : valid) {
+    const char* b = t.s.data();
+    const char* e = b + t.s.size();
+    EXPECT_TRUE(utf8StringIsValid(b, e));
+    EXPECT_TRUE(utf8StringIsValid(t.s));
+    EXPECT_EQ(t.count, utf8CodePointCount(t.s));
+    EXPECT_EQ(t.utf16, folly::detail::utf8Utf16Length(b, e));
+    EXPECT_EQ(t.count == t.s.size(), stringIsAscii(t.s));
+  }
+  for (std::string s : {"caf\xc3", "\xe4\x41\xad", "\xf0\x9f\x98"}) {
+    EXPECT_FALSE(utf8StringIsValid(s.data(), s.data() + s.size()));
+    EXPECT_FALSE(stringIsAscii(s));
+  }
+}
+
+#if FOLLY_HAVE_LIBICU
+
+using namespace folly::unicode;
+
+namespace {
+
+// The simple case mapping, one code point at a time
+std::string caseMapped(const std::u32string& cps, bool upper) {
+  std::string s;
+  for (char32_t cp : cps) {
+    s += encode(upper ? toUpper(cp) : toLower(cp));
+  }
+  return s;
+}
+
+std::string toUtf8(const std::u32string& cps) {
+  std::string s;
+  for (char32_t cp : cps) {
+    s += encode(cp);
+  }
+  return s;
+}
+
+std::string mapOut(const std::string& s, bool upper) {
+  std::string out;
+  if (upper) {
+    toUpper(s, std::back_inserter(out));
+  } else {
+    toLower(s, std::back_inserter(out));
+  }
+  return out;
+}
+
+template <class String>
+String mapInPlace(String s, bool upper) {
+  if (upper) {
+    toUpperInPlace(s);
+  } else {
+    toLowerInPlace(s);
+  }
+  return s;
+}
+
+} // namespace
+
+TEST(CaseMap, OutputIterator) {
+  std::mt19937 rng(99);
+  for (int i = 0; i < 1000; ++i) {
+    // up to a few times the size of the internal buffer
+    std::u32string cps(rng() % 400, 0);
+    bool ascii = rng() % 2;
+    for (auto& cp : cps) {
+      cp = ascii && rng() % 8 ? rng() % 0x80 : randomCodePoint(rng);
+    }
+    std::string s = toUtf8(cps);
+    for (bool upper : {false, true}) {
+      std::string expected = caseMapped(cps, upper);
+      EXPECT_EQ(expected, mapOut(s, upper));
+
+      // any output iterator will do
+      std::vector<char> v(expected.size() + 1, '\0');
+      char* end = upper ? toUpper(s, v.data()) : toLower(s, v.data());
+      EXPECT_EQ(expected, std::string(v.data(), end));
+    }
+  }
+
+  EXPECT_EQ("hello, world! \xc3\xa9\xce\xb1",
+            mapOut("HeLLo, World! \xc3\x89\xce\x91", false));
+  EXPECT_EQ("HELLO, WORLD! \xc3\x89\xce\x91",
+            mapOut("HeLLo, World! \xc3\xa9\xce\xb1", true));
+  // malformed bytes are copied as they are
+  EXPECT_EQ("a\xff" "b\xc3", mapOut("A\xff" "B\xc3", false));
+  EXPECT_EQ("A\x80" "B\xe4\xb8", mapOut("a\x80" "b\xe4\xb8", true));
+}
+
+TEST(CaseMap, InPlace) {
+  std::mt19937 rng(100);
+  for (int i = 0; i < 1000; ++i) {
+    std::u32string cps(rng() % 100, 0);
+    for (auto& cp : cps) {
+      cp = rng() % 4 ? rng() % 0x80 : randomCodePoint(rng);
+    }
+    std::string s = toUtf8(cps);
+    for (bool upper : {false, true}) {
+      std::string expected = caseMapped(cps, upper);
+      EXPECT_EQ(expected, mapInPlace(s, upper));
+      EXPECT_EQ(fbstring(expected), mapInPlace(fbstring(s), upper));
+    }
+  }
+  EXPECT_EQ("", mapInPlace(std::string(), false));
+  EXPECT_EQ("a\xff" "b", mapInPlace(std::string("A\xff" "B"), false));
+}
+
+TEST(CaseMap, LengthChange) {
+  // U+023A and U+2C65 are a case pair of 2 and 3 bytes in UTF-8
+  const std::string upper = "\xc8\xba";       // U+023A
+  const std::string lower = "\xe2\xb1\xa5";   // U+2C65
+  EXPECT_EQ(char32_t(0x2c65), toLower(char32_t(0x23a)));
+  EXPECT_EQ(char32_t(0x23a), toUpper(char32_t(0x2c65)));
+
+  for (size_t n : {0, 1, 15, 16, 17, 31, 32, 33, 255, 256, 300}) {
+    std::string head(n, 'A');
+    std::string tail(n, 'b');
+    std::string s = head + upper + tail + upper + "Z";
+    std::string expected =
+      std::string(n, 'a') + lower + tail + lower + "z";
+    EXPECT_EQ(expected, mapOut(s, false));
+    EXPECT_EQ(expected, mapInPlace(s, false));
+    EXPECT_EQ(fbstring(expected), mapInPlace(fbstring(s), false));
+
+    s = head + lower + tail + lower + "z";
+    expected = head + upper + std::string(n, 'B') + upper + "Z";
+    EXPECT_EQ(expected, mapOut(s, true));
+    EXPECT_EQ(expected, mapInPlace(s, true));
+    EXPECT_EQ(fbstring(expected), mapInPlace(fbstring(s), true));
+  }
+
+  // a copy-on-write or shared original is left alone
+  std::string original = "X" + upper;
+  std::string copy = original;
+  toLowerInPlace(copy);
+  EXPECT_EQ("X" + upper, original);
+  EXPECT_EQ("x" + lower, copy);
+}
+
+#endif
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return RUN_ALL_TESTS();
+}
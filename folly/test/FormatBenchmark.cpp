@@ -18,8 +18,10 @@
 
 #include <glog/logging.h>
 
+#include <folly/CompiledFormat.h>
 #include <folly/FBVector.h>
 #include <folly/Benchmark.h>
+#include <folly/String.h>
 #include <folly/dynamic.h>
 #include <folly/json.h>
 
@@ -83,6 +85,80 @@ BENCHMARK_RELATIVE(intAppend_format) {
   }
 }
 
+BENCHMARK_RELATIVE(intAppend_compiled) {
+  fbstring out;
+  for (int i = -1000; i < 1000; i++) {
+    format(&out, FOLLY_FMT("{}"), i);
+  }
+}
+
+BENCHMARK_DRAW_LINE()
+
+BENCHMARK(smallFormat_stringPrintf, iters) {
+  while (iters--) {
+    for (int i = -100; i < 100; i++) {
+      doNotOptimizeAway(
+          stringPrintf("id=%d name=%s port=%05d", i, "server", i + 8080)
+          .size());
+    }
+  }
+}
+
+BENCHMARK_RELATIVE(smallFormat_sformat, iters) {
+  while (iters--) {
+    for (int i = -100; i < 100; i++) {
+      doNotOptimizeAway(
+          sformat("id={} name={} port={:05}", i, "server", i + 8080).size());
+    }
+  }
+}
+
+BENCHMARK_RELATIVE(smallFormat_compiled, iters) {
+  while (iters--) {
+    for (int i = -100; i < 100; i++) {
+      doNotOptimizeAway(
+          sformat(FOLLY_FMT("id={} name={} port={:05}"),
+                  i, "server", i + 8080).size());
+    }
+  }
+}
+
+BENCHMARK_DRAW_LINE()
+
+BENCHMARK(simpleFormat_stringPrintf, iters) {
+  while (iters--) {
+    for (int i = -100; i < 100; i++) {
+      doNotOptimizeAway(stringPrintf("%d:%s:%d", i, "server", i + 1).size());
+    }
+  }
+}
+
+BENCHMARK_RELATIVE(simpleFormat_sformat, iters) {
+  while (iters--) {
+    for (int i = -100; i < 100; i++) {
+      doNotOptimizeAway(sformat("{}:{}:{}", i, "server", i + 1).size());
+    }
+  }
+}
+
+BENCHMARK_RELATIVE(simpleFormat_to, iters) {
+  while (iters--) {
+    for (int i = -100; i < 100; i++) {
+      doNotOptimizeAway(
+          to<std::string>(i, ':', "server", ':', i + 1).size());
+    }
+  }
+}
+
+BENCHMARK_RELATIVE(simpleFormat_compiled, iters) {
+  while (iters--) {
+    for (int i = -100; i < 100; i++) {
+      doNotOptimizeAway(
+          sformat(FOLLY_FMT("{}:{}:{}"), i, "server", i + 1).size());
+    }
+  }
+}
+
 BENCHMARK_DRAW_LINE()
 
 BENCHMARK(bigFormat_sprintf, iters) {
@@ -123,6 +199,28 @@ BENCHMARK_RELATIVE(bigFormat_format, iters) {
   }
 }
 
+BENCHMARK_RELATIVE(bigFormat_compiled, iters) {
+  char* p;
+  auto writeToBuf = [&p] (StringPiece sp) mutable {
+    memcpy(p, sp.data(), sp.size());
+    p += sp.size();
+  };
+
+  while (iters--) {
+    for (int i = -100; i < 100; i++) {
+      p = bigBuf;
+      format(FOLLY_FMT("{} {} {} {} {}"
+                       "{} {} {} {} {}"
+                       "{} {} {} {} {}"
+                       "{} {} {} {} {}"),
+              i, i+1, i+2, i+3, i+4,
+              i+5, i+6, i+7, i+8, i+9,
+              i+10, i+11, i+12, i+13, i+14,
+              i+15, i+16, i+17, i+18, i+19)(writeToBuf);
+    }
+  }
+}
+
 BENCHMARK_DRAW_LINE()
 
 BENCHMARK(format_nested_strings, iters) {
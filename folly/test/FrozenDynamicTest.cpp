@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/FrozenDynamic.h>
+
+#include <folly/Benchmark.h>
+#include <folly/Conv.h>
+#include <folly/Optional.h>
+#include <folly/json.h>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+using folly::dynamic;
+using folly::FrozenDynamic;
+using folly::FrozenValue;
+using folly::TypeError;
+
+namespace {
+
+const char* kDocument = R"({
+  "name": "frozen",
+  "port": 8080,
+  "ratio": 0.5,
+  "enabled": true,
+  "owner": null,
+  "servers": [
+    {"host": "a.example.com", "weight": 3},
+    {"host": "b.example.com", "weight": 1, "tags": ["x", "yé"]}
+  ],
+  "empty": {},
+  "none": [],
+  "": "empty key"
+})";
+
+} // namespace
+
+TEST(FrozenDynamic, FromJson) {
+  auto frozen = FrozenDynamic::fromJson(kDocument);
+  EXPECT_TRUE(frozen->isObject());
+  EXPECT_EQ(9, frozen->size());
+  EXPECT_EQ("frozen", frozen->at("name").stringPiece());
+  EXPECT_STREQ("frozen", frozen->at("name").c_str());
+  EXPECT_EQ(8080, frozen->at("port").getInt());
+  EXPECT_EQ(0.5, frozen->at("ratio").getDouble());
+  EXPECT_TRUE(frozen->at("enabled").getBool());
+  EXPECT_TRUE(frozen->at("owner").isNull());
+  EXPECT_EQ("empty key", frozen->at("").stringPiece());
+  EXPECT_TRUE(frozen->at("empty").empty());
+  EXPECT_TRUE(frozen->at("none").empty());
+
+  auto& servers = (*frozen)["servers"];
+  EXPECT_TRUE(servers.isArray());
+  EXPECT_EQ(2, servers.size());
+  EXPECT_EQ("b.example.com", servers[1]["host"].stringPiece());
+  EXPECT_EQ("y\xc3\xa9", servers[1]["tags"][1].stringPiece());
+  int64_t weights = 0;
+  for (auto& server : servers) {
+    weights += server.at("weight").getInt();
+  }
+  EXPECT_EQ(4, weights);
+
+  EXPECT_EQ(folly::parseJson(kDocument), frozen.thaw());
+}
+
+TEST(FrozenDynamic, FromDynamic) {
+  dynamic d = folly::parseJson(kDocument);
+  FrozenDynamic frozen(d);
+  EXPECT_EQ(d, frozen.thaw());
+  EXPECT_TRUE(frozen.root() == FrozenDynamic::fromJson(kDocument).root());
+
+  FrozenDynamic scalar(dynamic(12));
+  EXPECT_EQ(12, scalar->getInt());
+  EXPECT_THROW(FrozenDynamic(dynamic::object(1, 2)), TypeError);
+}
+
+TEST(FrozenDynamic, SortedItems) {
+  auto frozen = FrozenDynamic::fromJson(
+      R"({"b": 1, "a": 2, "c": 3, "a": 4, "aa": 5})");
+  std::string keys;
+  for (auto& item : frozen->items()) {
+    keys += item.first.stringPiece().str() + ",";
+  }
+  EXPECT_EQ("a,aa,b,c,", keys);
+  // the last value of a duplicated key wins, as for parseJson()
+  EXPECT_EQ(4, frozen->at("a").getInt());
+  EXPECT_EQ(1, frozen->count("b"));
+  EXPECT_EQ(0, frozen->count("d"));
+  EXPECT_EQ(nullptr, frozen->get_ptr("ab"));
+}
+
+TEST(FrozenDynamic, Errors) {
+  auto frozen = FrozenDynamic::fromJson(kDocument);
+  EXPECT_THROW(frozen->at("missing"), std::out_of_range);
+  EXPECT_THROW(frozen->at("servers").at(2), std::out_of_range);
+  EXPECT_THROW(frozen->at(0), TypeError);
+  EXPECT_THROW(frozen->at("servers").at("host"), TypeError);
+  EXPECT_THROW(frozen->at("port").getDouble(), TypeError);
+  EXPECT_THROW(frozen->at("port").stringPiece(), TypeError);
+  EXPECT_THROW(frozen->at("port").size(), TypeError);
+  EXPECT_THROW(frozen->begin(), TypeError);
+  EXPECT_THROW(frozen->at("servers").items(), TypeError);
+
+  EXPECT_THROW(FrozenDynamic::fromJson("{\"a\": }"), std::runtime_error);
+  folly::json::serialization_opts opts;
+  opts.allow_non_string_keys = true;
+  EXPECT_THROW(FrozenDynamic::fromJson("{1: 2}", opts), std::runtime_error);
+  opts.allow_trailing_comma = true;
+  EXPECT_EQ(2, FrozenDynamic::fromJson("[1, 2,]", opts)->size());
+}
+
+TEST(FrozenDynamic, Move) {
+  auto frozen = FrozenDynamic::fromJson(kDocument);
+  FrozenDynamic other(std::move(frozen));
+  EXPECT_EQ("frozen", other->at("name").stringPiece());
+  EXPECT_GT(other.totalSize(), 0);
+}
+
+namespace {
+
+std::string benchDocument() {
+  std::string json = "{";
+  for (int i = 0; i < 1000; ++i) {
+    folly::toAppend("\"key", i, "\": ", kDocument, ",\n", &json);
+  }
+  json += "\"\": null}";
+  return json;
+}
+
+} // namespace
+
+BENCHMARK(parseDynamic, iters) {
+  std::string json;
+  BENCHMARK_SUSPEND { json = benchDocument(); }
+  for (size_t i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(folly::parseJson(json).size());
+  }
+}
+
+BENCHMARK_RELATIVE(parseFrozen, iters) {
+  std::string json;
+  BENCHMARK_SUSPEND { json = benchDocument(); }
+  for (size_t i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(FrozenDynamic::fromJson(json)->size());
+  }
+}
+
+BENCHMARK(lookupDynamic, iters) {
+  folly::Optional<dynamic> d;
+  BENCHMARK_SUSPEND { d = folly::parseJson(benchDocument()); }
+  for (size_t i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(
+      (*d)[folly::to<std::string>("key", i % 1000)]["port"].getInt());
+  }
+}
+
+BENCHMARK_RELATIVE(lookupFrozen, iters) {
+  folly::Optional<FrozenDynamic> frozen;
+  BENCHMARK_SUSPEND { frozen = FrozenDynamic::fromJson(benchDocument()); }
+  for (size_t i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(
+      (*frozen)->at(folly::to<std::string>("key", i % 1000))["port"]
+        .getInt());
+  }
+}
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  if (FLAGS_benchmark) {
+    folly::runBenchmarks();
+  }
+  return RUN_ALL_TESTS();
+}
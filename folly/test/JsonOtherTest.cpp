@@ -17,7 +17,11 @@
 #include <folly/json.h>
 
 #include <folly/Benchmark.h>
+#include <folly/Conv.h>
 #include <folly/FileUtil.h>
+#include <folly/Optional.h>
+#include <folly/detail/JsonParser.h>
+#include <folly/io/IOBufQueue.h>
 
 #include <gtest/gtest.h>
 #include <gflags/gflags.h>
@@ -26,6 +30,33 @@ using folly::dynamic;
 using folly::parseJson;
 using folly::toJson;
 
+namespace {
+
+std::string readTestData(const std::string& file) {
+  std::string str;
+  if (!folly::readFile(file.data(), str)) {
+    folly::readFile(("folly/test/" + file).data(), str);
+  }
+  return str;
+}
+
+// The test data, stripped of its comments, as elements of a large array
+std::string benchDocument() {
+  std::string object = folly::json::stripComments(
+      readTestData("json_test_data/commented.json")).toStdString();
+  std::string doc = "[";
+  for (int i = 0; i < 1000; ++i) {
+    doc += folly::to<std::string>(
+      "{\"id\": ", i, ", \"score\": ", i, ".25",
+      ", \"tags\": [true, false, null, -", i, "],\n \"data\": ", object,
+      "},\n");
+  }
+  doc += "{}]";
+  return doc;
+}
+
+} // namespace
+
 TEST(Json, StripComments) {
   const std::string kTestDir = "folly/test/";
   const std::string kTestFile = "json_test_data/commented.json";
@@ -44,6 +75,69 @@ TEST(Json, StripComments) {
   EXPECT_EQ(expectedStr, folly::json::stripComments(testStr));
 }
 
+TEST(Json, StructuralParser) {
+  folly::json::serialization_opts opts;
+  std::string doc = benchDocument();
+  dynamic out = nullptr;
+  EXPECT_TRUE(folly::detail::parseJsonStructural(doc, out));
+  EXPECT_EQ(folly::detail::parseJsonRecursive(doc, opts), out);
+  EXPECT_EQ(1001, out.size());
+
+  for (auto str : {
+        "  {\"a\\\\\": [1, -2.5e3, \"\\u00e9\\ud83d\\ude00\"], \"\": {}}  ",
+        "[[[]], [{}], \"\\\\\", \"\\\"\"]",
+        "123456789012345678",
+        "-9223372036854775808",
+        "\"a string spanning more than one block of sixty-four bytes\"",
+      }) {
+    EXPECT_TRUE(folly::detail::parseJsonStructural(str, out)) << str;
+    EXPECT_EQ(folly::detail::parseJsonRecursive(str, opts), out) << str;
+  }
+
+  // extensions and errors are left to the recursive parser
+  for (auto str : {
+        "[1, 2,]",
+        "{1: 2}",
+        "[\"a\" \"b\"]",
+        "{\"a\": 1",
+        "[\"\\q\"]",
+        "\"unterminated",
+        "99999999999999999999",
+        "[1] 2",
+        "",
+      }) {
+    EXPECT_FALSE(folly::detail::parseJsonStructural(str, out)) << str;
+  }
+  EXPECT_THROW(parseJson("[\"\\q\"]"), std::runtime_error);
+  opts.allow_trailing_comma = true;
+  EXPECT_EQ(dynamic({1, 2}), parseJson("[1, 2,]", opts));
+}
+
+TEST(Json, StructuralParserChunks) {
+  // The index is built 16KB at a time: strings, escapes and numbers across
+  // the chunk boundaries, chunks without any position, and errors found
+  // after the first chunk
+  folly::json::serialization_opts opts;
+  std::string escapes;
+  for (int i = 0; i < 3000; ++i) {
+    escapes += "\\\"";
+  }
+  for (size_t pad = 0; pad < 80; pad += 7) {
+    std::string doc = "[" + std::string(16384 - 8 - pad, ' ') +
+      "\"abc\\\"de\", 123456789, -1.5e3, \"" + std::string(40000, 'x') +
+      "\", \"" + escapes + "\", " + benchDocument() + "]";
+    dynamic out = nullptr;
+    EXPECT_TRUE(folly::detail::parseJsonStructural(doc, out)) << pad;
+    EXPECT_EQ(folly::detail::parseJsonRecursive(doc, opts), out) << pad;
+    EXPECT_EQ(6, out.size());
+
+    EXPECT_FALSE(folly::detail::parseJsonStructural(doc + " 1", out));
+    EXPECT_FALSE(folly::detail::parseJsonStructural(
+        doc.substr(0, doc.size() - 1), out));
+    EXPECT_FALSE(folly::detail::parseJsonStructural(doc + " \"", out));
+  }
+}
+
 BENCHMARK(jsonSerialize, iters) {
   folly::json::serialization_opts opts;
   for (size_t i = 0; i < iters; ++i) {
@@ -142,6 +236,68 @@ BENCHMARK(toJson, iters) {
   }
 }
 
+BENCHMARK(parseDocumentRecursive, iters) {
+  std::string doc;
+  BENCHMARK_SUSPEND { doc = benchDocument(); }
+  folly::json::serialization_opts opts;
+  for (size_t i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(
+      folly::detail::parseJsonRecursive(doc, opts).size());
+  }
+}
+
+BENCHMARK_RELATIVE(parseDocument, iters) {
+  std::string doc;
+  BENCHMARK_SUSPEND { doc = benchDocument(); }
+  for (size_t i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(parseJson(doc).size());
+  }
+}
+
+BENCHMARK(structuralIndex, iters) {
+  std::string doc;
+  std::unique_ptr<uint32_t[]> index;
+  BENCHMARK_SUSPEND {
+    doc = benchDocument();
+    index.reset(new uint32_t[doc.size()]);
+  }
+  for (size_t i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(
+      folly::detail::jsonStructuralIndex(doc, index.get()));
+  }
+}
+
+BENCHMARK(serializeDocument, iters) {
+  folly::Optional<dynamic> d;
+  BENCHMARK_SUSPEND { d = parseJson(benchDocument()); }
+  for (size_t i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(toJson(*d).size());
+  }
+}
+
+BENCHMARK_RELATIVE(serializeDocumentReusedBuffer, iters) {
+  folly::Optional<dynamic> d;
+  BENCHMARK_SUSPEND { d = parseJson(benchDocument()); }
+  folly::json::serialization_opts opts;
+  folly::fbstring out;
+  for (size_t i = 0; i < iters; ++i) {
+    out.clear();
+    folly::json::serialize(*d, opts, out);
+    folly::doNotOptimizeAway(out.size());
+  }
+}
+
+BENCHMARK_RELATIVE(serializeDocumentQueue, iters) {
+  folly::Optional<dynamic> d;
+  BENCHMARK_SUSPEND { d = parseJson(benchDocument()); }
+  folly::json::serialization_opts opts;
+  for (size_t i = 0; i < iters; ++i) {
+    folly::IOBufQueue queue(folly::IOBufQueue::cacheChainLength());
+    folly::json::serialize(*d, opts, queue);
+    folly::doNotOptimizeAway(queue.chainLength());
+  }
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   gflags::ParseCommandLineFlags(&argc, &argv, true);
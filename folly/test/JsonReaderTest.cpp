@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/JsonReader.h>
+
+#include <gtest/gtest.h>
+#include <folly/json.h>
+
+using namespace folly;
+
+namespace {
+
+// Rebuild the value from the events, to compare with parseJson()
+struct DynamicBuilder {
+  void startObject() { push(dynamic::object); }
+  void endObject() { pop(); }
+  void startArray() { push({}); }
+  void endArray() { pop(); }
+  void key(StringPiece k) { key_ = k.str(); }
+  void string(StringPiece s) { value(s.str()); }
+  void integer(int64_t i) { value(i); }
+  void number(double d) { value(d); }
+  void boolean(bool b) { value(b); }
+  void null() { value(nullptr); }
+
+  void push(dynamic d) {
+    stack.push_back(std::move(d));
+    keys.push_back(key_);
+  }
+  void pop() {
+    dynamic d = std::move(stack.back());
+    stack.pop_back();
+    key_ = keys.back();
+    keys.pop_back();
+    value(std::move(d));
+  }
+  void value(dynamic d) {
+    if (stack.empty()) {
+      result = std::move(d);
+    } else if (stack.back().isArray()) {
+      stack.back().push_back(std::move(d));
+    } else {
+      stack.back()[key_] = std::move(d);
+    }
+  }
+
+  std::vector<dynamic> stack;
+  std::vector<std::string> keys;
+  std::string key_;
+  dynamic result = nullptr;
+};
+
+dynamic readAll(JsonReader& reader) {
+  DynamicBuilder builder;
+  EXPECT_TRUE(reader.parse(builder));
+  return builder.result;
+}
+
+dynamic read(StringPiece json, const json::serialization_opts& opts) {
+  JsonReader reader(opts);
+  reader.feed(json);
+  reader.finish();
+  return readAll(reader);
+}
+
+dynamic read(StringPiece json) {
+  return read(json, json::serialization_opts());
+}
+
+const char* kDocument =
+  "{\"name\": \"folly\", \"version\": 57, \"ratio\": -1.5e3,\n"
+  " \"tags\": [\"c++\", \"json\", \"\\u00e9t\\u00e9 \\ud83d\\ude00\"],\n"
+  " \"nested\": {\"a\": [[], {}, [1, [2, [3]]]], \"b\": null},\n"
+  " \"flags\": [true, false], \"escaped\\n\": \"\\\"\\\\\\/\\b\\f\\r\\t\"}";
+
+} // namespace
+
+TEST(JsonReader, Events) {
+  JsonReader reader;
+  reader.feed("{\"a\": [1, 2.5, \"x\", true, null], \"b\": {}}");
+  reader.finish();
+  EXPECT_EQ(JsonReader::START_OBJECT, reader.next());
+  EXPECT_EQ(JsonReader::KEY, reader.next());
+  EXPECT_EQ("a", reader.str());
+  EXPECT_EQ(JsonReader::START_ARRAY, reader.next());
+  EXPECT_EQ(2, reader.depth());
+  EXPECT_EQ(JsonReader::INT, reader.next());
+  EXPECT_EQ(1, reader.getInt());
+  EXPECT_EQ(JsonReader::DOUBLE, reader.next());
+  EXPECT_EQ(2.5, reader.getDouble());
+  EXPECT_EQ("2.5", reader.str());
+  EXPECT_EQ(JsonReader::STRING, reader.next());
+  EXPECT_EQ("x", reader.str());
+  EXPECT_EQ(JsonReader::BOOL, reader.next());
+  EXPECT_TRUE(reader.getBool());
+  EXPECT_EQ(JsonReader::NULLT, reader.next());
+  EXPECT_EQ(JsonReader::END_ARRAY, reader.next());
+  EXPECT_EQ(JsonReader::KEY, reader.next());
+  EXPECT_EQ("b", reader.str());
+  EXPECT_EQ(JsonReader::START_OBJECT, reader.next());
+  EXPECT_EQ(JsonReader::END_OBJECT, reader.next());
+  EXPECT_EQ(JsonReader::END_OBJECT, reader.next());
+  EXPECT_EQ(0, reader.depth());
+  EXPECT_EQ(JsonReader::END, reader.next());
+  EXPECT_EQ(JsonReader::END, reader.next());
+}
+
+TEST(JsonReader, SameAsParseJson) {
+  EXPECT_EQ(parseJson(kDocument), read(kDocument));
+  for (auto json : {"1", "-0", "\"\"", "[]", "{}", "  true  ", "1e5",
+                    "[Infinity, -Infinity]", "9223372036854775807"}) {
+    EXPECT_EQ(parseJson(json), read(json)) << json;
+  }
+}
+
+TEST(JsonReader, Chunks) {
+  // split at every position, the events are the same
+  std::string doc(kDocument);
+  auto expected = parseJson(doc);
+  for (size_t i = 0; i <= doc.size(); ++i) {
+    JsonReader reader;
+    DynamicBuilder builder;
+    reader.feed(StringPiece(doc).subpiece(0, i));
+    EXPECT_FALSE(reader.parse(builder));
+    reader.feed(StringPiece(doc).subpiece(i));
+    reader.finish();
+    EXPECT_TRUE(reader.parse(builder));
+    EXPECT_EQ(expected, builder.result) << i;
+  }
+  // one byte at a time
+  JsonReader reader;
+  DynamicBuilder builder;
+  for (char& c : doc) {
+    reader.feed(StringPiece(&c, 1));
+    EXPECT_FALSE(reader.parse(builder));
+  }
+  reader.finish();
+  EXPECT_TRUE(reader.parse(builder));
+  EXPECT_EQ(expected, builder.result);
+}
+
+TEST(JsonReader, NumberAtEnd) {
+  JsonReader reader;
+  reader.feed("12");
+  EXPECT_EQ(JsonReader::NEED_INPUT, reader.next());
+  reader.feed("34");
+  EXPECT_EQ(JsonReader::NEED_INPUT, reader.next());
+  reader.finish();
+  EXPECT_EQ(JsonReader::INT, reader.next());
+  EXPECT_EQ(1234, reader.getInt());
+  EXPECT_EQ(JsonReader::END, reader.next());
+}
+
+TEST(JsonReader, IOBuf) {
+  std::string doc(kDocument);
+  auto buf = IOBuf::copyBuffer(doc.data(), 10);
+  buf->prependChain(IOBuf::copyBuffer(doc.data() + 10, 1));
+  buf->prependChain(IOBuf::create(0));
+  buf->prependChain(IOBuf::copyBuffer(doc.data() + 11, doc.size() - 11));
+  JsonReader reader;
+  reader.feed(std::move(buf));
+  reader.finish();
+  EXPECT_EQ(parseJson(doc), readAll(reader));
+}
+
+TEST(JsonReader, ZeroCopy) {
+  StringPiece doc("[\"plain\", \"esc\\u0041ped\"]");
+  JsonReader reader;
+  reader.feed(doc);
+  reader.finish();
+  reader.next();
+  EXPECT_EQ(JsonReader::STRING, reader.next());
+  EXPECT_EQ("plain", reader.str());
+  EXPECT_EQ(doc.begin() + 2, reader.str().begin());
+  EXPECT_EQ(JsonReader::STRING, reader.next());
+  EXPECT_EQ("escAped", reader.str());
+}
+
+TEST(JsonReader, Skip) {
+  JsonReader reader;
+  reader.feed("{\"skipped\": {\"a\": [1, {\"b\": 2}]}, \"n\": 1,"
+              " \"s\": \"x\", \"arr\": [1, [2], 3], \"id\": 42}");
+  reader.finish();
+  EXPECT_EQ(JsonReader::START_OBJECT, reader.next());
+  EXPECT_EQ(JsonReader::KEY, reader.next());
+  reader.skip();
+  EXPECT_EQ(JsonReader::KEY, reader.next());
+  EXPECT_EQ("n", reader.str());
+  reader.skip();
+  EXPECT_EQ(JsonReader::KEY, reader.next());
+  EXPECT_EQ("s", reader.str());
+  reader.skip();
+  EXPECT_EQ(JsonReader::KEY, reader.next());
+  EXPECT_EQ(JsonReader::START_ARRAY, reader.next());
+  EXPECT_EQ(JsonReader::INT, reader.next());
+  EXPECT_EQ(JsonReader::START_ARRAY, reader.next());
+  reader.skip();
+  EXPECT_EQ(JsonReader::INT, reader.next());
+  EXPECT_EQ(3, reader.getInt());
+  EXPECT_EQ(JsonReader::END_ARRAY, reader.next());
+  EXPECT_EQ(JsonReader::KEY, reader.next());
+  EXPECT_EQ("id", reader.str());
+  EXPECT_EQ(JsonReader::INT, reader.next());
+  EXPECT_EQ(42, reader.getInt());
+  EXPECT_EQ(JsonReader::END_OBJECT, reader.next());
+  EXPECT_EQ(JsonReader::END, reader.next());
+}
+
+TEST(JsonReader, Options) {
+  json::serialization_opts opts;
+  EXPECT_THROW(read("[1,]"), std::runtime_error);
+  EXPECT_THROW(read("{\"a\":1,}"), std::runtime_error);
+  EXPECT_THROW(read("{1:2}"), std::runtime_error);
+  EXPECT_EQ("\xff", read("\"\xff\"").asString());
+
+  opts.allow_trailing_comma = true;
+  EXPECT_EQ(parseJson("[1,]", opts), read("[1,]", opts));
+  EXPECT_EQ(parseJson("{\"a\":1,}", opts), read("{\"a\":1,}", opts));
+  EXPECT_THROW(read("[,]", opts), std::runtime_error);
+
+  opts.allow_non_string_keys = true;
+  JsonReader reader(opts);
+  reader.feed("{1: 2, true: 3}");
+  reader.finish();
+  reader.next();
+  EXPECT_EQ(JsonReader::KEY, reader.next());
+  EXPECT_EQ("1", reader.str());
+  reader.next();
+  EXPECT_EQ(JsonReader::KEY, reader.next());
+  EXPECT_EQ("true", reader.str());
+  EXPECT_THROW(read("{[1]: 2}", opts), std::runtime_error);
+
+  opts.validate_utf8 = true;
+  EXPECT_THROW(read("\"\xff\"", opts), std::runtime_error);
+  EXPECT_THROW(read("\"\xed\xa0\x80\"", opts), std::runtime_error);
+  EXPECT_EQ("\xc3\xa9", read("\"\xc3\xa9\"", opts).asString());
+}
+
+TEST(JsonReader, Errors) {
+  for (auto json : {"", "[", "{\"a\" 1}", "[1 2]", "{\"a\":1 \"b\":2}",
+                    "\"abc", "[1]]", "[1] x", "tru", "-", "1.5e", "1x",
+                    "01.2.3", "\"\\q\"", "\"\\ud800\"", "\"\\udc00\"",
+                    "\"\\u12\"", "{\"a\"}", "99999999999999999999"}) {
+    EXPECT_THROW(read(json), std::runtime_error) << json;
+  }
+  try {
+    read("[1,\n2,\nfoo]");
+    ADD_FAILURE();
+  } catch (const std::runtime_error& e) {
+    EXPECT_STREQ("json parse error on line 2 near `foo': "
+                 "expected json value", e.what());
+  }
+}
@@ -19,7 +19,9 @@
 #include <gtest/gtest.h>
 #include <gflags/gflags.h>
 #include <limits>
+#include <random>
 #include <boost/next_prior.hpp>
+#include <folly/io/IOBufQueue.h>
 
 using folly::dynamic;
 using folly::parseJson;
@@ -388,6 +390,89 @@ TEST(Json, SortKeys) {
   EXPECT_EQ(sorted_keys, folly::json::serialize(value, opts_on));
 }
 
+namespace {
+
+// Random values whose strings are mostly escapes, so that the JSON text
+// outgrows the size reserved for it
+dynamic makeValue(std::mt19937& rng, int depth) {
+  static const char* const pieces[] = {
+    "a", "\x01", "\x1f", "\"", "\\", "\n", "\xe2\x82\xac", "/",
+  };
+  auto makeString = [&] {
+    std::string s;
+    for (size_t n = rng() % 40; n > 0; --n) {
+      s += pieces[rng() % (sizeof(pieces) / sizeof(pieces[0]))];
+    }
+    return s;
+  };
+  switch (depth > 3 ? rng() % 5 : rng() % 7) {
+    case 0: return nullptr;
+    case 1: return bool(rng() % 2);
+    case 2: return int64_t(rng()) - (1ll << 31);
+    case 3: return int64_t(rng() % 1000) + 0.5;
+    case 4: return makeString();
+    case 5: {
+      dynamic a = {};
+      for (size_t n = rng() % 12; n > 0; --n) {
+        a.push_back(makeValue(rng, depth + 1));
+      }
+      return a;
+    }
+    default: {
+      dynamic o = dynamic::object;
+      for (size_t n = rng() % 12; n > 0; --n) {
+        o[makeString()] = makeValue(rng, depth + 1);
+      }
+      return o;
+    }
+  }
+}
+
+std::string toString(const folly::IOBufQueue& queue) {
+  if (queue.empty()) {
+    return "";
+  }
+  return queue.front()->clone()->moveToFbString().toStdString();
+}
+
+} // namespace
+
+TEST(Json, SerializeAppend) {
+  std::mt19937 rng(2015);
+  size_t buffers = 0;
+  for (bool pretty : {false, true}) {
+    folly::json::serialization_opts opts;
+    opts.pretty_formatting = pretty;
+    for (int i = 0; i < 50; ++i) {
+      dynamic value = dynamic::object;
+      std::string expected;
+      while (expected.size() < 8192) {
+        value[folly::to<std::string>(value.size())] = makeValue(rng, 0);
+        expected = (pretty ? folly::toPrettyJson(value) : toJson(value))
+          .toStdString();
+      }
+      EXPECT_EQ(value, parseJson(expected));
+
+      folly::fbstring str("prefix");
+      folly::json::serialize(value, opts, str);
+      EXPECT_EQ("prefix" + expected, str.toStdString());
+
+      folly::IOBufQueue queue(folly::IOBufQueue::cacheChainLength());
+      queue.append("prefix", 6);
+      folly::json::serialize(value, opts, queue);
+      EXPECT_EQ(6 + expected.size(), queue.chainLength());
+      EXPECT_EQ("prefix" + expected, toString(queue));
+      buffers += queue.front()->countChainElements();
+
+      // and after it, into the same buffers
+      folly::json::serialize(value, opts, queue);
+      EXPECT_EQ("prefix" + expected + expected, toString(queue));
+    }
+  }
+  // the output did cross buffer boundaries
+  EXPECT_LT(200, buffers);
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   gflags::ParseCommandLineFlags(&argc, &argv, true);
@@ -0,0 +1,376 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/ext/Regex.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+#include <folly/Conv.h>
+
+#if FOLLY_HAVE_LIBONIG
+
+using namespace folly;
+
+namespace {
+
+// All the matches of regex in s, as (begin, end) pairs
+std::vector<std::pair<size_t, size_t>> allMatches(const Regex& regex,
+                                                  const std::string& s) {
+  std::vector<std::pair<size_t, size_t>> out;
+  MatchRegion m;
+  size_t pos = 0;
+  while (pos <= s.size() && regexSearch(s, m, regex, s.data() + pos)) {
+    out.emplace_back(m.begin(), m.end());
+    pos = m.end();
+    if (m.empty()) {
+      ++pos;
+      while (pos < s.size() && (s[pos] & 0xc0) == 0x80) {
+        ++pos;
+      }
+    }
+  }
+  return out;
+}
+
+// The matches found by IOBufRegexSearcher, in the chain of buffers
+// split at the given positions
+std::vector<std::pair<size_t, size_t>> chainMatches(
+    const Regex& regex,
+    const std::string& s,
+    const std::vector<size_t>& splits,
+    size_t maxMatchLength) {
+  auto chain = IOBuf::create(0);
+  size_t pos = 0;
+  for (size_t split : splits) {
+    chain->prependChain(IOBuf::copyBuffer(s.data() + pos, split - pos));
+    pos = split;
+  }
+  chain->prependChain(IOBuf::copyBuffer(s.data() + pos, s.size() - pos));
+  std::vector<std::pair<size_t, size_t>> out;
+  IOBufRegexSearcher searcher(regex, chain.get(), maxMatchLength);
+  while (searcher.next()) {
+    auto& m = searcher.match();
+    EXPECT_EQ(s.substr(searcher.offset(), m.end() - m.begin()),
+              m.matchPiece(0).str());
+    size_t begin = searcher.offset();
+    out.emplace_back(begin, begin + m.end() - m.begin());
+  }
+  return out;
+}
+
+// The patterns of a set matching in sp, one search at a time
+std::vector<size_t> bruteMatches(const RegexSet& set, StringPiece sp) {
+  std::vector<size_t> out;
+  for (size_t i = 0; i < set.size(); ++i) {
+    Match m;
+    if (regexSearch(sp, m, set[i])) {
+      out.push_back(i);
+    }
+  }
+  return out;
+}
+
+} // namespace
+
+TEST(RegexCache, Hit) {
+  RegexCache cache;
+  Regex a("a+b", ONIG_OPTION_NONE, &cache);
+  Regex b("a+b", ONIG_OPTION_NONE, &cache);
+  ASSERT_TRUE(a.isValid());
+  EXPECT_EQ(a.regex(), b.regex());
+  EXPECT_EQ(1, cache.size());
+
+  // the options are part of the key
+  Regex c("a+b", ONIG_OPTION_IGNORECASE, &cache);
+  EXPECT_NE(a.regex(), c.regex());
+  EXPECT_EQ(2, cache.size());
+
+  // without a cache, the pattern is compiled for that Regex
+  Regex d("a+b", ONIG_OPTION_NONE, nullptr);
+  EXPECT_TRUE(d.isValid());
+  EXPECT_NE(a.regex(), d.regex());
+  EXPECT_EQ(2, cache.size());
+  EXPECT_EQ(a, d);
+
+  cache.clear();
+  EXPECT_EQ(0, cache.size());
+  // still usable after being dropped from the cache
+  Match m;
+  EXPECT_TRUE(regexSearch("xaab", m, a));
+  EXPECT_NE(a.regex(), Regex("a+b", ONIG_OPTION_NONE, &cache).regex());
+}
+
+TEST(RegexCache, Eviction) {
+  RegexCache cache(2);
+  auto one = cache.get("one", ONIG_OPTION_NONE);
+  auto two = cache.get("two", ONIG_OPTION_NONE);
+  EXPECT_EQ(2, cache.size());
+  // a hit makes "one" the most recently used, "two" is evicted next
+  EXPECT_EQ(one, cache.get("one", ONIG_OPTION_NONE));
+  auto three = cache.get("three", ONIG_OPTION_NONE);
+  EXPECT_EQ(2, cache.size());
+  EXPECT_EQ(one, cache.get("one", ONIG_OPTION_NONE));
+  EXPECT_EQ(three, cache.get("three", ONIG_OPTION_NONE));
+  auto twoAgain = cache.get("two", ONIG_OPTION_NONE);
+  ASSERT_TRUE(twoAgain != nullptr);
+  EXPECT_NE(two, twoAgain);
+  EXPECT_EQ(2, cache.size());
+}
+
+TEST(RegexCache, Invalid) {
+  RegexCache cache;
+  EXPECT_EQ(nullptr, cache.get("(unclosed", ONIG_OPTION_NONE));
+  EXPECT_EQ(0, cache.size());
+  Regex re("(unclosed", ONIG_OPTION_NONE, &cache);
+  EXPECT_FALSE(re.isValid());
+  EXPECT_FALSE(bool(re));
+  EXPECT_EQ(0, cache.size());
+}
+
+TEST(RegexSet, RequiredLiteral) {
+  using folly::detail::regexRequiredLiteral;
+  auto literal = [](StringPiece pattern) {
+    return regexRequiredLiteral(pattern, ONIG_OPTION_NONE);
+  };
+  EXPECT_EQ("/profile", literal("^/user/\\d+/profile$"));
+  EXPECT_EQ("/static/", literal("^/static/"));
+  EXPECT_EQ("abc", literal("abcd?"));
+  EXPECT_EQ("abc", literal("abcd*e"));
+  EXPECT_EQ("abcd", literal("abcd+e"));
+  EXPECT_EQ("bcd", literal("ab{2}bcd"));
+  EXPECT_EQ("a.b", literal("x\\.?a\\.b"));
+  EXPECT_EQ("\t\n", literal("[xy]\\t\\n"));
+  EXPECT_EQ("caf\xc3\xa9", literal("caf\xc3\xa9s?"));
+  EXPECT_EQ("caf", literal("caf\xc3\xa9?"));
+  EXPECT_EQ("after", literal("(?:x|y)after"));
+  EXPECT_EQ("", literal(""));
+  EXPECT_EQ("", literal("a|b"));
+  EXPECT_EQ("", literal("(?i)abc"));
+  EXPECT_EQ("", literal("(abc)\\1"));
+  EXPECT_EQ("", literal("\\x41bc"));
+  EXPECT_EQ("", literal("[unclosed"));
+  EXPECT_EQ("", regexRequiredLiteral("abc", ONIG_OPTION_IGNORECASE));
+  EXPECT_EQ("", regexRequiredLiteral("abc", ONIG_OPTION_EXTEND));
+}
+
+TEST(RegexSet, Matches) {
+  RegexSet routes;
+  EXPECT_EQ(0, routes.add("^/user/\\d+/profile$"));
+  EXPECT_EQ(1, routes.add("^/static/"));
+  EXPECT_EQ(2, routes.add("\\.(png|jpg)$"));
+  EXPECT_EQ(3, routes.add("^/user/"));
+  EXPECT_EQ(4, routes.size());
+
+  EXPECT_EQ((std::vector<size_t>{0, 3}), routes.matches("/user/42/profile"));
+  EXPECT_EQ((std::vector<size_t>{1, 2}), routes.matches("/static/a.png"));
+  EXPECT_EQ((std::vector<size_t>{2}), routes.matches("/a/b.jpg"));
+  EXPECT_EQ(std::vector<size_t>(), routes.matches("/about"));
+
+  Match m;
+  EXPECT_EQ(0, routes.firstMatch("/user/42/profile", &m));
+  EXPECT_EQ("/user/42/profile", m.matchPiece(0));
+  EXPECT_EQ(1, routes.firstMatch("/static/logo.png", &m));
+  EXPECT_EQ("/static/", m.matchPiece(0));
+  EXPECT_EQ(2, routes.firstMatch("/x.jpg", &m));
+  EXPECT_EQ("jpg", m.matchPiece(1));
+  EXPECT_EQ(-1, routes.firstMatch("/about"));
+}
+
+TEST(RegexSet, OverlappingLiterals) {
+  // literals which are suffixes and prefixes of each other
+  RegexSet set;
+  for (auto p : {"he", "she", "his", "hers", "e", "\\d+x", "ers"}) {
+    set.add(p);
+  }
+  EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3, 4, 6}),
+            set.matches("ushers his"));
+  EXPECT_EQ((std::vector<size_t>{0, 1, 4}), set.matches("she"));
+  EXPECT_EQ((std::vector<size_t>{4, 5}), set.matches("e 12x"));
+  EXPECT_EQ(std::vector<size_t>(), set.matches(""));
+}
+
+TEST(RegexSet, Invalid) {
+  RegexSet set;
+  set.add("(unclosed");
+  set.add("ok");
+  EXPECT_FALSE(set[0].isValid());
+  EXPECT_EQ((std::vector<size_t>{1}), set.matches("(unclosed ok"));
+  EXPECT_EQ(1, set.firstMatch("(unclosed ok"));
+}
+
+TEST(RegexSet, Random) {
+  // the prefilter never drops a pattern which matches
+  static const char* const patterns[] = {
+    "abc", "ab+c", "a.c", "^ba", "ca$", "b{2,}a", "c(ab|ba)c", "[ab]cb",
+    "acab?c", "(?:bc)+a", "\\Acc", "a\\z", "bac|cab", "(?i)ABC", "x*",
+    "ccc*b", "b\\Bc", "\\bca",
+  };
+  RegexSet set;
+  for (auto p : patterns) {
+    set.add(p);
+  }
+  std::mt19937 rng(1);
+  for (int i = 0; i < 2000; ++i) {
+    std::string s(rng() % 12, ' ');
+    for (auto& c : s) {
+      c = "abc "[rng() % 4];
+    }
+    auto expected = bruteMatches(set, s);
+    EXPECT_EQ(expected, set.matches(s)) << s;
+    EXPECT_EQ(expected.empty() ? -1 : ssize_t(expected[0]),
+              set.firstMatch(s));
+  }
+}
+
+TEST(Regex, SearchMatch) {
+  Regex re("(?<user>\\w+)@(?<host>[\\w.]+)");
+  Match m;
+  EXPECT_FALSE(bool(m));
+  ASSERT_TRUE(regexSearch("mail bob@example.com now", m, re));
+  EXPECT_EQ(3, m.size());
+  EXPECT_EQ("bob@example.com", m.matchPiece(0));
+  EXPECT_EQ(SizeRange(5, 8), m[1]);
+  auto captures = m.captures();
+  EXPECT_EQ("bob", captures["user"]);
+  EXPECT_EQ("example.com", captures["host"]);
+  EXPECT_EQ("example.com", captures["2"]);
+
+  // a failed search leaves the match as it was
+  EXPECT_FALSE(regexSearch("nothing here", m, re));
+  ASSERT_TRUE(bool(m));
+  EXPECT_EQ("bob@example.com", m.matchPiece(0));
+  EXPECT_EQ("bob", m.matchPiece(1));
+
+  // also when the region is shared with a copy
+  Match copy = m;
+  ASSERT_TRUE(regexSearch("x a@b", m, re));
+  EXPECT_EQ("a@b", m.matchPiece(0));
+  EXPECT_EQ("bob@example.com", copy.matchPiece(0));
+  EXPECT_FALSE(regexSearch("", m, re));
+  EXPECT_EQ("a@b", m.matchPiece(0));
+
+  // from, to and \\G
+  std::string s = "a1 b2 c3";
+  Regex word("\\G\\w\\d ?");
+  EXPECT_TRUE(regexSearch(s, m, word, s.data() + 3));
+  EXPECT_EQ("b2 ", m.matchPiece(0));
+  EXPECT_FALSE(regexSearch(s, m, word, s.data() + 2));
+  EXPECT_TRUE(regexSearch(s, m, Regex("\\w\\d"), s.data() + 2, s.data() + 5));
+  EXPECT_EQ(3, m.begin());
+  EXPECT_FALSE(regexSearch(s, m, Regex()));
+}
+
+TEST(Regex, MatchRegion) {
+  Regex re("(?<key>\\w+)=(?<value>\\w*)");
+  MatchRegion m;
+  EXPECT_FALSE(bool(m));
+  EXPECT_EQ(0, m.size());
+  std::string s = "a=1 bb= c=33";
+  std::vector<std::pair<std::string, std::string>> pairs;
+  for (const char* p = s.data(); regexSearch(s, m, re, p);
+       p = s.data() + m.end()) {
+    pairs.emplace_back(m.capture("key").str(), m.capture("value").str());
+    EXPECT_TRUE(m.capture("missing").empty());
+  }
+  std::vector<std::pair<std::string, std::string>> expected = {
+    {"a", "1"}, {"bb", ""}, {"c", "33"},
+  };
+  EXPECT_EQ(expected, pairs);
+  // the last search failed
+  EXPECT_FALSE(bool(m));
+  EXPECT_TRUE(m.capture("key").empty());
+
+  ASSERT_TRUE(regexSearch(s, m, re));
+  MatchRegion moved(std::move(m));
+  EXPECT_EQ("a=1", moved.matchPiece(0));
+  m = std::move(moved);
+  EXPECT_EQ("a", m.capture("key"));
+}
+
+TEST(Regex, IOBufSearch) {
+  std::string s;
+  for (int i = 0; i < 200; ++i) {
+    s += to<std::string>("id=", i, i % 7 ? " " : "\n",
+                         i % 11 ? "" : "caf\xc3\xa9 ");
+  }
+  static const char* const patterns[] = {
+    "id=\\d+", "\\d{2}\\s", "^id=1\\d", "\\d$", "caf\xc3\xa9",
+    "\\b", "x*", "(?<=\\n)id", "id(?==5)", "\\A..", "\\d\\s*\\z",
+    "\\d\\Z", "9.\\z", "nomatch",
+  };
+  std::mt19937 rng(9);
+  for (auto p : patterns) {
+    Regex re(p);
+    auto expected = allMatches(re, s);
+    EXPECT_EQ(expected, chainMatches(re, s, {}, 16)) << p;
+    for (int i = 0; i < 30; ++i) {
+      // buffers of 1 to 40 bytes, many shorter than maxMatchLength
+      std::vector<size_t> splits;
+      for (size_t pos = rng() % 40 + 1; pos < s.size(); pos += rng() % 40 + 1) {
+        splits.push_back(pos);
+      }
+      EXPECT_EQ(expected, chainMatches(re, s, splits, 16)) << p;
+      EXPECT_EQ(expected, chainMatches(re, s, splits, 8)) << p;
+    }
+  }
+}
+
+TEST(Regex, IOBufSearchEnd) {
+  // \\z and \\Z match at the end of the chain only, not at the end of
+  // a buffer or of a window
+  std::string s(100, 'a');
+  s += "\n";
+  for (size_t n = 1; n < s.size(); ++n) {
+    for (auto p : {"a\\z", "a\\Z", "a\\n\\z", "a(?=\\z)", "a$"}) {
+      Regex re(p);
+      auto expected = allMatches(re, s);
+      EXPECT_EQ(expected, chainMatches(re, s, {n}, 4)) << p << " " << n;
+      EXPECT_EQ(expected, chainMatches(re, s, {n / 2, n}, 2)) << p << " " << n;
+    }
+  }
+  // a match longer than maxMatchLength may be missed, but what is found
+  // is the match at that position in the whole chain
+  for (auto p : {"a+\\z", "a+\\n\\z", "a+\\Z", "a+$"}) {
+    Regex re(p);
+    Regex anchored(to<std::string>("\\G(?:", p, ")"));
+    for (size_t n = 1; n < s.size(); ++n) {
+      for (auto m : chainMatches(re, s, {n}, 4)) {
+        MatchRegion whole;
+        ASSERT_TRUE(regexSearch(s, whole, anchored, s.data() + m.first));
+        EXPECT_EQ(m.first, whole.begin());
+        EXPECT_EQ(m.second, whole.end()) << p << " " << n;
+      }
+    }
+  }
+  // empty chains
+  IOBufRegexSearcher empty(Regex("\\z"), nullptr);
+  EXPECT_TRUE(empty.next());
+  EXPECT_EQ(0, empty.offset());
+  EXPECT_FALSE(empty.next());
+}
+
+#endif
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return RUN_ALL_TESTS();
+}
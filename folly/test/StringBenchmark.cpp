@@ -16,6 +16,9 @@
 
 #include <folly/Benchmark.h>
 #include <folly/String.h>
+#include <folly/io/IOBufQueue.h>
+
+#include <random>
 
 BENCHMARK(libc_tolower, iters) {
   static const size_t kSize = 256;
@@ -47,6 +50,227 @@ BENCHMARK(folly_toLowerAscii, iters) {
   }
 }
 
+namespace {
+
+/*
+ * The table-driven versions, one character at a time, to compare with.
+ */
+
+template <class String>
+void tableCEscape(folly::StringPiece str, String& out) {
+  char esc[4];
+  esc[0] = '\\';
+  out.reserve(out.size() + str.size());
+  auto p = str.begin();
+  auto last = p;
+  while (p != str.end()) {
+    unsigned char v = static_cast<unsigned char>(*p);
+    char e = folly::detail::cEscapeTable[v];
+    if (e == 'P') {
+      ++p;
+      continue;
+    }
+    out.append(&*last, p - last);
+    if (e == 'O') {
+      esc[1] = '0' + ((v >> 6) & 7);
+      esc[2] = '0' + ((v >> 3) & 7);
+      esc[3] = '0' + (v & 7);
+      out.append(esc, 4);
+    } else {
+      esc[1] = e;
+      out.append(esc, 2);
+    }
+    last = ++p;
+  }
+  out.append(&*last, p - last);
+}
+
+template <class String>
+void tableUriEscape(folly::StringPiece str, String& out) {
+  static const char hexValues[] = "0123456789abcdef";
+  out.reserve(out.size() + str.size() + 3 * (str.size() / 4));
+  auto p = str.begin();
+  auto last = p;
+  while (p != str.end()) {
+    unsigned char v = static_cast<unsigned char>(*p);
+    if (folly::detail::uriEscapeTable[v] == 0) {
+      ++p;
+      continue;
+    }
+    out.append(&*last, p - last);
+    char esc[3] = {'%', hexValues[v >> 4], hexValues[v & 0x0f]};
+    out.append(esc, 3);
+    last = ++p;
+  }
+  out.append(&*last, p - last);
+}
+
+template <class String>
+void tableHexlify(folly::StringPiece input, String& output) {
+  static const char hexValues[] = "0123456789abcdef";
+  auto j = output.size();
+  output.resize(j + 2 * input.size());
+  for (unsigned char c : input) {
+    output[j++] = hexValues[c >> 4];
+    output[j++] = hexValues[c & 0x0f];
+  }
+}
+
+template <class String>
+bool tableUnhexlify(folly::StringPiece input, String& output) {
+  output.resize(input.size() / 2);
+  for (size_t i = 0; i < input.size(); i += 2) {
+    auto h1 = folly::detail::hexTable[static_cast<unsigned char>(input[i])];
+    auto h2 =
+      folly::detail::hexTable[static_cast<unsigned char>(input[i + 1])];
+    if (h1 == 16 || h2 == 16) {
+      return false;
+    }
+    output[i / 2] = (h1 << 4) | h2;
+  }
+  return true;
+}
+
+// A query string with a few characters to escape
+const std::string& urlInput() {
+  static const std::string input = [] {
+    std::string s;
+    std::mt19937 rng(42);
+    while (s.size() < 4096) {
+      s.append("user_id=1234567890&request=");
+      for (int i = 0; i < 40; ++i) {
+        s.push_back(rng() % 20 ? 'a' + rng() % 26 : "/ :?"[rng() % 4]);
+      }
+      s.push_back('&');
+    }
+    return s;
+  }();
+  return input;
+}
+
+const std::string& binaryInput() {
+  static const std::string input = [] {
+    std::string s(4096, '\0');
+    std::mt19937 rng(42);
+    for (auto& c : s) {
+      c = rng();
+    }
+    return s;
+  }();
+  return input;
+}
+
+const std::string& hexInput() {
+  static const std::string input = [] {
+    std::string s;
+    folly::hexlify(binaryInput(), s);
+    return s;
+  }();
+  return input;
+}
+
+} // namespace
+
+BENCHMARK(cEscapeTable, iters) {
+  std::string out;
+  for (size_t i = 0; i < iters; ++i) {
+    out.clear();
+    tableCEscape(urlInput(), out);
+  }
+}
+
+BENCHMARK_RELATIVE(cEscapeVectorized, iters) {
+  std::string out;
+  for (size_t i = 0; i < iters; ++i) {
+    out.clear();
+    folly::cEscape(urlInput(), out);
+  }
+}
+
+BENCHMARK_RELATIVE(cEscapeIOBuf, iters) {
+  for (size_t i = 0; i < iters; ++i) {
+    folly::IOBufQueue out;
+    folly::cEscape(urlInput(), out);
+  }
+}
+
+BENCHMARK_DRAW_LINE()
+
+BENCHMARK(uriEscapeTable, iters) {
+  std::string out;
+  for (size_t i = 0; i < iters; ++i) {
+    out.clear();
+    tableUriEscape(urlInput(), out);
+  }
+}
+
+BENCHMARK_RELATIVE(uriEscapeVectorized, iters) {
+  std::string out;
+  for (size_t i = 0; i < iters; ++i) {
+    out.clear();
+    folly::uriEscape(urlInput(), out);
+  }
+}
+
+BENCHMARK_RELATIVE(uriEscapeIOBuf, iters) {
+  for (size_t i = 0; i < iters; ++i) {
+    folly::IOBufQueue out;
+    folly::uriEscape(urlInput(), out);
+  }
+}
+
+BENCHMARK_DRAW_LINE()
+
+BENCHMARK(uriUnescapeVectorized, iters) {
+  std::string input;
+  BENCHMARK_SUSPEND { input = folly::uriEscape<std::string>(urlInput()); }
+  std::string out;
+  for (size_t i = 0; i < iters; ++i) {
+    out.clear();
+    folly::uriUnescape(input, out);
+  }
+}
+
+BENCHMARK_DRAW_LINE()
+
+BENCHMARK(hexlifyTable, iters) {
+  std::string out;
+  for (size_t i = 0; i < iters; ++i) {
+    out.clear();
+    tableHexlify(binaryInput(), out);
+  }
+}
+
+BENCHMARK_RELATIVE(hexlifyVectorized, iters) {
+  std::string out;
+  for (size_t i = 0; i < iters; ++i) {
+    folly::hexlify(binaryInput(), out);
+  }
+}
+
+BENCHMARK_RELATIVE(hexlifyIOBuf, iters) {
+  for (size_t i = 0; i < iters; ++i) {
+    folly::IOBufQueue out;
+    folly::hexlify(binaryInput(), out);
+  }
+}
+
+BENCHMARK_DRAW_LINE()
+
+BENCHMARK(unhexlifyTable, iters) {
+  std::string out;
+  for (size_t i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(tableUnhexlify(hexInput(), out));
+  }
+}
+
+BENCHMARK_RELATIVE(unhexlifyVectorized, iters) {
+  std::string out;
+  for (size_t i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(folly::unhexlify(hexInput(), out));
+  }
+}
+
 int main(int argc, char** argv) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
   folly::runBenchmarks();
@@ -22,6 +22,8 @@
 #include <gtest/gtest.h>
 
 #include <folly/Benchmark.h>
+#include <folly/small_vector.h>
+#include <folly/io/IOBufQueue.h>
 
 using namespace folly;
 using namespace std;
@@ -303,6 +305,38 @@ TEST(Escape, uriUnescapePercentDecoding) {
   }
 }
 
+TEST(Escape, IOBufQueue) {
+  // longer than the blocks escaped at a time
+  std::string input;
+  for (int i = 0; i < 10000; ++i) {
+    input.push_back(i % 7 ? 'a' + i % 26 : " /\"\n\xff?"[i % 6]);
+  }
+  auto toString = [](const IOBufQueue& queue) {
+    std::string out;
+    queue.appendToString(out);
+    return out;
+  };
+
+  IOBufQueue queue;
+  queue.append("x");
+  cEscape(input, queue);
+  EXPECT_EQ("x" + cEscape<std::string>(input), toString(queue));
+
+  for (auto mode : {UriEscapeMode::ALL, UriEscapeMode::QUERY,
+                    UriEscapeMode::PATH}) {
+    IOBufQueue escaped;
+    uriEscape(input, escaped, mode);
+    EXPECT_EQ(uriEscape<std::string>(input, mode), toString(escaped));
+    IOBufQueue unescaped;
+    uriUnescape(toString(escaped), unescaped, mode);
+    EXPECT_EQ(input, toString(unescaped));
+  }
+
+  IOBufQueue invalid(IOBufQueue::cacheChainLength());
+  EXPECT_THROW(uriUnescape("a%2", invalid), std::invalid_argument);
+  EXPECT_EQ(0, invalid.chainLength());
+}
+
 namespace {
 fbstring cbmString;
 fbstring cbmEscapedString;
@@ -920,6 +954,67 @@ TEST(Split, pieces_fbvector) {
   piecesTest<folly::fbvector>();
 }
 
+TEST(Split, small_vector) {
+  folly::small_vector<StringPiece, 4> pieces;
+  folly::split(',', "a,b,,c", pieces);
+  EXPECT_EQ(4, pieces.size());
+  EXPECT_EQ("c", pieces[3]);
+  folly::split(",,", "d,,e", pieces, true);
+  EXPECT_EQ(6, pieces.size());
+  EXPECT_EQ("e", pieces[5]);
+}
+
+TEST(Split, long_input) {
+  // crosses the blocks the delimiters are searched by
+  std::string line;
+  std::vector<std::string> expected;
+  for (int i = 0; i < 2000; ++i) {
+    expected.push_back(std::string(i % 37, 'a' + i % 26));
+    line += expected.back();
+    line += i % 3 ? ":" : "::";
+    if (i % 3 == 0) {
+      expected.push_back("");
+    }
+  }
+  expected.push_back("");
+
+  std::vector<std::string> parts;
+  folly::split(':', line, parts);
+  EXPECT_EQ(expected, parts);
+  EXPECT_EQ(expected.size(), folly::splitCount(':', line));
+
+  std::vector<StringPiece> pieces;
+  folly::split("::", line, pieces);
+  EXPECT_EQ(folly::splitCount("::", line), pieces.size());
+  EXPECT_EQ(line.size(), folly::join("::", pieces).size());
+
+  // overlapping delimiters are not matched twice
+  pieces.clear();
+  folly::split("aa", std::string(1025, 'a'), pieces);
+  EXPECT_EQ(513, pieces.size());
+  EXPECT_EQ("a", pieces.back());
+}
+
+TEST(Split, forEach) {
+  std::vector<std::string> tokens;
+  folly::splitForEach('\t', "a\tbc\t\td", [&](StringPiece token) {
+    tokens.push_back(token.str());
+  });
+  EXPECT_EQ((std::vector<std::string>{"a", "bc", "", "d"}), tokens);
+
+  tokens.clear();
+  folly::splitForEach("--", "--a----b", [&](StringPiece token) {
+    tokens.push_back(token.str());
+  }, true);
+  EXPECT_EQ((std::vector<std::string>{"a", "b"}), tokens);
+
+  EXPECT_EQ(4, folly::splitCount('\t', "a\tbc\t\td"));
+  EXPECT_EQ(3, folly::splitCount('\t', "a\tbc\t\td", true));
+  EXPECT_EQ(1, folly::splitCount(',', ""));
+  EXPECT_EQ(0, folly::splitCount(',', "", true));
+  EXPECT_EQ(1, folly::splitCount("long delimiter", "short"));
+}
+
 TEST(Split, fixed) {
   StringPiece a, b, c, d;
 
@@ -1106,6 +1201,36 @@ TEST(String, unhexlify) {
   EXPECT_FALSE(unhexlify(input4, output4));
 }
 
+TEST(String, hexlifyLong) {
+  // crosses the blocks of the vectorized versions
+  std::string input;
+  for (int i = 0; i < 1000; ++i) {
+    input.push_back(i * 37);
+  }
+  std::string hex;
+  EXPECT_TRUE(hexlify(input, hex));
+  EXPECT_EQ(2000, hex.size());
+  EXPECT_EQ("00254a6f94b9de03", hex.substr(0, 16));
+  std::string output;
+  EXPECT_TRUE(unhexlify(hex, output));
+  EXPECT_EQ(input, output);
+
+  std::string upper = boost::to_upper_copy(hex);
+  EXPECT_TRUE(unhexlify(upper, output));
+  EXPECT_EQ(input, output);
+  upper[1500] = 'G';
+  EXPECT_FALSE(unhexlify(upper, output));
+
+  IOBufQueue queue(IOBufQueue::cacheChainLength());
+  EXPECT_TRUE(hexlify(input, queue));
+  EXPECT_TRUE(unhexlify(hex, queue));
+  std::string both;
+  queue.appendToString(both);
+  EXPECT_EQ(hex + input, both);
+  EXPECT_FALSE(unhexlify(upper, queue));
+  EXPECT_EQ(3000, queue.chainLength());
+}
+
 TEST(String, backslashify) {
   EXPECT_EQ("abc", string("abc"));
   EXPECT_EQ("abc", backslashify(string("abc")));
@@ -1254,6 +1379,55 @@ BENCHMARK(splitStrFixed, iters) {
   }
 }
 
+namespace {
+
+std::string makeSplitLine(size_t fields) {
+  std::string line;
+  for (size_t i = 0; i < fields; ++i) {
+    line.append(i % 16 + 1, 'a' + i % 26);
+    line.push_back('\t');
+  }
+  return line;
+}
+
+} // namespace
+
+BENCHMARK(splitLongLine, iters) {
+  static const std::string line = makeSplitLine(1000);
+  std::vector<StringPiece> pieces;
+  for (size_t i = 0; i < iters; ++i) {
+    pieces.clear();
+    folly::split('\t', line, pieces);
+  }
+}
+
+BENCHMARK(splitLongLineForEach, iters) {
+  static const std::string line = makeSplitLine(1000);
+  for (size_t i = 0; i < iters; ++i) {
+    size_t n = 0;
+    folly::splitForEach('\t', line, [&](StringPiece token) {
+      n += token.size();
+    });
+    folly::doNotOptimizeAway(n);
+  }
+}
+
+BENCHMARK(splitLongLineCount, iters) {
+  static const std::string line = makeSplitLine(1000);
+  for (size_t i = 0; i < iters; ++i) {
+    folly::doNotOptimizeAway(folly::splitCount('\t', line));
+  }
+}
+
+BENCHMARK(splitLongLineStr, iters) {
+  static const std::string line = makeSplitLine(1000);
+  std::vector<StringPiece> pieces;
+  for (size_t i = 0; i < iters; ++i) {
+    pieces.clear();
+    folly::split("\t", line, pieces);
+  }
+}
+
 BENCHMARK(boost_splitOnSingleChar, iters) {
   static const std::string line = "one:two:three:four";
   bool(*pred)(char) = [] (char c) -> bool { return c == ':'; };
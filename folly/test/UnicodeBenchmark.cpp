@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/ext/Unicode.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+using namespace std;
+using namespace folly;
+
+namespace {
+
+const size_t kCorpusSize = 64 * 1024;
+
+// Pieces are picked at random until the corpus is kCorpusSize bytes
+string makeCorpus(const vector<string>& pieces) {
+  std::mt19937 rng(42);
+  string s;
+  while (s.size() < kCorpusSize) {
+    s += pieces[rng() % pieces.size()];
+  }
+  return s;
+}
+
+const string ascii = makeCorpus({
+  "lorem ", "ipsum ", "dolor ", "sit ", "amet, ", "consectetur. ", "\n",
+});
+const string cjk = makeCorpus({
+  "中文", "日本語", "한국어", "。",
+});
+const string mixed = makeCorpus({
+  "lorem ", "ipsum ", "中文", "café ", "über ",
+  "\U0001f600", "да ", "\n",
+});
+
+// the generic (one code point at a time) versions
+
+bool scalarIsValid(const string& s) {
+  return utf8StringIsValid<const char*>(s.data(), s.data() + s.size());
+}
+
+size_t scalarCodePointCount(const string& s) {
+  size_t n = 0;
+  auto end = makeUtf8Iterator(s.data() + s.size());
+  for (auto it = makeUtf8Iterator(s.data()); it != end; ++it) {
+    ++n;
+  }
+  return n;
+}
+
+size_t scalarDistance(const string& s) {
+  return unicode::u16::distance<const char*>(s.data(),
+                                             s.data() + s.size());
+}
+
+bool scalarIsAscii(const string& s) {
+  return std::all_of(s.begin(), s.end(),
+                     [](char c) { return U8_IS_SINGLE(c); });
+}
+
+template <class F>
+void run(size_t iters, const string& s, F fn) {
+  for (size_t i = 0; i < iters; ++i) {
+    auto r = fn(s);
+    doNotOptimizeAway(r);
+  }
+}
+
+} // namespace
+
+#define UNICODE_BENCHMARKS(corpus)                                        \
+  BENCHMARK(corpus##_isValid_scalar, iters) {                             \
+    run(iters, corpus, scalarIsValid);                                    \
+  }                                                                       \
+  BENCHMARK_RELATIVE(corpus##_isValid, iters) {                           \
+    run(iters, corpus, [](const string& s) {                              \
+      return utf8StringIsValid(s);                                        \
+    });                                                                   \
+  }                                                                       \
+  BENCHMARK(corpus##_codePointCount_scalar, iters) {                      \
+    run(iters, corpus, scalarCodePointCount);                             \
+  }                                                                       \
+  BENCHMARK_RELATIVE(corpus##_codePointCount, iters) {                    \
+    run(iters, corpus, [](const string& s) {                              \
+      return utf8CodePointCount(s);                                       \
+    });                                                                   \
+  }                                                                       \
+  BENCHMARK(corpus##_u16distance_scalar, iters) {                         \
+    run(iters, corpus, scalarDistance);                                   \
+  }                                                                       \
+  BENCHMARK_RELATIVE(corpus##_u16distance, iters) {                       \
+    run(iters, corpus, [](const string& s) {                              \
+      return unicode::u16::distance(s.data(), s.data() + s.size());       \
+    });                                                                   \
+  }                                                                       \
+  BENCHMARK(corpus##_isAscii_scalar, iters) {                             \
+    run(iters, corpus, scalarIsAscii);                                    \
+  }                                                                       \
+  BENCHMARK_RELATIVE(corpus##_isAscii, iters) {                           \
+    run(iters, corpus, [](const string& s) {                              \
+      return stringIsAscii(s);                                            \
+    });                                                                   \
+  }
+
+UNICODE_BENCHMARKS(ascii)
+UNICODE_BENCHMARKS(cjk)
+UNICODE_BENCHMARKS(mixed)
+
+int main(int argc, char** argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2015, Yeolar
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/ext/UnicodeNormalizer.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+
+#if FOLLY_HAVE_LIBICU
+
+using namespace folly;
+using namespace folly::unicode;
+
+namespace {
+
+const NormalizationMode kModes[] = {
+  NORM_NFC, NORM_NFD, NORM_NFKC, NORM_NFKD,
+};
+
+std::string toString(const IOBufQueue& queue) {
+  if (queue.empty()) {
+    return "";
+  }
+  return queue.front()->clone()->moveToFbString().toStdString();
+}
+
+// Normalize s fed as the given chunks
+std::string normalizeChunks(const std::string& s,
+                            const std::vector<size_t>& splits,
+                            NormalizationMode mode) {
+  Normalizer normalizer(mode);
+  IOBufQueue out;
+  size_t pos = 0;
+  for (size_t split : splits) {
+    normalizer.process(StringPiece(s.data() + pos, s.data() + split), out);
+    pos = split;
+  }
+  normalizer.process(StringPiece(s.data() + pos, s.data() + s.size()), out);
+  normalizer.finish(out);
+  return toString(out);
+}
+
+// Normalize s fed as a chain of IOBufs split at the given positions
+std::string normalizeChain(const std::string& s,
+                           const std::vector<size_t>& splits,
+                           NormalizationMode mode) {
+  auto chain = IOBuf::create(0);
+  size_t pos = 0;
+  for (size_t split : splits) {
+    chain->prependChain(IOBuf::copyBuffer(s.data() + pos, split - pos));
+    pos = split;
+  }
+  chain->prependChain(IOBuf::copyBuffer(s.data() + pos, s.size() - pos));
+  return Normalizer::normalize(std::move(chain), mode)
+    ->moveToFbString().toStdString();
+}
+
+} // namespace
+
+TEST(Normalizer, Forms) {
+  struct {
+    NormalizationMode mode;
+    std::string in;
+    std::string expected;
+  } tests[] = {
+    // composition and decomposition of e + U+0301 (combining acute)
+    {NORM_NFC, "caf" "e\xcc\x81", "caf\xc3\xa9"},
+    {NORM_NFD, "caf\xc3\xa9", "cafe\xcc\x81"},
+    {NORM_NFC, "caf\xc3\xa9", "caf\xc3\xa9"},
+    {NORM_NFD, "cafe\xcc\x81", "cafe\xcc\x81"},
+    // canonical reordering: U+0323 (dot below, ccc 220) goes before
+    // U+0301 (acute, ccc 230)
+    {NORM_NFD, "a\xcc\x81\xcc\xa3", "a\xcc\xa3\xcc\x81"},
+    {NORM_NFD, "\xc3\xa1\xcc\xa3", "a\xcc\xa3\xcc\x81"},
+    // then U+1EA1 (a with dot below) composes with the acute
+    {NORM_NFC, "a\xcc\x81\xcc\xa3", "\xe1\xba\xa1\xcc\x81"},
+    // Hangul L + V -> U+AC00
+    {NORM_NFC, "\xe1\x84\x80\xe1\x85\xa1", "\xea\xb0\x80"},
+    {NORM_NFD, "\xea\xb0\x80", "\xe1\x84\x80\xe1\x85\xa1"},
+    // compatibility: U+FB01 (fi ligature)
+    {NORM_NFC, "\xef\xac\x81", "\xef\xac\x81"},
+    {NORM_NFKC, "\xef\xac\x81", "fi"},
+    {NORM_NFKD, "\xef\xac\x81", "fi"},
+    {NORM_NONE, "e\xcc\x81", "e\xcc\x81"},
+    {NORM_NFC, "", ""},
+    {NORM_NFC, "ascii only", "ascii only"},
+  };
+  for (auto& t : tests) {
+    EXPECT_EQ(t.expected, normalize(t.in, t.mode));
+    EXPECT_EQ(t.expected, normalizeChunks(t.in, {}, t.mode));
+    EXPECT_EQ(t.expected, normalizeChain(t.in, {}, t.mode));
+  }
+}
+
+TEST(Normalizer, EverySplit) {
+  // combining sequences and multi-byte code points across the splits
+  std::string s = "x a\xcc\x81\xcc\xa3 caf" "e\xcc\x81 \xe1\x84\x80\xe1\x85\xa1"
+                  "\xc3\xa9\xcc\xa3\xcc\x88 \xef\xac\x81 \xf0\x9f\x98\x80"
+                  "o\xcc\x88\xcc\x81 e";
+  for (auto mode : kModes) {
+    std::string expected = normalize(s, mode);
+    for (size_t i = 0; i <= s.size(); ++i) {
+      EXPECT_EQ(expected, normalizeChunks(s, {i}, mode)) << mode << " " << i;
+      EXPECT_EQ(expected, normalizeChain(s, {i}, mode)) << mode << " " << i;
+      for (size_t j = i; j <= s.size(); j += 3) {
+        EXPECT_EQ(expected, normalizeChunks(s, {i, j}, mode));
+      }
+    }
+  }
+}
+
+TEST(Normalizer, RandomSplits) {
+  // mostly combining marks, to get long sequences which need reordering
+  static const char* const pieces[] = {
+    "a", "e", "o", " ", "\xc3\xa9", "\xe1\xba\xa1",
+    "\xcc\x81", "\xcc\x88", "\xcc\xa3", "\xcc\xa7", "\xcd\x85",
+    "\xe1\x84\x80", "\xe1\x85\xa1", "\xe1\x86\xa8", "\xef\xac\x81",
+  };
+  std::mt19937 rng(2015);
+  for (int i = 0; i < 300; ++i) {
+    std::string s;
+    for (size_t n = rng() % 60; n > 0; --n) {
+      s += pieces[rng() % (sizeof(pieces) / sizeof(pieces[0]))];
+    }
+    std::vector<size_t> splits;
+    for (size_t pos = 0; s.size() > 0 && splits.size() < 8; ) {
+      pos += rng() % (s.size() / 4 + 1);
+      if (pos > s.size()) {
+        break;
+      }
+      splits.push_back(pos);
+    }
+    for (auto mode : kModes) {
+      std::string expected = normalize(s, mode);
+      EXPECT_EQ(expected, normalizeChunks(s, splits, mode));
+      EXPECT_EQ(expected, normalizeChain(s, splits, mode));
+    }
+  }
+}
+
+TEST(Normalizer, PassThrough) {
+  // normalized text is appended by reference
+  std::string s(1000, 'a');
+  s += "caf\xc3\xa9";
+  auto buf = IOBuf::copyBuffer(s);
+  const uint8_t* data = buf->data();
+  auto out = Normalizer::normalize(std::move(buf), NORM_NFC);
+  size_t length = 0;
+  const IOBuf* p = out.get();
+  do {
+    EXPECT_EQ(data + length, p->data());
+    length += p->length();
+    p = p->next();
+  } while (p != out.get());
+  EXPECT_EQ(s.size(), length);
+  EXPECT_EQ(s, out->moveToFbString().toStdString());
+}
+
+TEST(Normalizer, Cursor) {
+  auto chain = IOBuf::copyBuffer("prefix cafe");
+  chain->prependChain(IOBuf::copyBuffer("\xcc\x81 suffix"));
+  io::Cursor cursor(chain.get());
+  cursor.skip(7);
+  Normalizer normalizer(NORM_NFC);
+  IOBufQueue out;
+  normalizer.process(cursor, out);
+  EXPECT_TRUE(cursor.isAtEnd());
+  normalizer.finish(out);
+  EXPECT_EQ("caf\xc3\xa9 suffix", toString(out));
+}
+
+TEST(Normalizer, Reuse) {
+  Normalizer normalizer(NORM_NFD);
+  IOBufQueue out;
+  // the pending text of a stream doesn't leak into the next one
+  normalizer.process(StringPiece("a\xcc\x81"), out);
+  normalizer.finish(out);
+  normalizer.process(StringPiece("\xcc\xa3"), out);
+  normalizer.finish(out);
+  EXPECT_EQ("a\xcc\x81\xcc\xa3", toString(out));
+  EXPECT_THROW(Normalizer(NormalizationMode(0)), std::invalid_argument);
+}
+
+#endif
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return RUN_ALL_TESTS();
+}